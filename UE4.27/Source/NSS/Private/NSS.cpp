@@ -31,6 +31,7 @@
 #include "NSSHistory.h"
 #include "NSSInclude.h"
 #include "NSSModule.h"
+#include "NSSStats.h"
 #include "PixelShaderUtils.h"
 #include "PlanarReflectionSceneProxy.h"
 #include "PostProcess/SceneRenderTargets.h"
@@ -44,6 +45,8 @@
 #define GFrameCounterRenderThread GFrameNumberRenderThread
 
 DECLARE_GPU_STAT(ArmNSSPass);
+DEFINE_STAT(STAT_NSS_CropCopiesAvoided);
+CSV_DEFINE_CATEGORY(NSS, true);
 
 namespace
 {
@@ -58,6 +61,16 @@ namespace
 		}
 
 		FIntPoint CroppedSize = Texture.ViewRect.Size() - PaddingOnOutput;
+		// Everything downstream reads the upscaled colour through its view rect, so the padding can simply be left
+		// outside of it.
+		if (CVarNSSCropFreeOutput.GetValueOnRenderThread() != 0)
+		{
+			INC_DWORD_STAT(STAT_NSS_CropCopiesAvoided);
+			CSV_CUSTOM_STAT(NSS, CropCopiesAvoided, 1, ECsvCustomStatOp::Accumulate);
+			return FScreenPassTexture(
+				Texture.Texture, FIntRect(Texture.ViewRect.Min, Texture.ViewRect.Min + CroppedSize));
+		}
+
 		FRDGTextureDesc Desc = Texture.Texture->Desc;
 		QuantizeSceneBufferSize(CroppedSize, Desc.Extent);
 		Desc.Flags = TexCreate_RenderTargetable | TexCreate_ShaderResource;
@@ -577,7 +590,8 @@ void NSS::AddPasses(FRDGBuilder& GraphBuilder,
 			View.ViewState->PrevFrameViewInfo.TemporalAAHistory.SafeRelease();
 			View.ViewState->PrevFrameViewInfo.TemporalAAHistory.ViewportRect =
 				FIntRect(0, 0, OutputExtents.X, OutputExtents.Y);
-			View.ViewState->PrevFrameViewInfo.TemporalAAHistory.ReferenceBufferSize = OutputExtents;
+			// The history is the padded output, with the padding outside of the viewport.
+			View.ViewState->PrevFrameViewInfo.TemporalAAHistory.ReferenceBufferSize = PaddedOutputSize;
 			if (!View.ViewState->PrevFrameViewInfo.CustomTemporalAAHistory.GetReference())
 			{
 				View.ViewState->PrevFrameViewInfo.CustomTemporalAAHistory =
@@ -817,6 +831,7 @@ void NSS::AddPasses(FRDGBuilder& GraphBuilder,
 			static_cast<NSSHistory*>(View.ViewState->PrevFrameViewInfo.CustomTemporalAAHistory.GetReference());
 		GraphBuilder.QueueTextureExtraction(PaddedOutputColor, &NewHistory->PaddedUpscaledColour);
 		GraphBuilder.QueueTextureExtraction(PaddedInputDepth.Texture, &NewHistory->PaddedDepth);
+		NewHistory->PaddedDepthViewRect = PaddedInputDepth.ViewRect;
 	}
 
 	View.ViewState->TemporalAASampleIndex = FMath::Clamp(View.ViewState->TemporalAASampleIndex, int8(0), MAX_int8);
@@ -46,6 +46,12 @@ TAutoConsoleVariable<int32> CVarNSSAdjustMipBias(
 	TEXT("Allow NSS to adjust the minimum global texture mip bias "
 		 "(r.ViewTextureMipBias.Min & r.ViewTextureMipBias.Offset)"),
 	ECVF_ReadOnly);
+TAutoConsoleVariable<int32> CVarNSSCropFreeOutput(
+	TEXT("r.NSS.CropFreeOutput"),
+	1,
+	TEXT("Return the padded NSS output with a view rect instead of copying it into a cropped texture "
+		 "(0 = crop with a copy, 1 = no copy)."),
+	ECVF_RenderThreadSafe);
 // clang-format on
 
 //-------------------------------------------------------------------------------------
@@ -20,6 +20,7 @@ extern NGSETTINGS_API TAutoConsoleVariable<int32> CVarEnableNSS;
 extern NGSETTINGS_API TAutoConsoleVariable<int32> CVarEnableNSSInEditor;
 extern NGSETTINGS_API TAutoConsoleVariable<int32> CVarNSSDebug;
 extern NGSETTINGS_API TAutoConsoleVariable<int32> CVarNSSAdjustMipBias;
+extern NGSETTINGS_API TAutoConsoleVariable<int32> CVarNSSCropFreeOutput;
 
 //-------------------------------------------------------------------------------------
 // Settings for Arm Neural Super Sampling 1.0 exposed through the Editor UI.
@@ -33,6 +33,7 @@
 #include "NSSInclude.h"
 #include "NSSModule.h"
 #include "NSSProxy.h"
+#include "NSSStats.h"
 #include "PixelShaderUtils.h"
 #include "PlanarReflectionSceneProxy.h"
 #include "PostProcess/SceneRenderTargets.h"
@@ -44,6 +45,8 @@
 #include "TranslucentRendering.h"
 
 DECLARE_GPU_STAT(ArmNSSPass);
+DEFINE_STAT(STAT_NSS_CropCopiesAvoided);
+CSV_DEFINE_CATEGORY(NSS, true);
 
 namespace
 {
@@ -58,6 +61,16 @@ namespace
 		}
 
 		FIntPoint CroppedSize = Texture.ViewRect.Size() - PaddingOnOutput;
+		// Everything downstream reads the upscaled colour through its view rect, so the padding can simply be left
+		// outside of it.
+		if (CVarNSSCropFreeOutput.GetValueOnRenderThread() != 0)
+		{
+			INC_DWORD_STAT(STAT_NSS_CropCopiesAvoided);
+			CSV_CUSTOM_STAT(NSS, CropCopiesAvoided, 1, ECsvCustomStatOp::Accumulate);
+			return FScreenPassTexture(
+				Texture.Texture, FIntRect(Texture.ViewRect.Min, Texture.ViewRect.Min + CroppedSize));
+		}
+
 		FRDGTextureDesc Desc = Texture.Texture->Desc;
 		QuantizeSceneBufferSize(CroppedSize, Desc.Extent);
 		Desc.Flags = TexCreate_RenderTargetable | TexCreate_ShaderResource;
@@ -568,7 +581,8 @@ INSS::FOutputs NSS::AddPasses(FRDGBuilder& GraphBuilder, const NSSView& SceneVie
 			View.ViewState->PrevFrameViewInfo.TemporalAAHistory.SafeRelease();
 			View.ViewState->PrevFrameViewInfo.TemporalAAHistory.ViewportRect =
 				FIntRect(0, 0, OutputExtents.X, OutputExtents.Y);
-			View.ViewState->PrevFrameViewInfo.TemporalAAHistory.ReferenceBufferSize = OutputExtents;
+			// The history is the padded output, with the padding outside of the viewport.
+			View.ViewState->PrevFrameViewInfo.TemporalAAHistory.ReferenceBufferSize = PaddedOutputSize;
 		}
 		NewHistory = new NSSHistory(CurrentNSSState, const_cast<NSS*>(this));
 		check(NewHistory);
@@ -646,7 +660,8 @@ INSS::FOutputs NSS::AddPasses(FRDGBuilder& GraphBuilder, const NSSView& SceneVie
 	//------------------------------
 	FRDGTextureDesc PaddedOutputColorDesc = PassInputs.SceneColor.Texture->Desc;
 	PaddedOutputColorDesc.Extent = PaddedOutputSize;
-	PaddedOutputColorDesc.Flags = TexCreate_ShaderResource | TexCreate_UAV;
+	// Render targetable as this may be handed downstream as the scene colour rather than a cropped copy.
+	PaddedOutputColorDesc.Flags = TexCreate_ShaderResource | TexCreate_UAV | TexCreate_RenderTargetable;
 	PaddedOutputColorDesc.Format = EPixelFormat::PF_FloatR11G11B10;
 	FRDGTextureRef PaddedOutputColor = GraphBuilder.CreateTexture(
 		PaddedOutputColorDesc, TEXT("ArmNSSPaddedOutputSceneColor"), ERDGTextureFlags::MultiFrame);
@@ -798,6 +813,7 @@ INSS::FOutputs NSS::AddPasses(FRDGBuilder& GraphBuilder, const NSSView& SceneVie
 		// updates such as when the world is paused.
 		GraphBuilder.QueueTextureExtraction(PaddedOutputColor, &NewHistory->PaddedUpscaledColour);
 		GraphBuilder.QueueTextureExtraction(PaddedInputDepth.Texture, &NewHistory->PaddedDepth);
+		NewHistory->PaddedDepthViewRect = PaddedInputDepth.ViewRect;
 		GraphBuilder.QueueTextureExtraction(
 			PaddedOutputColor, &View.ViewState->PrevFrameViewInfo.TemporalAAHistory.RT[0]);
 	}
@@ -0,0 +1,17 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Stats/Stats.h"
+
+//-------------------------------------------------------------------------------------
+// Stats for the NSS upscaler, visible with "stat NSS" and in CSV profiles under the NSS category.
+//-------------------------------------------------------------------------------------
+DECLARE_STATS_GROUP(TEXT("NSS"), STATGROUP_NSS, STATCAT_Advanced);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Output crop copies avoided"), STAT_NSS_CropCopiesAvoided, STATGROUP_NSS, );
+
+CSV_DECLARE_CATEGORY_EXTERN(NSS);
@@ -0,0 +1,31 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+using UnrealBuildTool;
+
+public class NGCPUBackend : ModuleRules
+{
+	public NGCPUBackend(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"NGShared",
+			}
+		);
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Engine",
+				"RenderCore",
+				"RHI",
+			}
+		);
+
+		PrecompileForTargets = PrecompileTargetsType.Any;
+	}
+}
@@ -0,0 +1,477 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#include "NGCPUBackend.h"
+
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "NGCPUBackendIncludes.h"
+#include "RHIResources.h"
+#include "RenderGraphResources.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogNGCPUBackend, Log, All);
+DEFINE_LOG_CATEGORY(LogNGCPUBackend);
+
+IMPLEMENT_MODULE(NGCPUBackendModule, NGCPUBackend)
+
+namespace
+{
+	//-------------------------------------------------------------------------------------
+	// The state of a context, which the ffxContext handle points at.
+	//-------------------------------------------------------------------------------------
+	struct NGCPUContext
+	{
+		ffxApiCreateContextDescNss Params;
+		uint64 NumDispatches = 0;
+	};
+
+	// How much of the current frame the reference upscale blends into the reprojected history.
+	constexpr float CurrentFrameWeight = 0.1f;
+
+	float SampleChannel(const NGCPUImage& Image, int32 X, int32 Y, int32 Channel)
+	{
+		X = FMath::Clamp(X, 0, Image.Size.X - 1);
+		Y = FMath::Clamp(Y, 0, Image.Size.Y - 1);
+		return Channel < Image.Channels ? Image.At(X, Y)[Channel] : 0.0f;
+	}
+
+	// Bilinear sample at a position in texels, clamped to the edge of the image.
+	float SampleBilinear(const NGCPUImage& Image, const FVector2f& Pos, int32 Channel)
+	{
+		const FVector2f Texel = Pos - FVector2f(0.5f, 0.5f);
+		const int32 X = FMath::FloorToInt32(Texel.X);
+		const int32 Y = FMath::FloorToInt32(Texel.Y);
+		const float FracX = Texel.X - float(X);
+		const float FracY = Texel.Y - float(Y);
+		const float Top =
+			FMath::Lerp(SampleChannel(Image, X, Y, Channel), SampleChannel(Image, X + 1, Y, Channel), FracX);
+		const float Bottom =
+			FMath::Lerp(SampleChannel(Image, X, Y + 1, Channel), SampleChannel(Image, X + 1, Y + 1, Channel), FracX);
+		return FMath::Lerp(Top, Bottom, FracY);
+	}
+
+	const NGCPUImage* GetImage(const FfxApiResource& Resource)
+	{
+		return static_cast<const NGCPUImage*>(Resource.resource);
+	}
+
+	//-------------------------------------------------------------------------------------
+	// Reference temporal upscale: the current frame is upsampled bilinearly and blended into the previous output,
+	// reprojected with the motion vectors and clamped to the current frame's neighbourhood to reject stale history.
+	// It has none of the network's reconstruction, but produces a plausible, deterministic output to test against.
+	//-------------------------------------------------------------------------------------
+	void ReferenceUpscale(const ffxApiDispatchDescNss& Desc, const NGCPUImage& Color, NGCPUImage& Output)
+	{
+		const NGCPUImage* MotionVectors = GetImage(Desc.motionVectors);
+		const NGCPUImage* History = Desc.reset ? nullptr : GetImage(Desc.outputTm1);
+		const FVector2f RenderSize(float(Desc.renderSize.width), float(Desc.renderSize.height));
+		const FVector2f UpscaleSize(float(Desc.upscaleSize.width), float(Desc.upscaleSize.height));
+		const FVector2f InputScale = RenderSize / UpscaleSize;
+		const FVector2f Jitter(Desc.jitterOffset.x, Desc.jitterOffset.y);
+		const int32 Width = FMath::Min(int32(Desc.upscaleSize.width), Output.Size.X);
+		const int32 Height = FMath::Min(int32(Desc.upscaleSize.height), Output.Size.Y);
+
+		for (int32 Y = 0; Y < Height; Y++)
+		{
+			for (int32 X = 0; X < Width; X++)
+			{
+				const FVector2f OutputPos(float(X) + 0.5f, float(Y) + 0.5f);
+				const FVector2f InputPos = OutputPos * InputScale + Jitter;
+				const FIntPoint NearestInput(FMath::FloorToInt32(InputPos.X), FMath::FloorToInt32(InputPos.Y));
+
+				// Motion vectors are the UV offset from the previous frame scaled by motionVectorScale, in render
+				// pixels.
+				FVector2f HistoryPos = OutputPos;
+				if (MotionVectors)
+				{
+					const FVector2f Motion(SampleChannel(*MotionVectors, NearestInput.X, NearestInput.Y, 0),
+						SampleChannel(*MotionVectors, NearestInput.X, NearestInput.Y, 1));
+					HistoryPos -= Motion * FVector2f(Desc.motionVectorScale.x, Desc.motionVectorScale.y) / InputScale;
+				}
+				const bool bHistoryValid = History && HistoryPos.X >= 0.0f && HistoryPos.Y >= 0.0f
+										   && HistoryPos.X < UpscaleSize.X && HistoryPos.Y < UpscaleSize.Y;
+
+				float* Out = Output.At(X, Y);
+				for (int32 Channel = 0; Channel < Output.Channels; Channel++)
+				{
+					const float Current = SampleBilinear(Color, InputPos, Channel);
+					if (!bHistoryValid)
+					{
+						Out[Channel] = Current;
+						continue;
+					}
+					float Min = MAX_flt;
+					float Max = -MAX_flt;
+					for (int32 OffsetY = -1; OffsetY <= 1; OffsetY++)
+					{
+						for (int32 OffsetX = -1; OffsetX <= 1; OffsetX++)
+						{
+							const float Neighbour =
+								SampleChannel(Color, NearestInput.X + OffsetX, NearestInput.Y + OffsetY, Channel);
+							Min = FMath::Min(Min, Neighbour);
+							Max = FMath::Max(Max, Neighbour);
+						}
+					}
+					const float Previous = FMath::Clamp(SampleBilinear(*History, HistoryPos, Channel), Min, Max);
+					Out[Channel] = FMath::Lerp(Previous, Current, CurrentFrameWeight);
+				}
+			}
+		}
+	}
+
+	//-------------------------------------------------------------------------------------
+	// The CPU implementation of the FFX shared backend.
+	//-------------------------------------------------------------------------------------
+	class NGCPUBackend final : public INGSharedBackend
+	{
+	public:
+		//-------------------------------------------------------------------------------------
+		// Records the CPU time of a call on destruction.
+		//-------------------------------------------------------------------------------------
+		class FCallScope
+		{
+		public:
+			FCallScope(NGCPUBackend& InBackend, ENGCPUBackendCall InCall)
+				: Backend(InBackend), Call(InCall), StartSeconds(FPlatformTime::Seconds())
+			{}
+
+			~FCallScope()
+			{
+				Backend.RecordCall(Call, FPlatformTime::Seconds() - StartSeconds);
+			}
+
+		private:
+			NGCPUBackend& Backend;
+			ENGCPUBackendCall Call;
+			double StartSeconds;
+		};
+
+		ffxReturnCode_t ffxCreateContext(ffxContext* context, ffxCreateContextDescHeader* desc) final
+		{
+			FCallScope Scope(*this, ENGCPUBackendCall::CreateContext);
+			if (!context || !desc)
+			{
+				return FFX_API_RETURN_ERROR_PARAMETER;
+			}
+			if (desc->type != FFX_API_CREATE_CONTEXT_DESC_TYPE_NSS)
+			{
+				return FFX_API_RETURN_ERROR_UNKNOWN_DESCTYPE;
+			}
+			NGCPUContext* Context = new NGCPUContext();
+			Context->Params = *reinterpret_cast<const ffxApiCreateContextDescNss*>(desc);
+			Context->Params.header.pNext = nullptr;
+			*context = reinterpret_cast<ffxContext>(Context);
+			return FFX_API_RETURN_OK;
+		}
+
+		ffxReturnCode_t ffxDestroyContext(ffxContext* context) final
+		{
+			FCallScope Scope(*this, ENGCPUBackendCall::DestroyContext);
+			if (!context || !*context)
+			{
+				return FFX_API_RETURN_ERROR_PARAMETER;
+			}
+			delete reinterpret_cast<NGCPUContext*>(*context);
+			*context = nullptr;
+			return FFX_API_RETURN_OK;
+		}
+
+		ffxReturnCode_t ffxConfigure(ffxContext* context, const ffxConfigureDescHeader* desc) final
+		{
+			FCallScope Scope(*this, ENGCPUBackendCall::Configure);
+			return context && *context && desc ? FFX_API_RETURN_OK : FFX_API_RETURN_ERROR_PARAMETER;
+		}
+
+		ffxReturnCode_t ffxQuery(ffxContext* context, ffxQueryDescHeader* desc) final
+		{
+			FCallScope Scope(*this, ENGCPUBackendCall::Query);
+			// There is no GPU memory or time to report, so NSS falls back to its estimates.
+			return FFX_API_RETURN_ERROR_UNKNOWN_DESCTYPE;
+		}
+
+		ffxReturnCode_t ffxDispatch(ffxContext* context, const ffxDispatchDescHeader* desc) final
+		{
+			FCallScope Scope(*this, ENGCPUBackendCall::Dispatch);
+			return DispatchContext(context, desc);
+		}
+
+		ffxReturnCode_t ffxDispatchBatch(TConstArrayView<NGSharedBatchedDispatch> Dispatches) final
+		{
+			FCallScope Scope(*this, ENGCPUBackendCall::DispatchBatch);
+			// Contexts only touch their own images, so different contexts are upscaled in parallel. A context
+			// dispatched twice reads its previous output, so such a batch is dispatched in order.
+			bool bDistinctContexts = true;
+			for (int32 Index = 0; Index < Dispatches.Num() && bDistinctContexts; Index++)
+			{
+				for (int32 Other = 0; Other < Index; Other++)
+				{
+					if (Dispatches[Other].Context && Dispatches[Index].Context
+						&& *Dispatches[Other].Context == *Dispatches[Index].Context)
+					{
+						bDistinctContexts = false;
+						break;
+					}
+				}
+			}
+			TArray<ffxReturnCode_t, TInlineAllocator<8>> Codes;
+			Codes.SetNumUninitialized(Dispatches.Num());
+			ParallelFor(
+				Dispatches.Num(),
+				[this, Dispatches, &Codes](int32 Index)
+				{ Codes[Index] = DispatchContext(Dispatches[Index].Context, Dispatches[Index].Desc); },
+				bDistinctContexts ? EParallelForFlags::Unbalanced : EParallelForFlags::ForceSingleThread);
+			for (const ffxReturnCode_t Code : Codes)
+			{
+				if (Code != FFX_API_RETURN_OK)
+				{
+					return Code;
+				}
+			}
+			return FFX_API_RETURN_OK;
+		}
+
+		ffxReturnCode_t DispatchContext(ffxContext* context, const ffxDispatchDescHeader* desc)
+		{
+			if (!context || !*context || !desc)
+			{
+				return FFX_API_RETURN_ERROR_PARAMETER;
+			}
+			if (desc->type != FFX_API_DISPATCH_DESC_TYPE_NSS)
+			{
+				return FFX_API_RETURN_ERROR_UNKNOWN_DESCTYPE;
+			}
+			NGCPUContext* Context = reinterpret_cast<NGCPUContext*>(*context);
+			const ffxApiDispatchDescNss& Desc = *reinterpret_cast<const ffxApiDispatchDescNss*>(desc);
+			if (Desc.renderSize.width == 0 || Desc.renderSize.height == 0
+				|| Desc.renderSize.width > Context->Params.maxRenderSize.width
+				|| Desc.renderSize.height > Context->Params.maxRenderSize.height
+				|| Desc.upscaleSize.width > Context->Params.maxUpscaleSize.width
+				|| Desc.upscaleSize.height > Context->Params.maxUpscaleSize.height)
+			{
+				UE_LOG(LogNGCPUBackend,
+					Error,
+					TEXT("Dispatch of %ux%u to %ux%u exceeds the context's maximum sizes"),
+					Desc.renderSize.width,
+					Desc.renderSize.height,
+					Desc.upscaleSize.width,
+					Desc.upscaleSize.height);
+				return FFX_API_RETURN_ERROR_PARAMETER;
+			}
+			Context->NumDispatches++;
+
+			const NGCPUImage* Color = GetImage(Desc.color);
+			NGCPUImage* Output = static_cast<NGCPUImage*>(Desc.output.resource);
+			if (Color && Output)
+			{
+				ReferenceUpscale(Desc, *Color, *Output);
+			}
+			return FFX_API_RETURN_OK;
+		}
+
+		EFFXBackendAPI GetAPI() const final
+		{
+			return EFFXBackendAPI::CPU;
+		}
+
+		FfxApiResource GetNativeResource(FRHITexture* Texture, FfxApiResourceState State) final
+		{
+			FCallScope Scope(*this, ENGCPUBackendCall::GetNativeResource);
+			check(Texture);
+			// RHI textures have no texels the CPU can read, so only their description is filled in.
+			const FIntVector Size = Texture->GetSizeXYZ();
+			FfxApiResource Resource = {};
+			Resource.resource = nullptr;
+			Resource.state = State;
+			Resource.description.flags = FFX_API_RESOURCE_FLAGS_NONE;
+			Resource.description.type = FFX_API_RESOURCE_TYPE_TEXTURE2D;
+			Resource.description.width = Size.X;
+			Resource.description.height = Size.Y;
+			Resource.description.depth = 1;
+			Resource.description.mipCount = Texture->GetNumMips();
+			Resource.description.format = FFX_API_SURFACE_FORMAT_UNKNOWN;
+			Resource.description.usage = (State & FFX_API_RESOURCE_STATE_UNORDERED_ACCESS)
+											 ? FFX_API_RESOURCE_USAGE_READ_ONLY | FFX_API_RESOURCE_USAGE_UAV
+											 : FFX_API_RESOURCE_USAGE_READ_ONLY;
+			return Resource;
+		}
+
+		FfxApiResource GetNativeResource(FRDGTexture* Texture, FfxApiResourceState State) final
+		{
+			check(Texture);
+			return GetNativeResource(Texture->GetRHI(), State);
+		}
+
+		FfxCommandList GetNativeCommandBuffer(FRHICommandListImmediate& RHICmdList, FRHITexture* Texture) final
+		{
+			FCallScope Scope(*this, ENGCPUBackendCall::GetNativeCommandBuffer);
+			return nullptr;
+		}
+
+		void EnqueueNativeCommands(
+			FRHICommandListImmediate& RHICmdList, TUniqueFunction<void(FfxCommandList)>&& Commands) final
+		{
+			{
+				FCallScope Scope(*this, ENGCPUBackendCall::EnqueueNativeCommands);
+			}
+			// Dispatches run on the CPU as they are recorded, so there is nothing to order them with. They are timed
+			// on their own.
+			Commands(nullptr);
+		}
+
+		bool IsNeuralGraphicSupported() final
+		{
+			return true;
+		}
+
+		bool IsLoaded() final
+		{
+			return true;
+		}
+
+		void ForceUAVTransition(
+			FRHICommandListImmediate& RHICmdList, FRHITexture* OutputTexture, ERHIAccess Access) final
+		{
+			FCallScope Scope(*this, ENGCPUBackendCall::ForceUAVTransition);
+		}
+
+		bool GetDispatchTimings(ffxContext* context, NGSharedDispatchTimings& OutTimings) final
+		{
+			FCallScope Scope(*this, ENGCPUBackendCall::GetDispatchTimings);
+			return false;
+		}
+
+		void RecordCall(ENGCPUBackendCall Call, double Seconds)
+		{
+			FScopeLock Lock(&StatsMutex);
+			NGCPUBackendCallStats& Stats = CallStats[uint8(Call)];
+			Stats.Calls++;
+			Stats.TotalSeconds += Seconds;
+			Stats.MaxSeconds = FMath::Max(Stats.MaxSeconds, Seconds);
+		}
+
+		NGCPUBackendCallStats GetCallStats(ENGCPUBackendCall Call) const
+		{
+			FScopeLock Lock(&StatsMutex);
+			return CallStats[uint8(Call)];
+		}
+
+		void ResetCallStats()
+		{
+			FScopeLock Lock(&StatsMutex);
+			for (NGCPUBackendCallStats& Stats : CallStats)
+			{
+				Stats = NGCPUBackendCallStats();
+			}
+		}
+
+	private:
+		mutable FCriticalSection StatsMutex;
+		NGCPUBackendCallStats CallStats[uint8(ENGCPUBackendCall::Num)];
+	};
+
+	NGCPUBackend GNGCPUBackend;
+
+	FAutoConsoleCommand CmdDumpCallStats(TEXT("r.NSS.CPUBackend.DumpCallStats"),
+		TEXT("Logs the CPU cost of each call made to the CPU backend. Pass 'reset' to clear the stats afterwards."),
+		FConsoleCommandWithArgsDelegate::CreateLambda(
+			[](const TArray<FString>& Args)
+			{
+				NGCPUBackendModule& Module = FModuleManager::GetModuleChecked<NGCPUBackendModule>(TEXT("NGCPUBackend"));
+				Module.DumpCallStats();
+				if (Args.Contains(TEXT("reset")))
+				{
+					Module.ResetCallStats();
+				}
+			}));
+}
+
+//-------------------------------------------------------------------------------------
+// Implementation for NGCPUBackendModule.
+//-------------------------------------------------------------------------------------
+void NGCPUBackendModule::StartupModule() {}
+
+void NGCPUBackendModule::ShutdownModule() {}
+
+INGSharedBackend* NGCPUBackendModule::GetBackend()
+{
+	return &GNGCPUBackend;
+}
+
+FfxApiResource NGCPUBackendModule::GetImageResource(NGCPUImage& Image, FfxApiResourceState State)
+{
+	FfxApiResource Resource = {};
+	Resource.resource = &Image;
+	Resource.state = State;
+	Resource.description.flags = FFX_API_RESOURCE_FLAGS_NONE;
+	Resource.description.type = FFX_API_RESOURCE_TYPE_TEXTURE2D;
+	Resource.description.width = Image.Size.X;
+	Resource.description.height = Image.Size.Y;
+	Resource.description.depth = 1;
+	Resource.description.mipCount = 1;
+	Resource.description.format = Image.Channels == 1   ? FFX_API_SURFACE_FORMAT_R32_FLOAT
+								  : Image.Channels == 2 ? FFX_API_SURFACE_FORMAT_R32G32_FLOAT
+														: FFX_API_SURFACE_FORMAT_R32G32B32A32_FLOAT;
+	Resource.description.usage = (State & FFX_API_RESOURCE_STATE_UNORDERED_ACCESS)
+									 ? FFX_API_RESOURCE_USAGE_READ_ONLY | FFX_API_RESOURCE_USAGE_UAV
+									 : FFX_API_RESOURCE_USAGE_READ_ONLY;
+	return Resource;
+}
+
+NGCPUBackendCallStats NGCPUBackendModule::GetCallStats(ENGCPUBackendCall Call) const
+{
+	return GNGCPUBackend.GetCallStats(Call);
+}
+
+void NGCPUBackendModule::ResetCallStats()
+{
+	GNGCPUBackend.ResetCallStats();
+}
+
+const TCHAR* NGCPUBackendModule::GetCallName(ENGCPUBackendCall Call)
+{
+	switch (Call)
+	{
+	case ENGCPUBackendCall::CreateContext:
+		return TEXT("ffxCreateContext");
+	case ENGCPUBackendCall::DestroyContext:
+		return TEXT("ffxDestroyContext");
+	case ENGCPUBackendCall::Configure:
+		return TEXT("ffxConfigure");
+	case ENGCPUBackendCall::Query:
+		return TEXT("ffxQuery");
+	case ENGCPUBackendCall::Dispatch:
+		return TEXT("ffxDispatch");
+	case ENGCPUBackendCall::DispatchBatch:
+		return TEXT("ffxDispatchBatch");
+	case ENGCPUBackendCall::GetNativeResource:
+		return TEXT("GetNativeResource");
+	case ENGCPUBackendCall::GetNativeCommandBuffer:
+		return TEXT("GetNativeCommandBuffer");
+	case ENGCPUBackendCall::EnqueueNativeCommands:
+		return TEXT("EnqueueNativeCommands");
+	case ENGCPUBackendCall::ForceUAVTransition:
+		return TEXT("ForceUAVTransition");
+	case ENGCPUBackendCall::GetDispatchTimings:
+		return TEXT("GetDispatchTimings");
+	default:
+		return TEXT("Unknown");
+	}
+}
+
+void NGCPUBackendModule::DumpCallStats() const
+{
+	UE_LOG(LogNGCPUBackend, Display, TEXT("CPU backend call costs:"));
+	for (uint8 Call = 0; Call < uint8(ENGCPUBackendCall::Num); Call++)
+	{
+		const NGCPUBackendCallStats Stats = GetCallStats(ENGCPUBackendCall(Call));
+		UE_LOG(LogNGCPUBackend,
+			Display,
+			TEXT("  %-24s %8llu calls, %10.2f us average, %10.2f us max, %10.3f ms total"),
+			GetCallName(ENGCPUBackendCall(Call)),
+			Stats.Calls,
+			Stats.GetAverageMicroseconds(),
+			Stats.MaxSeconds * 1000000.0,
+			Stats.TotalSeconds * 1000.0);
+	}
+}
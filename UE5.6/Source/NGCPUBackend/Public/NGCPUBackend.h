@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Modules/ModuleManager.h"
+#include "NGSharedBackend.h"
+
+//-------------------------------------------------------------------------------------
+// An image in CPU memory that the CPU backend reads and writes in place of a texture. Resources that point at one
+// (see NGCPUBackendModule::GetImageResource) are upscaled by ffxDispatch, while RHI textures, which have no texel
+// data under the null RHI, are only validated.
+//-------------------------------------------------------------------------------------
+struct NGCPUImage
+{
+	FIntPoint Size = FIntPoint::ZeroValue;
+	// Tightly packed floats per texel.
+	int32 Channels = 0;
+	TArray<float> Texels;
+
+	void Init(FIntPoint InSize, int32 InChannels, float Value = 0.0f)
+	{
+		Size = InSize;
+		Channels = InChannels;
+		Texels.Init(Value, Size.X * Size.Y * Channels);
+	}
+
+	float* At(int32 X, int32 Y)
+	{
+		return &Texels[(Y * Size.X + X) * Channels];
+	}
+
+	const float* At(int32 X, int32 Y) const
+	{
+		return &Texels[(Y * Size.X + X) * Channels];
+	}
+};
+
+// The INGSharedBackend calls whose CPU cost the CPU backend records.
+enum class ENGCPUBackendCall : uint8
+{
+	CreateContext,
+	DestroyContext,
+	Configure,
+	Query,
+	Dispatch,
+	DispatchBatch,
+	GetNativeResource,
+	GetNativeCommandBuffer,
+	EnqueueNativeCommands,
+	ForceUAVTransition,
+	GetDispatchTimings,
+	Num
+};
+
+// CPU cost of one of the backend's calls since the stats were last reset.
+struct NGCPUBackendCallStats
+{
+	uint64 Calls = 0;
+	double TotalSeconds = 0.0;
+	double MaxSeconds = 0.0;
+
+	double GetAverageMicroseconds() const
+	{
+		return Calls > 0 ? TotalSeconds * 1000000.0 / double(Calls) : 0.0;
+	}
+};
+
+//-------------------------------------------------------------------------------------
+// Module that implements an FFX backend on the CPU with a simple reference upscale, so that NSS can be driven on
+// machines without a GPU (e.g. -nullrhi) and the plugin's own overhead can be measured without the SDK.
+//-------------------------------------------------------------------------------------
+class NGCPUBACKEND_API NGCPUBackendModule : public INGSharedBackendModule
+{
+public:
+	// IModuleInterface implementation
+	void StartupModule() override;
+	void ShutdownModule() override;
+
+	INGSharedBackend* GetBackend() final;
+
+	// Returns a resource that the CPU backend reads from or writes to Image.
+	static FfxApiResource GetImageResource(NGCPUImage& Image, FfxApiResourceState State);
+
+	NGCPUBackendCallStats GetCallStats(ENGCPUBackendCall Call) const;
+	void ResetCallStats();
+	static const TCHAR* GetCallName(ENGCPUBackendCall Call);
+
+	// Logs the cost of each call.
+	void DumpCallStats() const;
+};
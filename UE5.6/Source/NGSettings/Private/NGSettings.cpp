@@ -46,6 +46,273 @@ TAutoConsoleVariable<int32> CVarNSSAdjustMipBias(
 	TEXT("Allow NSS to adjust the minimum global texture mip bias "
 		 "(r.ViewTextureMipBias.Min & r.ViewTextureMipBias.Offset)"),
 	ECVF_ReadOnly);
+
+TAutoConsoleVariable<int32> CVarNSSFusedInputPreparation(
+	TEXT("r.NSS.FusedInputPreparation"),
+	1,
+	TEXT("Prepare the NSS inputs (mirror padding and motion vector conversion) in a single compute pass "
+		 "(0 = separate mirror pad and velocity conversion passes, 1 = fused compute pass)."),
+	ECVF_RenderThreadSafe);
+TAutoConsoleVariable<int32> CVarNSSZeroCopyInputs(
+	TEXT("r.NSS.ZeroCopyInputs"),
+	0,
+	TEXT("Hand the scene colour and depth to NSS directly instead of copying them into padded textures, writing only "
+		 "the mirrored border texels past the end of the view. Falls back to copies when the view doesn't start at "
+		 "the origin of the scene textures, they have no room for the padding, or the padding would overlap another "
+		 "view of the family such as in split screen. Compare with stat NSS "
+		 "(0 = padded copies, 1 = pad in place when possible)."),
+	ECVF_RenderThreadSafe);
+TAutoConsoleVariable<int32> CVarNSSCropFreeOutput(
+	TEXT("r.NSS.CropFreeOutput"),
+	1,
+	TEXT("Return the padded NSS output with a view rect instead of copying it into a cropped texture "
+		 "(0 = crop with a copy, 1 = no copy)."),
+	ECVF_RenderThreadSafe);
+TAutoConsoleVariable<int32> CVarNSSResourcePoolBucketSize(
+	TEXT("r.NSS.ResourcePool.BucketSize"),
+	64,
+	TEXT("Round the extent of pooled NSS intermediates up to a multiple of this many pixels so that small resolution "
+		 "changes keep reusing them (0 = exact extents)."),
+	ECVF_RenderThreadSafe);
+TAutoConsoleVariable<int32> CVarNSSResourcePoolMaxSizeMB(
+	TEXT("r.NSS.ResourcePool.MaxSizeMB"),
+	256,
+	TEXT("Memory ceiling for each view's NSS resource pool in MB. Unused resources are released, least recently used "
+		 "first, while a pool is above it."),
+	ECVF_RenderThreadSafe);
+TAutoConsoleVariable<int32> CVarNSSResourcePoolMaxUnusedFrames(
+	TEXT("r.NSS.ResourcePool.MaxUnusedFrames"),
+	30,
+	TEXT("Release pooled NSS resources that haven't been used for this many frames."),
+	ECVF_RenderThreadSafe);
+TAutoConsoleVariable<int32> CVarNSSContextCacheMaxCount(
+	TEXT("r.NSS.ContextCache.MaxCount"),
+	2,
+	TEXT("Maximum number of released NSS contexts kept for reuse. Least recently used contexts are destroyed first."),
+	ECVF_RenderThreadSafe);
+TAutoConsoleVariable<int32> CVarNSSContextCacheMaxSizeMB(
+	TEXT("r.NSS.ContextCache.MaxSizeMB"),
+	512,
+	TEXT("Memory budget in MB for released NSS contexts kept for reuse."),
+	ECVF_RenderThreadSafe);
+TAutoConsoleVariable<int32> CVarNSSContextPrecreation(
+	TEXT("r.NSS.ContextPrecreation"),
+	0,
+	TEXT("Create the NSS contexts predicted from the display size, r.ScreenPercentage and the dynamic resolution "
+		 "bounds on a background thread before they are needed, instead of on the render thread the first time a "
+		 "resolution is seen. Requires a backend that can create contexts off the render thread."),
+	ECVF_RenderThreadSafe);
+TAutoConsoleVariable<int32> CVarNSSDynamicResolution(
+	TEXT("r.NSS.DynamicResolution"),
+	0,
+	TEXT("Create one NSS context per view for the largest render size the dynamic resolution bounds (or the screen "
+		 "percentage) allow and pass the current render size to each dispatch, instead of creating a context for "
+		 "every render size. The context, output and history are then sized for that render size with headroom and "
+		 "the padding the smallest render size needs, so it is meant for projects using dynamic resolution:\n"
+		 " 0: off (default)\n"
+		 " 1: on"),
+	ECVF_RenderThreadSafe);
+TAutoConsoleVariable<float> CVarNSSDynamicResolutionHeadroom(
+	TEXT("r.NSS.DynamicResolution.Headroom"),
+	0.1f,
+	TEXT("Extra render size, as a fraction, given to an NSS context that has to grow so that it isn't recreated again "
+		 "as soon as the render size creeps upwards."),
+	ECVF_RenderThreadSafe);
+TAutoConsoleVariable<int32> CVarNSSDynamicResolutionResizeDelayFrames(
+	TEXT("r.NSS.DynamicResolution.ResizeDelayFrames"),
+	60,
+	TEXT("Number of frames the dynamic resolution bounds must stay outside of an NSS context's sizes before it is "
+		 "recreated. A frame that doesn't fit in the context recreates it immediately."),
+	ECVF_RenderThreadSafe);
+TAutoConsoleVariable<int32> CVarNSSGPUTiming(
+	TEXT("r.NSS.GPUTiming"),
+	0,
+	TEXT("Time the stages of NSS (input preparation, the dispatch and its sub-stages when the backend reports them, "
+		 "and the output crop) with GPU timestamps, for stat NSS and CSV profiles. The passes of each stage are also "
+		 "visible in stat gpu regardless of this setting."),
+	ECVF_RenderThreadSafe);
+TAutoConsoleVariable<int32> CVarNSSFlushAfterDispatch(
+	TEXT("r.NSS.FlushAfterDispatch"),
+	0,
+	TEXT("Flush the immediate command list to the RHI thread after recording each NSS dispatch, as earlier versions "
+		 "did. Only useful to compare the render thread time it costs (CSV NSS/DispatchRecording)."),
+	ECVF_RenderThreadSafe);
+
+TAutoConsoleVariable<int32> CVarNSSCPUBackend(
+	TEXT("r.NSS.CPUBackend"),
+	1,
+	TEXT("When to use the CPU reference backend instead of the NG-SDK, read at startup:\n"
+		 " 0: never\n"
+		 " 1: when running with the null RHI (-nullrhi), e.g. on CI machines without a GPU (default)\n"
+		 " 2: always, to measure the plugin's own CPU overhead without the SDK (the output isn't upscaled)"),
+	ECVF_ReadOnly);
+
+TAutoConsoleVariable<int32> CVarNSSXRCrossEyeReuse(
+	TEXT("r.NSS.XR.CrossEyeReuse"),
+	0,
+	TEXT("With stereo rendering, let the secondary eye reuse the primary eye's upscaled output through stereo "
+		 "reprojection instead of running the network every frame, see r.NSS.XR.SecondaryEyeInterval. Texels the "
+		 "primary eye can't see fall back to the secondary eye's own render. Set it per platform in the platform's "
+		 "Engine.ini ([/Script/NGSettings.NGSettings]) or in a device profile."),
+	ECVF_RenderThreadSafe);
+TAutoConsoleVariable<int32> CVarNSSXRSecondaryEyeInterval(
+	TEXT("r.NSS.XR.SecondaryEyeInterval"),
+	2,
+	TEXT("With r.NSS.XR.CrossEyeReuse, the secondary eye runs the network on one frame in this many and is "
+		 "reprojected from the primary eye on the others. The network's own temporal state skips the reprojected "
+		 "frames, so larger intervals trade quality for time. 1 runs it on every frame."),
+	ECVF_RenderThreadSafe);
+TAutoConsoleVariable<float> CVarNSSXRDisocclusionThreshold(
+	TEXT("r.NSS.XR.DisocclusionThreshold"),
+	0.01f,
+	TEXT("Relative difference in depth past which a reprojected texel of the secondary eye is taken to be a surface "
+		 "the primary eye can't see."),
+	ECVF_RenderThreadSafe);
+
+TAutoConsoleVariable<int32> CVarNSSQualityMode(
+	TEXT("r.NSS.QualityMode"),
+	0,
+	TEXT("Set r.ScreenPercentage from a named NSS quality mode while NSS is enabled:\n"
+		 " 0: Custom, r.ScreenPercentage is left as it is (default)\n"
+		 " 1: Quality, 67%\n"
+		 " 2: Balanced, 59%\n"
+		 " 3: Performance, 50%\n"
+		 " 4: Ultra Performance, 33%"),
+	ECVF_Default);
+TAutoConsoleVariable<int32> CVarNSSGovernor(
+	TEXT("r.NSS.Governor.Enable"),
+	0,
+	TEXT("Pick r.ScreenPercentage every frame from the measured GPU frame time against r.NSS.Governor.BudgetMs, "
+		 "between r.NSS.Governor.MinScreenPercentage and the quality mode's screen percentage (or the one set when "
+		 "the quality mode is Custom)."),
+	ECVF_Default);
+TAutoConsoleVariable<float> CVarNSSGovernorBudgetMs(
+	TEXT("r.NSS.Governor.BudgetMs"),
+	16.6f,
+	TEXT("The GPU frame time in milliseconds the NSS governor aims for."),
+	ECVF_Default);
+TAutoConsoleVariable<float> CVarNSSGovernorMinScreenPercentage(
+	TEXT("r.NSS.Governor.MinScreenPercentage"),
+	33.0f,
+	TEXT("The lowest screen percentage the NSS governor goes down to."),
+	ECVF_Default);
+TAutoConsoleVariable<float> CVarNSSGovernorHysteresis(
+	TEXT("r.NSS.Governor.Hysteresis"),
+	0.1f,
+	TEXT("Half the width of the band around the budget, as a fraction of it, inside which the NSS governor leaves the "
+		 "screen percentage alone."),
+	ECVF_Default);
+TAutoConsoleVariable<int32> CVarNSSGovernorSettleFrames(
+	TEXT("r.NSS.Governor.SettleFrames"),
+	10,
+	TEXT("Number of consecutive frames the GPU frame time has to stay over the budget's band before the NSS governor "
+		 "lowers the screen percentage. Raising it waits twice as long."),
+	ECVF_Default);
+TAutoConsoleVariable<int32> CVarNSSCalibration(
+	TEXT("r.NSS.Calibration"),
+	0,
+	TEXT("Set r.NSS.QualityMode to the highest quality mode whose NSS cost fits in r.NSS.Calibration.TargetMs, timed "
+		 "on the GPU by replaying a short built-in sequence in the background the first time NSS runs on a GPU and "
+		 "driver. Skipped where the RHI has no GPU timestamps. The result is kept in the user's Engine.ini "
+		 "([/Script/NGSettings.NGSettings.Calibration]), see also r.NSS.Calibrate:\n"
+		 " 0: off (default)\n"
+		 " 1: calibrate once per GPU, driver and target\n"
+		 " 2: calibrate on every launch"),
+	ECVF_Default);
+TAutoConsoleVariable<float> CVarNSSCalibrationTargetMs(
+	TEXT("r.NSS.Calibration.TargetMs"),
+	4.0f,
+	TEXT("The GPU time in milliseconds NSS may take per frame at the quality mode r.NSS.Calibration picks."),
+	ECVF_Default);
+TAutoConsoleVariable<int32> CVarNSSStaticFrameSkip(
+	TEXT("r.NSS.StaticFrameSkip"),
+	0,
+	TEXT("Skip the network for the frames of a view of a paused world whose camera, jitter, exposure and sizes "
+		 "haven't changed, e.g. in pause menus, reusing the converged history as the output instead to save power. "
+		 "The frames of a running world are always upscaled. The motion vectors of paused views are also measured on "
+		 "the GPU, so that objects moving while the game is paused stop the reuse a few frames later."),
+	ECVF_RenderThreadSafe);
+TAutoConsoleVariable<int32> CVarNSSStaticFrameSkipMaxReuseFrames(
+	TEXT("r.NSS.StaticFrameSkip.MaxReuseFrames"),
+	30,
+	TEXT("With r.NSS.StaticFrameSkip, the most consecutive frames the output is reused for before the network runs "
+		 "again, which picks up the changes that can't be detected such as lighting or animated materials."),
+	ECVF_RenderThreadSafe);
+TAutoConsoleVariable<int32> CVarNSSStaticFrameSkipConvergeFrames(
+	TEXT("r.NSS.StaticFrameSkip.ConvergeFrames"),
+	8,
+	TEXT("With r.NSS.StaticFrameSkip, the number of static frames the network runs on before its output is reused, "
+		 "so that the history has converged over the jitter sequence."),
+	ECVF_RenderThreadSafe);
+TAutoConsoleVariable<int32> CVarNSSSparseTiles(
+	TEXT("r.NSS.SparseTiles"),
+	0,
+	TEXT("Preview, not in shipping builds: classifies the tiles of each upscaled frame by whether their motion, depth "
+		 "or luma changed since the last frame, and reports the share of tiles that would need the network once a halo "
+		 "is added around the changed ones (stat NSS, and the NSS CSV category). It costs GPU time and saves none, as "
+		 "the network still runs on the whole frame; the replay commandlet's -SparseTiles measures the same offline.\n"
+		 " 0: off (default)\n"
+		 " 1: classify and report"),
+	ECVF_RenderThreadSafe);
+TAutoConsoleVariable<int32> CVarNSSSparseTilesTileSize(
+	TEXT("r.NSS.SparseTiles.TileSize"),
+	8,
+	TEXT("With r.NSS.SparseTiles, the size of the tiles in render pixels, which is at least 8."),
+	ECVF_RenderThreadSafe);
+TAutoConsoleVariable<int32> CVarNSSSparseTilesHalo(
+	TEXT("r.NSS.SparseTiles.Halo"),
+	1,
+	TEXT("With r.NSS.SparseTiles, the number of tiles around each changed tile that are active as well, which covers "
+		 "the reach of the network beyond the changed pixels."),
+	ECVF_RenderThreadSafe);
+TAutoConsoleVariable<float> CVarNSSSparseTilesMotionThreshold(
+	TEXT("r.NSS.SparseTiles.MotionThreshold"),
+	0.05f,
+	TEXT("With r.NSS.SparseTiles, the longest motion vector of a tile, in render pixels, past which it changed."),
+	ECVF_RenderThreadSafe);
+TAutoConsoleVariable<float> CVarNSSSparseTilesDepthThreshold(
+	TEXT("r.NSS.SparseTiles.DepthThreshold"),
+	0.001f,
+	TEXT("With r.NSS.SparseTiles, the relative difference of the mean device z of a tile past which it changed."),
+	ECVF_RenderThreadSafe);
+TAutoConsoleVariable<float> CVarNSSSparseTilesLumaThreshold(
+	TEXT("r.NSS.SparseTiles.LumaThreshold"),
+	0.02f,
+	TEXT("With r.NSS.SparseTiles, the relative difference of the mean luma of a tile past which it changed."),
+	ECVF_RenderThreadSafe);
+TAutoConsoleVariable<int32> CVarNSSROI(
+	TEXT("r.NSS.ROI"),
+	0,
+	TEXT("Preview, not in shipping builds: keeps the network's output within a region of interest of each view only, "
+		 "such as a fovea or the point the player is looking at, with a bilinear upscale of the render in the "
+		 "periphery blended in across a feathered edge. The network still runs on the whole frame, so this costs GPU "
+		 "time and saves none: the share of the output's pixels it would run on is reported (stat NSS, and the NSS "
+		 "CSV category). Game code can set the region of a view with INSSModule::SetRegionOfInterest, otherwise it is "
+		 "given by the r.NSS.ROI.* cvars.\n"
+		 " 0: off (default)\n"
+		 " 1: on"),
+	ECVF_RenderThreadSafe);
+TAutoConsoleVariable<float> CVarNSSROICenterX(
+	TEXT("r.NSS.ROI.CenterX"),
+	0.5f,
+	TEXT("With r.NSS.ROI, the horizontal centre of the region of interest, from 0 at the left of the view to 1."),
+	ECVF_RenderThreadSafe);
+TAutoConsoleVariable<float> CVarNSSROICenterY(
+	TEXT("r.NSS.ROI.CenterY"),
+	0.5f,
+	TEXT("With r.NSS.ROI, the vertical centre of the region of interest, from 0 at the top of the view to 1."),
+	ECVF_RenderThreadSafe);
+TAutoConsoleVariable<float> CVarNSSROIRadius(
+	TEXT("r.NSS.ROI.Radius"),
+	0.35f,
+	TEXT("With r.NSS.ROI, the radius of the region of interest as a fraction of the height of the view."),
+	ECVF_RenderThreadSafe);
+TAutoConsoleVariable<float> CVarNSSROIFeather(
+	TEXT("r.NSS.ROI.Feather"),
+	0.1f,
+	TEXT("With r.NSS.ROI, the width of the edge past the radius of the region of interest across which the periphery "
+		 "is blended in, as a fraction of the height of the view. 0 gives a hard edge."),
+	ECVF_RenderThreadSafe);
 // clang-format on
 
 //-------------------------------------------------------------------------------------
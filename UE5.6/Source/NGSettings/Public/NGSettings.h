@@ -20,6 +20,57 @@ extern NGSETTINGS_API TAutoConsoleVariable<int32> CVarEnableNSS;
 extern NGSETTINGS_API TAutoConsoleVariable<int32> CVarEnableNSSInEditor;
 extern NGSETTINGS_API TAutoConsoleVariable<int32> CVarNSSDebug;
 extern NGSETTINGS_API TAutoConsoleVariable<int32> CVarNSSAdjustMipBias;
+extern NGSETTINGS_API TAutoConsoleVariable<int32> CVarNSSFusedInputPreparation;
+extern NGSETTINGS_API TAutoConsoleVariable<int32> CVarNSSZeroCopyInputs;
+extern NGSETTINGS_API TAutoConsoleVariable<int32> CVarNSSCropFreeOutput;
+extern NGSETTINGS_API TAutoConsoleVariable<int32> CVarNSSResourcePoolBucketSize;
+extern NGSETTINGS_API TAutoConsoleVariable<int32> CVarNSSResourcePoolMaxSizeMB;
+extern NGSETTINGS_API TAutoConsoleVariable<int32> CVarNSSResourcePoolMaxUnusedFrames;
+extern NGSETTINGS_API TAutoConsoleVariable<int32> CVarNSSContextCacheMaxCount;
+extern NGSETTINGS_API TAutoConsoleVariable<int32> CVarNSSContextCacheMaxSizeMB;
+extern NGSETTINGS_API TAutoConsoleVariable<int32> CVarNSSContextPrecreation;
+extern NGSETTINGS_API TAutoConsoleVariable<int32> CVarNSSDynamicResolution;
+extern NGSETTINGS_API TAutoConsoleVariable<float> CVarNSSDynamicResolutionHeadroom;
+extern NGSETTINGS_API TAutoConsoleVariable<int32> CVarNSSDynamicResolutionResizeDelayFrames;
+extern NGSETTINGS_API TAutoConsoleVariable<int32> CVarNSSGPUTiming;
+extern NGSETTINGS_API TAutoConsoleVariable<int32> CVarNSSFlushAfterDispatch;
+extern NGSETTINGS_API TAutoConsoleVariable<int32> CVarNSSCPUBackend;
+extern NGSETTINGS_API TAutoConsoleVariable<int32> CVarNSSXRCrossEyeReuse;
+extern NGSETTINGS_API TAutoConsoleVariable<int32> CVarNSSXRSecondaryEyeInterval;
+extern NGSETTINGS_API TAutoConsoleVariable<float> CVarNSSXRDisocclusionThreshold;
+extern NGSETTINGS_API TAutoConsoleVariable<int32> CVarNSSQualityMode;
+extern NGSETTINGS_API TAutoConsoleVariable<int32> CVarNSSGovernor;
+extern NGSETTINGS_API TAutoConsoleVariable<float> CVarNSSGovernorBudgetMs;
+extern NGSETTINGS_API TAutoConsoleVariable<float> CVarNSSGovernorMinScreenPercentage;
+extern NGSETTINGS_API TAutoConsoleVariable<float> CVarNSSGovernorHysteresis;
+extern NGSETTINGS_API TAutoConsoleVariable<int32> CVarNSSGovernorSettleFrames;
+extern NGSETTINGS_API TAutoConsoleVariable<int32> CVarNSSCalibration;
+extern NGSETTINGS_API TAutoConsoleVariable<float> CVarNSSCalibrationTargetMs;
+extern NGSETTINGS_API TAutoConsoleVariable<int32> CVarNSSStaticFrameSkip;
+extern NGSETTINGS_API TAutoConsoleVariable<int32> CVarNSSStaticFrameSkipMaxReuseFrames;
+extern NGSETTINGS_API TAutoConsoleVariable<int32> CVarNSSStaticFrameSkipConvergeFrames;
+extern NGSETTINGS_API TAutoConsoleVariable<int32> CVarNSSSparseTiles;
+extern NGSETTINGS_API TAutoConsoleVariable<int32> CVarNSSSparseTilesTileSize;
+extern NGSETTINGS_API TAutoConsoleVariable<int32> CVarNSSSparseTilesHalo;
+extern NGSETTINGS_API TAutoConsoleVariable<float> CVarNSSSparseTilesMotionThreshold;
+extern NGSETTINGS_API TAutoConsoleVariable<float> CVarNSSSparseTilesDepthThreshold;
+extern NGSETTINGS_API TAutoConsoleVariable<float> CVarNSSSparseTilesLumaThreshold;
+extern NGSETTINGS_API TAutoConsoleVariable<int32> CVarNSSROI;
+extern NGSETTINGS_API TAutoConsoleVariable<float> CVarNSSROICenterX;
+extern NGSETTINGS_API TAutoConsoleVariable<float> CVarNSSROICenterY;
+extern NGSETTINGS_API TAutoConsoleVariable<float> CVarNSSROIRadius;
+extern NGSETTINGS_API TAutoConsoleVariable<float> CVarNSSROIFeather;
+
+// The render resolutions NSS can be set to through r.NSS.QualityMode.
+UENUM()
+enum class ENSSQualityMode : uint8
+{
+	Custom = 0 UMETA(DisplayName = "Custom (r.ScreenPercentage)"),
+	Quality = 1 UMETA(DisplayName = "Quality (67%)"),
+	Balanced = 2 UMETA(DisplayName = "Balanced (59%)"),
+	Performance = 3 UMETA(DisplayName = "Performance (50%)"),
+	UltraPerformance = 4 UMETA(DisplayName = "Ultra Performance (33%)"),
+};
 
 //-------------------------------------------------------------------------------------
 // Settings for Arm Neural Super Sampling 1.0 exposed through the Editor UI.
@@ -63,6 +114,83 @@ public:
 			DisplayName = "Adjust Mip Bias",
 			ToolTip = "NSS Adjust Mip Bias"))
 	bool bNSSAdjustMipBias;
+
+	// Config = Engine, so a platform's own Engine.ini can override it to enable the mode on some platforms only.
+	UPROPERTY(Config,
+		EditAnywhere,
+		Category = "NSS|XR",
+		meta = (ConsoleVariable = "r.NSS.XR.CrossEyeReuse",
+			DisplayName = "Cross-Eye Reuse",
+			ToolTip = "With stereo rendering, reproject the primary eye's upscaled output into the secondary eye "
+					  "instead of running the network for the secondary eye on every frame."))
+	bool bNSSXRCrossEyeReuse;
+
+	UPROPERTY(Config,
+		EditAnywhere,
+		Category = "NSS|Quality",
+		meta = (ConsoleVariable = "r.NSS.QualityMode",
+			DisplayName = "Quality Mode",
+			ToolTip = "The render resolution NSS upscales from, as a fraction of the output resolution. Custom leaves "
+					  "it to r.ScreenPercentage."))
+	ENSSQualityMode NSSQualityMode;
+
+	UPROPERTY(Config,
+		EditAnywhere,
+		Category = "NSS|Quality",
+		meta = (ConsoleVariable = "r.NSS.Governor.Enable",
+			DisplayName = "GPU Budget Governor",
+			ToolTip = "Lower the render resolution below the quality mode's while the GPU frame time is over budget."))
+	bool bNSSGovernorEnabled;
+
+	UPROPERTY(Config,
+		EditAnywhere,
+		Category = "NSS|Quality",
+		meta = (ConsoleVariable = "r.NSS.Governor.BudgetMs",
+			DisplayName = "GPU Budget (ms)",
+			ClampMin = "1.0",
+			EditCondition = "bNSSGovernorEnabled"))
+	float NSSGovernorBudgetMs;
+
+	// Usually enabled for the platforms whose devices can't be known ahead of time, in their Engine.ini or in a
+	// device profile.
+	UPROPERTY(Config,
+		EditAnywhere,
+		Category = "NSS|Quality",
+		meta = (ConsoleVariable = "r.NSS.Calibration",
+			DisplayName = "Device Calibration",
+			ClampMin = "0",
+			ClampMax = "2",
+			ToolTip = "Pick the quality mode by timing NSS on the first launch on each GPU and driver (0 = off, "
+					  "1 = once per GPU and driver, 2 = on every launch)."))
+	int32 NSSCalibration;
+
+	UPROPERTY(Config,
+		EditAnywhere,
+		Category = "NSS|Quality",
+		meta = (ConsoleVariable = "r.NSS.Calibration.TargetMs",
+			DisplayName = "Calibration Target (ms)",
+			ClampMin = "0.1",
+			ToolTip = "The GPU time NSS may take per frame at the quality mode calibration picks."))
+	float NSSCalibrationTargetMs;
+
+	UPROPERTY(Config,
+		EditAnywhere,
+		Category = "NSS|Power",
+		meta = (ConsoleVariable = "r.NSS.StaticFrameSkip",
+			DisplayName = "Skip Static Frames",
+			ToolTip = "Reuse the upscaled output instead of running the network while the game is paused and the "
+					  "camera is still, e.g. in pause menus."))
+	bool bNSSStaticFrameSkip;
+
+	UPROPERTY(Config,
+		EditAnywhere,
+		Category = "NSS|Power",
+		meta = (ConsoleVariable = "r.NSS.StaticFrameSkip.MaxReuseFrames",
+			DisplayName = "Max Reused Frames",
+			ClampMin = "0",
+			ToolTip = "Most consecutive frames the upscaled output is reused for before the network runs again.",
+			EditCondition = "bNSSStaticFrameSkip"))
+	int32 NSSStaticFrameSkipMaxReuseFrames;
 };
 
 class NGSettingsModule final : public IModuleInterface
@@ -0,0 +1,22 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "HAL/Platform.h"
+
+#if PLATFORM_WINDOWS
+#include "Windows/AllowWindowsPlatformTypes.h"
+#else
+#define FFX_GCC
+#endif
+THIRD_PARTY_INCLUDES_START
+
+#include "ffx_nss.h"
+
+THIRD_PARTY_INCLUDES_END
+#if PLATFORM_WINDOWS
+#include "Windows/HideWindowsPlatformTypes.h"
+#else
+#undef FFX_GCC
+#endif
@@ -0,0 +1,640 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#include "NGSharedTrace.h"
+
+#include "Algo/StableSort.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTLS.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+#include "NGSharedNssIncludes.h"
+#include "Serialization/MemoryWriter.h"
+
+#include <atomic>
+
+DEFINE_LOG_CATEGORY_STATIC(LogNGSharedTrace, Log, All);
+
+namespace
+{
+	constexpr uint32 TraceMagic = 0x5254474E; // 'NGTR'
+	constexpr uint32 TraceVersion = 1;
+	// Guards against malformed chains looping back on themselves.
+	constexpr int32 MaxChainLength = 16;
+
+	// The size of the descriptors whose layout the trace knows, 0 for the others.
+	uint32 GetDescSize(uint64 Type)
+	{
+		switch (Type)
+		{
+		case FFX_API_CREATE_CONTEXT_DESC_TYPE_NSS:
+			return sizeof(ffxApiCreateContextDescNss);
+		case FFX_API_DISPATCH_DESC_TYPE_NSS:
+			return sizeof(ffxApiDispatchDescNss);
+		case FFX_API_QUERY_DESC_TYPE_NSS_GPU_MEMORY_USAGE:
+			return sizeof(ffxQueryDescNssGetGPUMemoryUsage);
+		case FFX_API_QUERY_DESC_TYPE_NSS_GPU_TIMINGS:
+			return sizeof(ffxQueryDescNssGetGPUTimings);
+		default:
+			return 0;
+		}
+	}
+
+	void SerializeEvent(FArchive& Ar, NGSharedTraceEvent& Event)
+	{
+		uint8 Call = uint8(Event.Call);
+		Ar << Call;
+		Event.Call = ENGSharedTraceCall(FMath::Min(Call, uint8(ENGSharedTraceCall::Num)));
+		Ar << Event.ThreadId;
+		Ar << Event.StartSeconds;
+		Ar << Event.DurationSeconds;
+		Ar << Event.ContextId;
+		uint32 ReturnCode = uint32(Event.ReturnCode);
+		Ar << ReturnCode;
+		Event.ReturnCode = ffxReturnCode_t(ReturnCode);
+		int32 NumDescs = Event.Descs.Num();
+		Ar << NumDescs;
+		if (Ar.IsLoading())
+		{
+			if (NumDescs < 0 || NumDescs > MaxChainLength)
+			{
+				Ar.SetError();
+				return;
+			}
+			Event.Descs.SetNum(NumDescs);
+		}
+		for (NGSharedTraceDesc& Desc : Event.Descs)
+		{
+			Ar << Desc.Type;
+			Ar << Desc.Bytes;
+		}
+	}
+
+	//-------------------------------------------------------------------------------------
+	// The trace being recorded. Calls can come from the render and RHI threads, so everything but the check of
+	// whether a trace is running is done under a lock.
+	//-------------------------------------------------------------------------------------
+	class NGSharedTraceRecorder
+	{
+	public:
+		bool IsRecording() const
+		{
+			return bRecording.load(std::memory_order_relaxed);
+		}
+
+		bool Start(const FString& InPath)
+		{
+			FScopeLock Lock(&Mutex);
+			if (bRecording)
+			{
+				UE_LOG(LogNGSharedTrace, Warning, TEXT("A trace is already being recorded to %s"), *Path);
+				return false;
+			}
+			Path = InPath;
+			Buffer.Reset();
+			NumEvents = 0;
+			Api = EFFXBackendAPI::Unknown;
+			ContextIds.Reset();
+			NextContextId = 1;
+			StartSeconds = FPlatformTime::Seconds();
+			bRecording = true;
+			return true;
+		}
+
+		bool Stop()
+		{
+			FScopeLock Lock(&Mutex);
+			if (!bRecording)
+			{
+				return false;
+			}
+			bRecording = false;
+
+			TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*Path));
+			if (!Writer)
+			{
+				UE_LOG(LogNGSharedTrace, Error, TEXT("Couldn't write the trace to %s"), *Path);
+				return false;
+			}
+			uint32 Magic = TraceMagic;
+			uint32 Version = TraceVersion;
+			uint8 ApiValue = uint8(Api);
+			*Writer << Magic << Version << ApiValue << NumEvents;
+			Writer->Serialize(Buffer.GetData(), Buffer.Num());
+			const bool bOk = Writer->Close();
+			UE_LOG(LogNGSharedTrace, Log, TEXT("Wrote %d calls to %s"), NumEvents, *Path);
+			Buffer.Empty();
+			ContextIds.Empty();
+			return bOk;
+		}
+
+		int32 GetNumEvents()
+		{
+			FScopeLock Lock(&Mutex);
+			return NumEvents;
+		}
+
+		// Captures a call's descriptors before it is made, as backends may append their own to the chain.
+		NGSharedTraceEvent BeginEvent(ENGSharedTraceCall Call, ffxContext* Context, const ffxApiHeader* Desc)
+		{
+			NGSharedTraceEvent Event;
+			Event.Call = Call;
+			Event.ThreadId = FPlatformTLS::GetCurrentThreadId();
+			for (int32 Link = 0; Desc && Link < MaxChainLength; Link++, Desc = Desc->pNext)
+			{
+				NGSharedTraceDesc& Recorded = Event.Descs.AddDefaulted_GetRef();
+				Recorded.Type = Desc->type;
+				const uint32 Size = GetDescSize(Desc->type);
+				Recorded.Bytes.Append(reinterpret_cast<const uint8*>(Desc), Size);
+			}
+			if (Call != ENGSharedTraceCall::CreateContext && Context && *Context)
+			{
+				FScopeLock Lock(&Mutex);
+				Event.ContextId = GetContextId(*Context);
+			}
+			return Event;
+		}
+
+		// Handle is the context created, or the one destroyed.
+		void EndEvent(NGSharedTraceEvent&& Event,
+			EFFXBackendAPI CallApi,
+			double CallStartSeconds,
+			double CallEndSeconds,
+			ffxReturnCode_t ReturnCode,
+			ffxContext Handle)
+		{
+			FScopeLock Lock(&Mutex);
+			if (!bRecording)
+			{
+				return;
+			}
+			if (Handle && ReturnCode == FFX_API_RETURN_OK)
+			{
+				if (Event.Call == ENGSharedTraceCall::CreateContext)
+				{
+					Event.ContextId = GetContextId(Handle);
+				}
+				else if (Event.Call == ENGSharedTraceCall::DestroyContext)
+				{
+					ContextIds.Remove(Handle);
+				}
+			}
+			Event.StartSeconds = CallStartSeconds - StartSeconds;
+			Event.DurationSeconds = CallEndSeconds - CallStartSeconds;
+			Event.ReturnCode = ReturnCode;
+			Api = Api == EFFXBackendAPI::Unknown ? CallApi : Api;
+
+			FMemoryWriter Writer(Buffer, false, true);
+			SerializeEvent(Writer, Event);
+			NumEvents++;
+		}
+
+	private:
+		// Contexts seen for the first time get the next id, including those created before the trace started,
+		// which the replay has no way to recreate.
+		uint32 GetContextId(ffxContext Context)
+		{
+			if (const uint32* Id = ContextIds.Find(Context))
+			{
+				return *Id;
+			}
+			return ContextIds.Add(Context, NextContextId++);
+		}
+
+		FCriticalSection Mutex;
+		std::atomic<bool> bRecording = false;
+		FString Path;
+		TArray<uint8> Buffer;
+		int32 NumEvents = 0;
+		EFFXBackendAPI Api = EFFXBackendAPI::Unknown;
+		TMap<ffxContext, uint32> ContextIds;
+		uint32 NextContextId = 1;
+		double StartSeconds = 0.0;
+	};
+
+	NGSharedTraceRecorder GRecorder;
+
+	//-------------------------------------------------------------------------------------
+	// Forwards everything to the backend it wraps, recording the ffx calls while a trace is running.
+	//-------------------------------------------------------------------------------------
+	class NGSharedTracingBackend final : public INGSharedBackend
+	{
+	public:
+		explicit NGSharedTracingBackend(INGSharedBackend& InInner) : Inner(InInner)
+		{}
+
+		ffxReturnCode_t ffxCreateContext(ffxContext* context, ffxCreateContextDescHeader* desc) final
+		{
+			if (!GRecorder.IsRecording())
+			{
+				return Inner.ffxCreateContext(context, desc);
+			}
+			NGSharedTraceEvent Event = GRecorder.BeginEvent(ENGSharedTraceCall::CreateContext, context, desc);
+			const double StartSeconds = FPlatformTime::Seconds();
+			const ffxReturnCode_t ReturnCode = Inner.ffxCreateContext(context, desc);
+			GRecorder.EndEvent(MoveTemp(Event),
+				Inner.GetAPI(),
+				StartSeconds,
+				FPlatformTime::Seconds(),
+				ReturnCode,
+				context ? *context : nullptr);
+			return ReturnCode;
+		}
+
+		ffxReturnCode_t ffxDestroyContext(ffxContext* context) final
+		{
+			if (!GRecorder.IsRecording())
+			{
+				return Inner.ffxDestroyContext(context);
+			}
+			const ffxContext Handle = context ? *context : nullptr;
+			NGSharedTraceEvent Event = GRecorder.BeginEvent(ENGSharedTraceCall::DestroyContext, context, nullptr);
+			const double StartSeconds = FPlatformTime::Seconds();
+			const ffxReturnCode_t ReturnCode = Inner.ffxDestroyContext(context);
+			GRecorder.EndEvent(
+				MoveTemp(Event), Inner.GetAPI(), StartSeconds, FPlatformTime::Seconds(), ReturnCode, Handle);
+			return ReturnCode;
+		}
+
+		ffxReturnCode_t ffxConfigure(ffxContext* context, const ffxConfigureDescHeader* desc) final
+		{
+			if (!GRecorder.IsRecording())
+			{
+				return Inner.ffxConfigure(context, desc);
+			}
+			NGSharedTraceEvent Event = GRecorder.BeginEvent(ENGSharedTraceCall::Configure, context, desc);
+			const double StartSeconds = FPlatformTime::Seconds();
+			const ffxReturnCode_t ReturnCode = Inner.ffxConfigure(context, desc);
+			GRecorder.EndEvent(
+				MoveTemp(Event), Inner.GetAPI(), StartSeconds, FPlatformTime::Seconds(), ReturnCode, nullptr);
+			return ReturnCode;
+		}
+
+		ffxReturnCode_t ffxQuery(ffxContext* context, ffxQueryDescHeader* desc) final
+		{
+			if (!GRecorder.IsRecording())
+			{
+				return Inner.ffxQuery(context, desc);
+			}
+			NGSharedTraceEvent Event = GRecorder.BeginEvent(ENGSharedTraceCall::Query, context, desc);
+			const double StartSeconds = FPlatformTime::Seconds();
+			const ffxReturnCode_t ReturnCode = Inner.ffxQuery(context, desc);
+			GRecorder.EndEvent(
+				MoveTemp(Event), Inner.GetAPI(), StartSeconds, FPlatformTime::Seconds(), ReturnCode, nullptr);
+			return ReturnCode;
+		}
+
+		ffxReturnCode_t ffxDispatch(ffxContext* context, const ffxDispatchDescHeader* desc) final
+		{
+			if (!GRecorder.IsRecording())
+			{
+				return Inner.ffxDispatch(context, desc);
+			}
+			NGSharedTraceEvent Event = GRecorder.BeginEvent(ENGSharedTraceCall::Dispatch, context, desc);
+			const double StartSeconds = FPlatformTime::Seconds();
+			const ffxReturnCode_t ReturnCode = Inner.ffxDispatch(context, desc);
+			GRecorder.EndEvent(
+				MoveTemp(Event), Inner.GetAPI(), StartSeconds, FPlatformTime::Seconds(), ReturnCode, nullptr);
+			return ReturnCode;
+		}
+
+		ffxReturnCode_t ffxDispatchBatch(TConstArrayView<NGSharedBatchedDispatch> Dispatches) final
+		{
+			if (!GRecorder.IsRecording())
+			{
+				return Inner.ffxDispatchBatch(Dispatches);
+			}
+			// Recorded as the dispatches they are made of, which is what a replay re-issues.
+			return INGSharedBackend::ffxDispatchBatch(Dispatches);
+		}
+
+		EFFXBackendAPI GetAPI() const final
+		{
+			return Inner.GetAPI();
+		}
+
+		FfxApiResource GetNativeResource(FRHITexture* Texture, FfxApiResourceState State) final
+		{
+			return Inner.GetNativeResource(Texture, State);
+		}
+
+		FfxApiResource GetNativeResource(FRDGTexture* Texture, FfxApiResourceState State) final
+		{
+			return Inner.GetNativeResource(Texture, State);
+		}
+
+		FfxCommandList GetNativeCommandBuffer(FRHICommandListImmediate& RHICmdList, FRHITexture* Texture) final
+		{
+			return Inner.GetNativeCommandBuffer(RHICmdList, Texture);
+		}
+
+		void EnqueueNativeCommands(
+			FRHICommandListImmediate& RHICmdList, TUniqueFunction<void(FfxCommandList)>&& Commands) final
+		{
+			Inner.EnqueueNativeCommands(RHICmdList, MoveTemp(Commands));
+		}
+
+		bool IsNeuralGraphicSupported() final
+		{
+			return Inner.IsNeuralGraphicSupported();
+		}
+
+		bool IsLoaded() final
+		{
+			return Inner.IsLoaded();
+		}
+
+		void ForceUAVTransition(
+			FRHICommandListImmediate& RHICmdList, FRHITexture* OutputTexture, ERHIAccess Access) final
+		{
+			Inner.ForceUAVTransition(RHICmdList, OutputTexture, Access);
+		}
+
+		bool GetDispatchTimings(ffxContext* context, NGSharedDispatchTimings& OutTimings) final
+		{
+			return Inner.GetDispatchTimings(context, OutTimings);
+		}
+
+	private:
+		INGSharedBackend& Inner;
+	};
+
+	// Rebuilds a recorded chain, leaving out the descriptors that weren't recorded in full. Those are specific to the
+	// recording backend, which the replaying backend adds its own equivalents of.
+	ffxApiHeader* BuildChain(const NGSharedTraceEvent& Event, TArray<TArray<uint8>>& OutStorage)
+	{
+		ffxApiHeader* Root = nullptr;
+		ffxApiHeader* Last = nullptr;
+		for (const NGSharedTraceDesc& Desc : Event.Descs)
+		{
+			if (Desc.Bytes.Num() < int32(sizeof(ffxApiHeader)) || Desc.Bytes.Num() != int32(GetDescSize(Desc.Type)))
+			{
+				if (!Root)
+				{
+					return nullptr;
+				}
+				continue;
+			}
+			TArray<uint8>& Storage = OutStorage.Add_GetRef(Desc.Bytes);
+			ffxApiHeader* Header = reinterpret_cast<ffxApiHeader*>(Storage.GetData());
+			Header->pNext = nullptr;
+			if (Last)
+			{
+				Last->pNext = Header;
+			}
+			Root = Root ? Root : Header;
+			Last = Header;
+		}
+		return Root;
+	}
+
+	void ClearResource(FfxApiResource& Resource)
+	{
+		Resource.resource = nullptr;
+	}
+}
+
+bool LoadNGSharedTrace(const FString& Path, NGSharedTraceFile& OutTrace, FString& OutError)
+{
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*Path));
+	if (!Reader)
+	{
+		OutError = FString::Printf(TEXT("Couldn't open %s"), *Path);
+		return false;
+	}
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	uint8 Api = 0;
+	int32 NumEvents = 0;
+	*Reader << Magic << Version << Api << NumEvents;
+	if (Magic != TraceMagic || Version != TraceVersion || NumEvents < 0)
+	{
+		OutError = FString::Printf(TEXT("%s isn't a version %u trace"), *Path, TraceVersion);
+		return false;
+	}
+	OutTrace.Api = EFFXBackendAPI(FMath::Min(Api, uint8(EFFXBackendAPI::Unknown)));
+	OutTrace.Events.Reset();
+	for (int32 Index = 0; Index < NumEvents && !Reader->IsError(); Index++)
+	{
+		SerializeEvent(*Reader, OutTrace.Events.AddDefaulted_GetRef());
+	}
+	if (Reader->IsError())
+	{
+		OutError = FString::Printf(TEXT("%s is truncated or corrupt"), *Path);
+		return false;
+	}
+	return true;
+}
+
+const TCHAR* GetNGSharedTraceCallName(ENGSharedTraceCall Call)
+{
+	switch (Call)
+	{
+	case ENGSharedTraceCall::CreateContext:
+		return TEXT("ffxCreateContext");
+	case ENGSharedTraceCall::DestroyContext:
+		return TEXT("ffxDestroyContext");
+	case ENGSharedTraceCall::Configure:
+		return TEXT("ffxConfigure");
+	case ENGSharedTraceCall::Query:
+		return TEXT("ffxQuery");
+	case ENGSharedTraceCall::Dispatch:
+		return TEXT("ffxDispatch");
+	default:
+		return TEXT("Unknown");
+	}
+}
+
+//-------------------------------------------------------------------------------------
+// Recording
+//-------------------------------------------------------------------------------------
+INGSharedBackend* NGSharedTrace::Wrap(INGSharedBackend* Backend)
+{
+	static FCriticalSection Mutex;
+	static TMap<INGSharedBackend*, TUniquePtr<NGSharedTracingBackend>> Wrappers;
+	if (!Backend)
+	{
+		return nullptr;
+	}
+	FScopeLock Lock(&Mutex);
+	TUniquePtr<NGSharedTracingBackend>& Wrapper = Wrappers.FindOrAdd(Backend);
+	if (!Wrapper)
+	{
+		Wrapper = MakeUnique<NGSharedTracingBackend>(*Backend);
+	}
+	return Wrapper.Get();
+}
+
+bool NGSharedTrace::Start(const FString& Path)
+{
+	return GRecorder.Start(Path);
+}
+
+bool NGSharedTrace::Stop()
+{
+	return GRecorder.Stop();
+}
+
+bool NGSharedTrace::IsRecording()
+{
+	return GRecorder.IsRecording();
+}
+
+int32 NGSharedTrace::GetNumEvents()
+{
+	return GRecorder.GetNumEvents();
+}
+
+//-------------------------------------------------------------------------------------
+// Replay
+//-------------------------------------------------------------------------------------
+NGSharedTraceReplayResults NGSharedTraceReplayer::Replay(const NGSharedTraceFile& Trace, bool bPreserveTiming)
+{
+	NGSharedTraceReplayResults Results;
+	TArray<const NGSharedTraceEvent*> Events;
+	Events.Reserve(Trace.Events.Num());
+	for (const NGSharedTraceEvent& Event : Trace.Events)
+	{
+		if (Event.Call < ENGSharedTraceCall::Num)
+		{
+			Events.Add(&Event);
+		}
+	}
+	// Events are written when calls end, so calls that overlapped on different threads can be out of order.
+	Algo::StableSortBy(Events, [](const NGSharedTraceEvent* Event) { return Event->StartSeconds; });
+
+	TMap<uint32, ffxContext> Contexts;
+	TArray<TArray<uint8>> ChainStorage;
+	const double ReplayStartSeconds = FPlatformTime::Seconds();
+	for (const NGSharedTraceEvent* Event : Events)
+	{
+		NGSharedTraceCallStats& Stats = Results.Calls[int32(Event->Call)];
+		Stats.RecordedTotalSeconds += Event->DurationSeconds;
+		if (bPreserveTiming)
+		{
+			const double WaitSeconds = Event->StartSeconds - (FPlatformTime::Seconds() - ReplayStartSeconds);
+			if (WaitSeconds > 0.0)
+			{
+				FPlatformProcess::SleepNoStats(float(WaitSeconds));
+			}
+		}
+
+		ChainStorage.Reset();
+		ffxApiHeader* Desc = BuildChain(*Event, ChainStorage);
+		ffxContext* Context = Contexts.Find(Event->ContextId);
+		ffxContext NewContext = nullptr;
+		if (Event->Call == ENGSharedTraceCall::CreateContext)
+		{
+			Context = &NewContext;
+		}
+		if (!Context || (!Desc && Event->Call != ENGSharedTraceCall::DestroyContext))
+		{
+			Stats.Skipped++;
+			continue;
+		}
+
+		if (Desc && Desc->type == FFX_API_CREATE_CONTEXT_DESC_TYPE_NSS)
+		{
+			// The message callback was an address in the recording process.
+			reinterpret_cast<ffxApiCreateContextDescNss*>(Desc)->fpMessage = nullptr;
+		}
+		else if (Desc && Desc->type == FFX_API_DISPATCH_DESC_TYPE_NSS)
+		{
+			ffxApiDispatchDescNss& Dispatch = *reinterpret_cast<ffxApiDispatchDescNss*>(Desc);
+			Dispatch.commandList = nullptr;
+			ClearResource(Dispatch.color);
+			ClearResource(Dispatch.depth);
+			ClearResource(Dispatch.depthTm1);
+			ClearResource(Dispatch.motionVectors);
+			ClearResource(Dispatch.exposure);
+			ClearResource(Dispatch.outputTm1);
+			ClearResource(Dispatch.output);
+			ClearResource(Dispatch.debugViews);
+			if (ResolveDispatch)
+			{
+				ResolveDispatch(*Desc);
+			}
+		}
+
+		ffxReturnCode_t ReturnCode = FFX_API_RETURN_OK;
+		const double StartSeconds = FPlatformTime::Seconds();
+		switch (Event->Call)
+		{
+		case ENGSharedTraceCall::CreateContext:
+			ReturnCode = Backend.ffxCreateContext(Context, Desc);
+			break;
+		case ENGSharedTraceCall::DestroyContext:
+			ReturnCode = Backend.ffxDestroyContext(Context);
+			break;
+		case ENGSharedTraceCall::Configure:
+			ReturnCode = Backend.ffxConfigure(Context, Desc);
+			break;
+		case ENGSharedTraceCall::Query:
+			ReturnCode = Backend.ffxQuery(Context, Desc);
+			break;
+		case ENGSharedTraceCall::Dispatch:
+			ReturnCode = Backend.ffxDispatch(Context, Desc);
+			break;
+		default:
+			break;
+		}
+		const double Seconds = FPlatformTime::Seconds() - StartSeconds;
+
+		Stats.Calls++;
+		Stats.Failures += ReturnCode != FFX_API_RETURN_OK ? 1 : 0;
+		Stats.TotalSeconds += Seconds;
+		Stats.MaxSeconds = FMath::Max(Stats.MaxSeconds, Seconds);
+		Results.Mismatches += ReturnCode != Event->ReturnCode ? 1 : 0;
+
+		if (Event->Call == ENGSharedTraceCall::CreateContext && ReturnCode == FFX_API_RETURN_OK)
+		{
+			if (Event->ContextId != 0)
+			{
+				Contexts.Add(Event->ContextId, NewContext);
+				Results.PeakLiveContexts = FMath::Max(Results.PeakLiveContexts, Contexts.Num());
+			}
+			else
+			{
+				// Nothing in the trace refers to a context whose creation failed when recorded.
+				Backend.ffxDestroyContext(&NewContext);
+			}
+		}
+		else if (Event->Call == ENGSharedTraceCall::DestroyContext && ReturnCode == FFX_API_RETURN_OK)
+		{
+			Contexts.Remove(Event->ContextId);
+		}
+	}
+	Results.WallSeconds = FPlatformTime::Seconds() - ReplayStartSeconds;
+
+	for (TPair<uint32, ffxContext>& Context : Contexts)
+	{
+		Backend.ffxDestroyContext(&Context.Value);
+	}
+	return Results;
+}
+
+FString NGSharedTraceReplayResults::ToJson() const
+{
+	FString Json = TEXT("{\n");
+	Json += FString::Printf(TEXT("\t\"wallSeconds\": %.6f,\n"), WallSeconds);
+	Json += FString::Printf(TEXT("\t\"mismatches\": %d,\n"), Mismatches);
+	Json += FString::Printf(TEXT("\t\"peakLiveContexts\": %d,\n"), PeakLiveContexts);
+	Json += TEXT("\t\"calls\": {\n");
+	for (int32 Call = 0; Call < int32(ENGSharedTraceCall::Num); Call++)
+	{
+		const NGSharedTraceCallStats& Stats = Calls[Call];
+		Json += FString::Printf(TEXT("\t\t\"%s\": {\"calls\": %d, \"failures\": %d, \"skipped\": %d, "
+									 "\"totalMs\": %.4f, \"maxMs\": %.4f, \"recordedTotalMs\": %.4f}%s\n"),
+			GetNGSharedTraceCallName(ENGSharedTraceCall(Call)),
+			Stats.Calls,
+			Stats.Failures,
+			Stats.Skipped,
+			Stats.TotalSeconds * 1000.0,
+			Stats.MaxSeconds * 1000.0,
+			Stats.RecordedTotalSeconds * 1000.0,
+			Call + 1 < int32(ENGSharedTraceCall::Num) ? TEXT(",") : TEXT(""));
+	}
+	Json += TEXT("\t}\n}\n");
+	return Json;
+}
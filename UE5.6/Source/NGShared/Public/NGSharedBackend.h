@@ -27,6 +27,7 @@
 #include "Modules/ModuleManager.h"
 #include "NGShared.h"
 #include "RHIFwd.h"
+#include "Templates/Function.h"
 
 class FRDGTexture;
 enum EPixelFormat : uint8;
@@ -35,6 +36,8 @@ enum class ERHIAccess : uint32;
 enum class EFFXBackendAPI : uint8
 {
 	Vulkan,
+	// The CPU reference backend, for headless runs (e.g. -nullrhi).
+	CPU,
 	Unsupported,
 	Unknown
 };
@@ -61,6 +64,48 @@ struct NGSharedAllocCallbacks
 	}
 };
 
+//-------------------------------------------------------------------------------------
+// ffxQuery extension reporting the GPU memory a context has allocated for its internal resources.
+// Backends and SDK versions that don't support it return FFX_API_RETURN_ERROR_UNKNOWN_DESCTYPE.
+//-------------------------------------------------------------------------------------
+#define FFX_API_QUERY_DESC_TYPE_NSS_GPU_MEMORY_USAGE 0x41524D01u
+struct ffxQueryDescNssGetGPUMemoryUsage
+{
+	ffxQueryDescHeader header;
+	uint64_t totalUsageInBytes;
+	// The part of totalUsageInBytes that is scratch memory, only needed during a dispatch.
+	uint64_t scratchUsageInBytes;
+};
+
+//-------------------------------------------------------------------------------------
+// ffxQuery extension reporting the GPU time of the stages of a context's most recent dispatch that the GPU has
+// finished, measured by the SDK with timestamp queries around each stage.
+// Backends and SDK versions that don't support it return FFX_API_RETURN_ERROR_UNKNOWN_DESCTYPE.
+//-------------------------------------------------------------------------------------
+#define FFX_API_QUERY_DESC_TYPE_NSS_GPU_TIMINGS 0x41524D02u
+struct ffxQueryDescNssGetGPUTimings
+{
+	ffxQueryDescHeader header;
+	uint64_t inputPreparationInMicroseconds;
+	uint64_t inferenceInMicroseconds;
+	uint64_t outputResolveInMicroseconds;
+};
+
+// GPU time of the stages of an SDK dispatch.
+struct NGSharedDispatchTimings
+{
+	uint64 InputPreparationMicroseconds = 0;
+	uint64 InferenceMicroseconds = 0;
+	uint64 OutputResolveMicroseconds = 0;
+};
+
+// One of the dispatches of INGSharedBackend::ffxDispatchBatch.
+struct NGSharedBatchedDispatch
+{
+	ffxContext* Context = nullptr;
+	const ffxDispatchDescHeader* Desc = nullptr;
+};
+
 class FRDGBuilder;
 
 class INGSharedBackend
@@ -71,15 +116,38 @@ public:
 	virtual ffxReturnCode_t ffxConfigure(ffxContext* context, const ffxConfigureDescHeader* desc) = 0;
 	virtual ffxReturnCode_t ffxQuery(ffxContext* context, ffxQueryDescHeader* desc) = 0;
 	virtual ffxReturnCode_t ffxDispatch(ffxContext* context, const ffxDispatchDescHeader* desc) = 0;
+	// Dispatches several contexts together, e.g. the views of a frame, in order on the command lists of their
+	// descriptors. Every dispatch is attempted and the first failure is returned. Backends that can share the
+	// per-dispatch work between contexts override it, by default the contexts are dispatched one at a time.
+	virtual ffxReturnCode_t ffxDispatchBatch(TConstArrayView<NGSharedBatchedDispatch> Dispatches)
+	{
+		ffxReturnCode_t Result = FFX_API_RETURN_OK;
+		for (const NGSharedBatchedDispatch& Dispatch : Dispatches)
+		{
+			const ffxReturnCode_t Code = ffxDispatch(Dispatch.Context, Dispatch.Desc);
+			if (Result == FFX_API_RETURN_OK)
+			{
+				Result = Code;
+			}
+		}
+		return Result;
+	}
 
 	virtual EFFXBackendAPI GetAPI() const = 0;
 	virtual FfxApiResource GetNativeResource(FRHITexture* Texture, FfxApiResourceState State) = 0;
 	virtual FfxApiResource GetNativeResource(FRDGTexture* Texture, FfxApiResourceState State) = 0;
 	virtual FfxCommandList GetNativeCommandBuffer(FRHICommandListImmediate& RHICmdList, FRHITexture* Texture) = 0;
+	// Records Commands at this point of RHICmdList, to be run with the native command buffer when the list is
+	// translated, so that work recorded by the SDK is ordered with the surrounding RHI commands without flushing.
+	virtual void EnqueueNativeCommands(
+		FRHICommandListImmediate& RHICmdList, TUniqueFunction<void(FfxCommandList)>&& Commands) = 0;
 	virtual bool IsNeuralGraphicSupported() = 0;
 	virtual bool IsLoaded() = 0;
 	virtual void ForceUAVTransition(
 		FRHICommandListImmediate& RHICmdList, FRHITexture* OutputTexture, ERHIAccess Access) = 0;
+	// Returns the stage timings of the most recent dispatch of context the GPU has finished, or false if the backend
+	// can't time dispatches.
+	virtual bool GetDispatchTimings(ffxContext* context, NGSharedDispatchTimings& OutTimings) = 0;
 };
 
 class INGSharedBackendModule : public IModuleInterface
@@ -0,0 +1,113 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NGSharedBackend.h"
+
+enum class ENGSharedTraceCall : uint8
+{
+	CreateContext,
+	DestroyContext,
+	Configure,
+	Query,
+	Dispatch,
+	Num
+};
+
+// A descriptor of a call's chain. Bytes is empty for the types the trace doesn't know the layout of, which are
+// recorded by type only.
+struct NGSharedTraceDesc
+{
+	uint64 Type = 0;
+	TArray<uint8> Bytes;
+};
+
+// A call made through a traced backend.
+struct NGSharedTraceEvent
+{
+	ENGSharedTraceCall Call = ENGSharedTraceCall::Num;
+	uint32 ThreadId = 0;
+	// Relative to the start of the trace.
+	double StartSeconds = 0.0;
+	double DurationSeconds = 0.0;
+	// Contexts are numbered from 1 in the order they are created, 0 for a call without one.
+	uint32 ContextId = 0;
+	ffxReturnCode_t ReturnCode = FFX_API_RETURN_OK;
+	// The descriptor chain, from the header passed in along pNext.
+	TArray<NGSharedTraceDesc> Descs;
+};
+
+struct NGSharedTraceFile
+{
+	EFFXBackendAPI Api = EFFXBackendAPI::Unknown;
+	TArray<NGSharedTraceEvent> Events;
+};
+
+NGSHARED_API bool LoadNGSharedTrace(const FString& Path, NGSharedTraceFile& OutTrace, FString& OutError);
+NGSHARED_API const TCHAR* GetNGSharedTraceCallName(ENGSharedTraceCall Call);
+
+//-------------------------------------------------------------------------------------
+// Records every ffx call made through the backends it wraps, with its descriptor chain, timing and thread, to a
+// binary trace that NGSharedTraceReplayer can re-issue. Wrapped backends only pay for an atomic load per call while
+// no trace is being recorded. Events are kept in memory and written out when the trace is stopped.
+//-------------------------------------------------------------------------------------
+class NGSHARED_API NGSharedTrace
+{
+public:
+	// Returns the backend to use in place of Backend, which records its calls whenever a trace is running. There
+	// is one wrapper per backend, which lives for the rest of the run, as Backend has to.
+	static INGSharedBackend* Wrap(INGSharedBackend* Backend);
+
+	static bool Start(const FString& Path);
+	// Writes the trace out, returning false if nothing was recording or the file couldn't be written.
+	static bool Stop();
+	static bool IsRecording();
+	static int32 GetNumEvents();
+};
+
+// The replayed cost of a kind of call, against what it cost when it was recorded.
+struct NGSharedTraceCallStats
+{
+	int32 Calls = 0;
+	int32 Failures = 0;
+	// Calls that weren't replayed because their descriptors can't be reproduced from the trace.
+	int32 Skipped = 0;
+	double TotalSeconds = 0.0;
+	double MaxSeconds = 0.0;
+	double RecordedTotalSeconds = 0.0;
+};
+
+struct NGSHARED_API NGSharedTraceReplayResults
+{
+	NGSharedTraceCallStats Calls[int32(ENGSharedTraceCall::Num)];
+	// Calls whose result differs from the recorded one.
+	int32 Mismatches = 0;
+	int32 PeakLiveContexts = 0;
+	double WallSeconds = 0.0;
+
+	FString ToJson() const;
+};
+
+//-------------------------------------------------------------------------------------
+// Re-issues the calls of a trace, in the order they started, against any backend. The resources and command list
+// of recorded dispatches only meant something in the recording process, so they are cleared before the call unless
+// ResolveDispatch fills them in: backends that only validate such dispatches, like the CPU backend, can replay any
+// trace, while a GPU backend needs real resources. Contexts left alive by the trace are destroyed at the end.
+//-------------------------------------------------------------------------------------
+class NGSHARED_API NGSharedTraceReplayer
+{
+public:
+	explicit NGSharedTraceReplayer(INGSharedBackend& InBackend) : Backend(InBackend)
+	{}
+
+	// Given the dispatch descriptor with its resources cleared.
+	TFunction<void(ffxDispatchDescHeader& Desc)> ResolveDispatch;
+
+	// With bPreserveTiming the calls are issued at their recorded times, to reproduce the pacing of context churn.
+	NGSharedTraceReplayResults Replay(const NGSharedTraceFile& Trace, bool bPreserveTiming = false);
+
+private:
+	INGSharedBackend& Backend;
+};
@@ -218,6 +218,16 @@ public:
 		return GetIVulkanDynamicRHI()->RHIGetActiveVkCommandBuffer();
 	}
 
+	void EnqueueNativeCommands(
+		FRHICommandListImmediate& RHICmdList, TUniqueFunction<void(FfxCommandList)>&& Commands) final
+	{
+		// The lambda runs on the RHI thread when it gets to this command, while the immediate context is recording
+		// the surrounding commands into its active command buffer.
+		RHICmdList.EnqueueLambda(
+			[this, Commands = MoveTemp(Commands)](FRHICommandListImmediate& ExecutingCmdList) mutable
+			{ Commands(GetNativeCommandBuffer(ExecutingCmdList, nullptr)); });
+	}
+
 	bool IsNeuralGraphicSupported()
 	{
 		static bool tensorSupported = false;
@@ -255,6 +265,21 @@ public:
 		RHICmdList.Transition(Info);
 	}
 
+	bool GetDispatchTimings(ffxContext* context, NGSharedDispatchTimings& OutTimings) final
+	{
+		ffxQueryDescNssGetGPUTimings Query;
+		FMemory::Memzero(Query);
+		Query.header.type = FFX_API_QUERY_DESC_TYPE_NSS_GPU_TIMINGS;
+		if (FfxFunctions.Query(context, &Query.header) != FFX_OK)
+		{
+			return false;
+		}
+		OutTimings.InputPreparationMicroseconds = Query.inputPreparationInMicroseconds;
+		OutTimings.InferenceMicroseconds = Query.inferenceInMicroseconds;
+		OutTimings.OutputResolveMicroseconds = Query.outputResolveInMicroseconds;
+		return true;
+	}
+
 	static FfxResource FFXConvertResource(FfxApiResource ApiResource)
 	{
 		FfxResource Resource;
@@ -41,6 +41,7 @@ public class NSS : ModuleRules
 				"CoreUObject",
 				"NGSettings",
 				"NGVulkanBackend",
+				"NGCPUBackend",
 			}
 		);
 
@@ -24,33 +24,143 @@
 
 #include "NSS.h"
 
+#include "ComputeShaderUtils.h"
 #include "DataDrivenShaderPlatformInfo.h"
 #include "HAL/IConsoleManager.h"
 #include "LegacyScreenPercentageDriver.h"
 #include "LogNSS.h"
 #include "NGSettings.h"
+#include "NGSharedTrace.h"
+#include "NSSContextCache.h"
 #include "NSSHistory.h"
 #include "NSSInclude.h"
 #include "NSSModule.h"
 #include "NSSProxy.h"
+#include "NSSReference.h"
+#include "NSSStats.h"
+#include "NSSTrace.h"
 #include "PixelShaderUtils.h"
 #include "PlanarReflectionSceneProxy.h"
 #include "PostProcess/SceneRenderTargets.h"
+#include "RHI.h"
+#include "RenderGraphUtils.h"
+#include "RenderTargetPool.h"
 #include "ScenePrivate.h"
 #include "SceneTextureParameters.h"
 #include "ScreenSpaceRayTracing.h"
 #include "Serialization/MemoryImage.h"
 #include "Serialization/MemoryLayout.h"
+#include "StereoRendering.h"
 #include "TranslucentRendering.h"
 
 DECLARE_GPU_STAT(ArmNSSPass);
+DECLARE_GPU_STAT(ArmNSSInputPreparation);
+DECLARE_GPU_STAT(ArmNSSDispatch);
+DECLARE_GPU_STAT(ArmNSSOutputCrop);
+DECLARE_GPU_STAT(ArmNSSStereoReproject);
+DECLARE_GPU_STAT(ArmNSSRegionOfInterest);
+DEFINE_STAT(STAT_NSS_InputPreparationPasses);
+DEFINE_STAT(STAT_NSS_InputPreparationBytes);
+DEFINE_STAT(STAT_NSS_CropCopiesAvoided);
+DEFINE_STAT(STAT_NSS_PoolHits);
+DEFINE_STAT(STAT_NSS_PoolMisses);
+DEFINE_STAT(STAT_NSS_PoolEvictions);
+DEFINE_STAT(STAT_NSS_PoolResources);
+DEFINE_STAT(STAT_NSS_PoolMemory);
+DEFINE_STAT(STAT_NSS_ContextCacheHits);
+DEFINE_STAT(STAT_NSS_ContextCreations);
+DEFINE_STAT(STAT_NSS_ContextCacheEvictions);
+DEFINE_STAT(STAT_NSS_ContextCacheLockContentions);
+DEFINE_STAT(STAT_NSS_ContextCacheContexts);
+DEFINE_STAT(STAT_NSS_ContextCacheMemory);
+DEFINE_STAT(STAT_NSS_ContextCacheHitRate);
+DEFINE_STAT(STAT_NSS_ContextCreationMsAvoided);
+DEFINE_STAT(STAT_NSS_ContextsPrecreated);
+DEFINE_STAT(STAT_NSS_ContextPrecreationWaits);
+DEFINE_STAT(STAT_NSS_ContextPrecreationsPending);
+DEFINE_STAT(STAT_NSS_Histories);
+DEFINE_STAT(STAT_NSS_HistoryMemory);
+DEFINE_STAT(STAT_NSS_ContextMemory);
+DEFINE_STAT(STAT_NSS_ContextScratchMemory);
+DEFINE_STAT(STAT_NSS_TotalMemory);
+DEFINE_STAT(STAT_NSS_GPUInputPreparation);
+DEFINE_STAT(STAT_NSS_GPUDispatch);
+DEFINE_STAT(STAT_NSS_GPUDispatchInputPreparation);
+DEFINE_STAT(STAT_NSS_GPUDispatchInference);
+DEFINE_STAT(STAT_NSS_GPUDispatchOutputResolve);
+DEFINE_STAT(STAT_NSS_GPUOutputCrop);
+DEFINE_STAT(STAT_NSS_GPUTotal);
+DEFINE_STAT(STAT_NSS_DispatchRecording);
+DEFINE_STAT(STAT_NSS_ReprojectedEyes);
+DEFINE_STAT(STAT_NSS_GovernorScreenPercentage);
+DEFINE_STAT(STAT_NSS_GovernorGPUFrameTime);
+DEFINE_STAT(STAT_NSS_StaticFramesReused);
+DEFINE_STAT(STAT_NSS_StaticFrameReuseRate);
+DEFINE_STAT(STAT_NSS_SparseTilesChanged);
+DEFINE_STAT(STAT_NSS_SparseTilesActive);
+DEFINE_STAT(STAT_NSS_RegionOfInterestPixels);
+CSV_DEFINE_CATEGORY(NSS, true);
+
+void NSSInputPreparationStats::AddTexture(const FRDGTextureDesc& Desc)
+{
+	AllocatedBytes += uint64(Desc.Extent.X) * uint64(Desc.Extent.Y) * GPixelFormats[Desc.Format].BlockBytes;
+}
+
+void NSSInputPreparationStats::Publish() const
+{
+	INC_DWORD_STAT_BY(STAT_NSS_InputPreparationPasses, NumPasses);
+	INC_DWORD_STAT_BY(STAT_NSS_InputPreparationBytes, AllocatedBytes);
+	CSV_CUSTOM_STAT(NSS, InputPreparationPasses, NumPasses, ECsvCustomStatOp::Accumulate);
+	CSV_CUSTOM_STAT(NSS, InputPreparationKB, int32(AllocatedBytes / 1024), ECsvCustomStatOp::Accumulate);
+}
 
 namespace
 {
+	//----------------------------------------------------------------------------------------------------------------
+	// Times the passes added while it is in scope as a stage of NSS, with a GPU timestamp before and after them.
+	// Does nothing without a timer, i.e. when r.NSS.GPUTiming is disabled.
+	//----------------------------------------------------------------------------------------------------------------
+	class NSSGPUStageScope
+	{
+	public:
+		NSSGPUStageScope(FRDGBuilder& InGraphBuilder, NSSGPUTimer* Timer, ENSSGPUStage Stage)
+			: GraphBuilder(InGraphBuilder), Source(Timer ? &Timer->GetSource() : nullptr)
+		{
+			if (Timer)
+			{
+				Timestamps = Timer->AddStage(GFrameCounterRenderThread, Stage);
+				AddTimestampPass(Timestamps.Begin);
+			}
+		}
+
+		~NSSGPUStageScope()
+		{
+			if (Source)
+			{
+				AddTimestampPass(Timestamps.End);
+			}
+		}
+
+	private:
+		void AddTimestampPass(uint32 Timestamp)
+		{
+			INSSGPUTimestampSource* PassSource = Source;
+			GraphBuilder.AddPass(RDG_EVENT_NAME("ArmNss timestamp"),
+				ERDGPassFlags::NeverCull,
+				[PassSource, Timestamp](FRHICommandListImmediate& RHICmdList)
+				{ PassSource->WriteTimestamp(RHICmdList, Timestamp); });
+		}
+
+		FRDGBuilder& GraphBuilder;
+		INSSGPUTimestampSource* Source;
+		NSSGPUTimer::FStageTimestamps Timestamps;
+	};
+
 	FScreenPassTexture CopyAndCropIfNeeded(FRDGBuilder& GraphBuilder,
 		const FScreenPassTexture& Texture,
 		FIntPoint PaddingOnOutput,
-		const TCHAR* NameIfNeeded)
+		const TCHAR* NameIfNeeded,
+		NSSGPUTimer* StageTimer)
 	{
 		if (PaddingOnOutput == FIntPoint::ZeroValue)
 		{
@@ -58,6 +168,20 @@ namespace
 		}
 
 		FIntPoint CroppedSize = Texture.ViewRect.Size() - PaddingOnOutput;
+		// Everything downstream reads the upscaled colour through its view rect, so the padding can simply be left
+		// outside of it.
+		if (CVarNSSCropFreeOutput.GetValueOnRenderThread() != 0)
+		{
+			INC_DWORD_STAT(STAT_NSS_CropCopiesAvoided);
+			CSV_CUSTOM_STAT(NSS, CropCopiesAvoided, 1, ECsvCustomStatOp::Accumulate);
+			return FScreenPassTexture(
+				Texture.Texture, FIntRect(Texture.ViewRect.Min, Texture.ViewRect.Min + CroppedSize));
+		}
+
+		NSS_TRACE_COUNT(CropCopy);
+		RDG_GPU_STAT_SCOPE(GraphBuilder, ArmNSSOutputCrop);
+		RDG_EVENT_SCOPE(GraphBuilder, "ArmNss output crop");
+		NSSGPUStageScope StageScope(GraphBuilder, StageTimer, ENSSGPUStage::OutputCrop);
 		FRDGTextureDesc Desc = Texture.Texture->Desc;
 		QuantizeSceneBufferSize(CroppedSize, Desc.Extent);
 		Desc.Flags = TexCreate_RenderTargetable | TexCreate_ShaderResource;
@@ -72,26 +196,152 @@ namespace
 		return FScreenPassTexture(CroppedTexture, FIntRect(FIntPoint::ZeroValue, CroppedSize));
 	}
 
-	static bool IsNssContextParamsChanged(
-		const ffxApiCreateContextDescNss& CurrentParams, const ffxApiCreateContextDescNss& Params)
+	// The creation parameters of the context for a view running at Sizes.
+	ffxApiCreateContextDescNss MakeNssContextParams(const NSSContextSizes& Sizes)
 	{
-		return (CurrentParams.maxRenderSize.width != Params.maxRenderSize.width)
-			   || (CurrentParams.maxRenderSize.height != Params.maxRenderSize.height)
-			   || (CurrentParams.maxUpscaleSize.width != Params.maxUpscaleSize.width)
-			   || (CurrentParams.maxUpscaleSize.height != Params.maxUpscaleSize.height)
-			   || (CurrentParams.flags != Params.flags);
+		ffxApiCreateContextDescNss Params;
+		FMemory::Memzero(Params);
+		Params.header.type = FFX_API_CREATE_CONTEXT_DESC_TYPE_NSS;
+		Params.flags = 0;
+		Params.flags |= FFX_API_NSS_CONTEXT_FLAG_QUANTIZED; // Currently we only support quantized model.
+		Params.flags |= bool(ERHIZBuffer::IsInverted) ? FFX_API_NSS_CONTEXT_FLAG_DEPTH_INVERTED : 0;
+		Params.flags |= FFX_API_NSS_CONTEXT_FLAG_HIGH_DYNAMIC_RANGE | FFX_API_NSS_CONTEXT_FLAG_DEPTH_INFINITE;
+#if !PLATFORM_WINDOWS
+		Params.flags |= FFX_API_NSS_CONTEXT_FLAG_ALLOW_16BIT;
+#endif
+		Params.flags |= FFX_API_NSS_CONTEXT_FLAG_READ_TENSORS_AS_IMAGES;
+		// Final resolution (upscaled)
+		Params.maxUpscaleSize.height = Sizes.PaddedOutputSize.Y;
+		Params.maxUpscaleSize.width = Sizes.PaddedOutputSize.X;
+		// Render resolution (downscaled)
+		Params.maxRenderSize.height = Sizes.PaddedInputSize.Y;
+		Params.maxRenderSize.width = Sizes.PaddedInputSize.X;
+#if DO_CHECK || DO_GUARD_SLOW || DO_ENSURE || WITH_EDITOR
+		Params.flags |= FFX_API_NSS_CONTEXT_FLAG_ENABLE_DEBUG_CHECKING;
+		// Register message callback
+		Params.fpMessage = &NSS::OnNSSMessage;
+#endif
+		return Params;
 	}
 }
 
+//------------------------------------------------------------------------------------------------------
+// Logs the memory used by NSS, once the render thread is done with the frames already queued.
+//------------------------------------------------------------------------------------------------------
+static FAutoConsoleCommand CmdNSSDumpMemory(TEXT("r.NSS.DumpMemory"),
+	TEXT("Logs the GPU memory used by NSS for each view's history textures and contexts, and by the context cache and "
+		 "resource pool."),
+	FConsoleCommandDelegate::CreateLambda(
+		[]()
+		{
+			INSSModule* NSSModuleInterface = FModuleManager::GetModulePtr<INSSModule>(TEXT("NSS"));
+			const NSS* Upscaler = NSSModuleInterface ? NSSModuleInterface->GetNSSUpscaler() : nullptr;
+			if (!Upscaler)
+			{
+				UE_LOG(LogNSS, Display, TEXT("NSS isn't running."));
+				return;
+			}
+			ENQUEUE_RENDER_COMMAND(NSSDumpMemory)([Upscaler](FRHICommandListImmediate&) { Upscaler->DumpMemory(); });
+		}));
+
+//------------------------------------------------------------------------------------------------------
+// Captures the inputs NSS is dispatched with for a number of frames, for the replay commandlet and tests.
+//------------------------------------------------------------------------------------------------------
+static FAutoConsoleCommand CmdNSSCapture(TEXT("r.NSS.Capture"),
+	TEXT("r.NSS.Capture <Frames> [File] [Lossless]: captures the inputs of the next Frames frames of the first view "
+		 "NSS upscales to File, by default Saved/NSSCaptures/NSS_<date>.nsscap. Colour and motion are stored as deltas "
+		 "of half floats unless Lossless is given."),
+	FConsoleCommandWithArgsDelegate::CreateLambda(
+		[](const TArray<FString>& Args)
+		{
+			INSSModule* NSSModuleInterface = FModuleManager::GetModulePtr<INSSModule>(TEXT("NSS"));
+			NSS* Upscaler = NSSModuleInterface ? NSSModuleInterface->GetNSSUpscaler() : nullptr;
+			if (!Upscaler)
+			{
+				UE_LOG(LogNSS, Display, TEXT("NSS isn't running."));
+				return;
+			}
+			const int32 NumFrames = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 0;
+			if (NumFrames <= 0)
+			{
+				UE_LOG(LogNSS, Display, TEXT("Usage: r.NSS.Capture <Frames> [File] [Lossless]"));
+				return;
+			}
+			FString Path = FPaths::Combine(FPaths::ProjectSavedDir(),
+				TEXT("NSSCaptures"),
+				FString::Printf(TEXT("NSS_%s.nsscap"), *FDateTime::Now().ToString()));
+			NSSCaptureSettings Settings;
+			for (int32 Index = 1; Index < Args.Num(); Index++)
+			{
+				if (Args[Index] == TEXT("Lossless"))
+				{
+					Settings = NSSCaptureSettings::Lossless();
+				}
+				else
+				{
+					Path = Args[Index];
+				}
+			}
+			ENQUEUE_RENDER_COMMAND(NSSCapture)(
+				[Upscaler, Path, NumFrames, Settings](FRHICommandListImmediate&)
+				{ Upscaler->StartCapture(Path, NumFrames, Settings); });
+		}));
+
+//------------------------------------------------------------------------------------------------------
+// Records the ffx calls NSS makes to its backend, for NSSReplay -Trace= to re-issue.
+//------------------------------------------------------------------------------------------------------
+static FAutoConsoleCommand CmdNSSTraceStart(TEXT("r.NSS.Trace.Start"),
+	TEXT("r.NSS.Trace.Start [File]: records every ffx call NSS makes, with its descriptors, timing and thread, until "
+		 "r.NSS.Trace.Stop. File is Saved/NSSTraces/NSS_<date>.ngtrace by default."),
+	FConsoleCommandWithArgsDelegate::CreateLambda(
+		[](const TArray<FString>& Args)
+		{
+			FString Path = FPaths::Combine(FPaths::ProjectSavedDir(),
+				TEXT("NSSTraces"),
+				FString::Printf(TEXT("NSS_%s.ngtrace"), *FDateTime::Now().ToString()));
+			if (Args.Num() > 0)
+			{
+				Path = Args[0];
+			}
+			if (NGSharedTrace::Start(Path))
+			{
+				UE_LOG(LogNSS, Display, TEXT("Tracing ffx calls to %s"), *Path);
+			}
+		}));
+
+static FAutoConsoleCommand CmdNSSTraceStop(TEXT("r.NSS.Trace.Stop"),
+	TEXT("r.NSS.Trace.Stop: stops the trace started by r.NSS.Trace.Start and writes it out."),
+	FConsoleCommandDelegate::CreateLambda(
+		[]()
+		{
+			if (!NGSharedTrace::IsRecording())
+			{
+				UE_LOG(LogNSS, Display, TEXT("No trace is being recorded."));
+				return;
+			}
+			NGSharedTrace::Stop();
+		}));
+
 //------------------------------------------------------------------------------------------------------
 // To enforce quality modes we have to save the existing screen percentage so we can restore it later.
 //------------------------------------------------------------------------------------------------------
 float NSS::SavedScreenPercentage{100.0f};
+float NSS::TargetScreenPercentage{50.0f};
+bool NSS::bSettingScreenPercentage{false};
 static const TCHAR ScreenPercentageLOG[] =
 	TEXT("ScreenPercentage should be in (0, 100) for NSS. Override r.ScreenPercentage to ideal 50");
 
 IMPLEMENT_GLOBAL_SHADER(FNssConvertVelocity, "/Plugin/NSS/Private/NssConvertVelocityPS.usf", "main", SF_Pixel);
 IMPLEMENT_GLOBAL_SHADER(FNssMirrorPadPS, "/Plugin/NSS/Private/NssMirrorPad.usf", "MirrorPadPS", SF_Pixel);
+IMPLEMENT_GLOBAL_SHADER(FNssPrepareInputsCS, "/Plugin/NSS/Private/NssPrepareInputs.usf", "MainCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FNssPadBorderPS, "/Plugin/NSS/Private/NssPrepareInputs.usf", "PadBorderPS", SF_Pixel);
+IMPLEMENT_GLOBAL_SHADER(FNssStereoReprojectPS, "/Plugin/NSS/Private/NssStereoReproject.usf", "MainPS", SF_Pixel);
+IMPLEMENT_GLOBAL_SHADER(FNssMotionReductionCS, "/Plugin/NSS/Private/NssMotionReduction.usf", "MainCS", SF_Compute);
+#if NSS_PREVIEWS_ENABLED
+IMPLEMENT_GLOBAL_SHADER(FNssClassifyTilesCS, "/Plugin/NSS/Private/NssSparseTiles.usf", "ClassifyCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FNssDilateTilesCS, "/Plugin/NSS/Private/NssSparseTiles.usf", "DilateCS", SF_Compute);
+IMPLEMENT_GLOBAL_SHADER(FNssRegionOfInterestPS, "/Plugin/NSS/Private/NssRegionOfInterest.usf", "MainPS", SF_Pixel);
+#endif
 
 struct NSSPass
 {
@@ -112,10 +362,13 @@ struct NSSPass
 //------------------------------------------------------------------------------------------------------
 // NSS implementation.
 //------------------------------------------------------------------------------------------------------
-NSS::NSS() : Api(EFFXBackendAPI::Unknown), ApiAccessor(nullptr), CurrentGraphBuilder(nullptr), WrappedDenoiser(nullptr)
+NSS::NSS()
+	: Api(EFFXBackendAPI::Unknown)
+	, ApiAccessor(nullptr)
+	, bInitializedWithCPUBackend(false)
+	, WrappedDenoiser(nullptr)
+	, GPUTimer(MakeUnique<NSSRHITimestampSource>())
 {
-	FMemory::Memzero(PostInputs);
-
 #if WITH_EDITOR
 	bEnabledInEditor = true;
 #endif
@@ -128,6 +381,10 @@ NSS::NSS() : Api(EFFXBackendAPI::Unknown), ApiAccessor(nullptr), CurrentGraphBui
 	IConsoleVariable* ScreenPercentageVar = IConsoleManager::Get().FindConsoleVariable(TEXT("r.ScreenPercentage"));
 	ScreenPercentageVar->SetOnChangedCallback(ScreenPercentageChangedDelegate);
 
+	FConsoleVariableDelegate QualityModeChangedDelegate =
+		FConsoleVariableDelegate::CreateStatic(&NSS::OnChangeQualityMode);
+	CVarNSSQualityMode->SetOnChangedCallback(QualityModeChangedDelegate);
+
 	if (CVarEnableNSS->GetBool())
 	{
 		SaveScreenPercentage();
@@ -139,7 +396,9 @@ NSS::NSS() : Api(EFFXBackendAPI::Unknown), ApiAccessor(nullptr), CurrentGraphBui
 
 NSS::~NSS()
 {
-	DeferredCleanup(0);
+	ContextFactory.Wait();
+	ContextCache.Empty();
+	ViewResources.Empty();
 }
 
 const TCHAR* NSS::GetDebugName() const
@@ -149,29 +408,292 @@ const TCHAR* NSS::GetDebugName() const
 
 void NSS::ReleaseState(NSSStateRef State)
 {
-	FScopeLock Lock(&Mutex);
-	if (!AvailableStates.Contains(State) && State)
+	NSS_TRACE_SCOPE("NSS::ReleaseState");
+	ContextCache.Release(MoveTemp(State));
+}
+
+void NSS::AddHistory(const NSSHistory* History)
+{
+	FScopeLock Lock(&HistoriesMutex);
+	Histories.Add(History);
+}
+
+void NSS::RemoveHistory(const NSSHistory* History)
+{
+	FScopeLock Lock(&HistoriesMutex);
+	Histories.Remove(History);
+}
+
+TMap<uint32, NSSHistoryMemoryStats> NSS::GetHistoryMemoryStats(bool bPerView) const
+{
+	TMap<uint32, NSSHistoryMemoryStats> Result;
+	FScopeLock Lock(&HistoriesMutex);
+	CountedStates.Reset();
+	for (const NSSHistory* History : Histories)
+	{
+		const NSSStateRef& State = History->GetState();
+		AddHistoryMemoryStats(*History, Result.FindOrAdd(bPerView && State.IsValid() ? State->ViewID : 0));
+	}
+	return Result;
+}
+
+NSSHistoryMemoryStats NSS::GetTotalHistoryMemoryStats() const
+{
+	NSSHistoryMemoryStats Result;
+	FScopeLock Lock(&HistoriesMutex);
+	CountedStates.Reset();
+	for (const NSSHistory* History : Histories)
+	{
+		AddHistoryMemoryStats(*History, Result);
+	}
+	return Result;
+}
+
+void NSS::AddHistoryMemoryStats(const NSSHistory& History, NSSHistoryMemoryStats& Stats) const
+{
+	Stats.NumHistories++;
+	Stats.TextureBytes += History.GetTextureSizeBytes();
+
+	const NSSStateRef& State = History.GetState();
+	bool bAlreadyCounted = true;
+	if (State.IsValid())
+	{
+		CountedStates.Add(State.GetReference(), &bAlreadyCounted);
+	}
+	if (!bAlreadyCounted)
+	{
+		Stats.NumContexts++;
+		Stats.ContextBytes += State->GPUSizeBytes;
+		Stats.ContextScratchBytes += State->GPUScratchSizeBytes;
+		Stats.NumContextsEstimated += State->bGPUSizeEstimated ? 1 : 0;
+	}
+}
+
+void NSS::DumpMemory() const
+{
+	constexpr double BytesPerMB = 1024.0 * 1024.0;
+	const auto LogHistories = [&](const TCHAR* Name, const NSSHistoryMemoryStats& Stats)
+	{
+		UE_LOG(LogNSS,
+			Display,
+			TEXT("  %s: %.2f MB, %d histories with %.2f MB of textures, %d contexts with %.2f MB (%.2f MB scratch)%s"),
+			Name,
+			double(Stats.GetTotalBytes()) / BytesPerMB,
+			Stats.NumHistories,
+			double(Stats.TextureBytes) / BytesPerMB,
+			Stats.NumContexts,
+			double(Stats.ContextBytes) / BytesPerMB,
+			double(Stats.ContextScratchBytes) / BytesPerMB,
+			Stats.NumContextsEstimated > 0 ? TEXT(", estimated") : TEXT(""));
+	};
+
+	UE_LOG(LogNSS, Display, TEXT("NSS memory:"));
+	TMap<uint32, NSSHistoryMemoryStats> ViewStats = GetHistoryMemoryStats(true);
+	ViewStats.KeySort(TLess<uint32>());
+	for (const TPair<uint32, NSSHistoryMemoryStats>& Pair : ViewStats)
 	{
-		AvailableStates.Add(State);
+		LogHistories(*FString::Printf(TEXT("View %u"), Pair.Key), Pair.Value);
 	}
+	const NSSHistoryMemoryStats HistoryStats = GetTotalHistoryMemoryStats();
+	LogHistories(TEXT("All views"), HistoryStats);
+
+	const NSSContextCacheStats CacheStats = ContextCache.GetStats();
+	UE_LOG(LogNSS,
+		Display,
+		TEXT("  Context cache: %.2f MB, %d contexts"),
+		double(CacheStats.CachedBytes) / BytesPerMB,
+		CacheStats.NumCached);
+	const NSSResourcePoolStats PoolStats = ViewResources.GetStats();
+	UE_LOG(LogNSS,
+		Display,
+		TEXT("  Resource pools: %.2f MB, %d resources in %d views"),
+		double(PoolStats.AllocatedBytes) / BytesPerMB,
+		PoolStats.NumResources,
+		ViewResources.GetNumViews());
+	UE_LOG(LogNSS, Display, TEXT("  Contexts being created: %d"), ContextFactory.GetStats().NumPending);
+	UE_LOG(LogNSS,
+		Display,
+		TEXT("  Total: %.2f MB"),
+		double(HistoryStats.GetTotalBytes() + CacheStats.CachedBytes + PoolStats.AllocatedBytes) / BytesPerMB);
 }
 
 void NSS::DeferredCleanup(uint64 FrameNum) const
 {
-	FScopeLock Lock(&Mutex);
-	AvailableStates.Empty();
+	ContextCache.Trim(FMath::Max(CVarNSSContextCacheMaxCount.GetValueOnRenderThread(), 0),
+		uint64(FMath::Max(CVarNSSContextCacheMaxSizeMB.GetValueOnRenderThread(), 0)) * 1024 * 1024);
+}
+
+bool NSS::UseCPUBackend()
+{
+	const int32 Mode = CVarNSSCPUBackend.GetValueOnAnyThread();
+	return Mode >= 2 || (Mode == 1 && GDynamicRHI && FCString::Stricmp(GDynamicRHI->GetName(), TEXT("Null")) == 0);
+}
+
+ffxApiDispatchDescNss NSS::MakeDispatchParams(const NSSDispatchFrameParams& Frame)
+{
+	ffxApiDispatchDescNss NssDispatchParams = {};
+	NssDispatchParams.header.type = FFX_API_DISPATCH_DESC_TYPE_NSS;
+	NssDispatchParams.flags = 0;
+	NssDispatchParams.flags |= Frame.bDebugViews ? FFX_API_NSS_DISPATCH_FLAG_DRAW_DEBUG_VIEW : 0;
+	NssDispatchParams.reset = Frame.bReset;
+	NssDispatchParams.frameTimeDelta = Frame.FrameTimeDeltaSeconds * 1000.f;
+	// Reference shaders use subtraction of jitter and it's in input resolution units, instead of UV units.
+	NssDispatchParams.jitterOffset.x = -Frame.JitterPixels.X;
+	NssDispatchParams.jitterOffset.y = -Frame.JitterPixels.Y;
+	NssDispatchParams.renderSize.width = Frame.PaddedInputSize.X;
+	NssDispatchParams.renderSize.height = Frame.PaddedInputSize.Y;
+	NssDispatchParams.upscaleSize.width = Frame.PaddedOutputSize.X;
+	NssDispatchParams.upscaleSize.height = Frame.PaddedOutputSize.Y;
+	// Parameters for motion vectors:
+	NssDispatchParams.motionVectorScale.x = Frame.PaddedInputSize.X;
+	NssDispatchParams.motionVectorScale.y = Frame.PaddedInputSize.Y;
+	NssDispatchParams.cameraFovAngleVertical = Frame.FovAngleVertical;
+	if (bool(ERHIZBuffer::IsInverted))
+	{
+		NssDispatchParams.cameraNear = FLT_MAX;
+		NssDispatchParams.cameraFar = Frame.NearPlane;
+	}
+	else
+	{
+		NssDispatchParams.cameraNear = Frame.NearPlane;
+		NssDispatchParams.cameraFar = FLT_MAX;
+	}
+	return NssDispatchParams;
+}
+
+NSSStateRef NSS::AcquireState(const NSSContextSizes& ContextSizes,
+	NSSHistory* History,
+	uint32 ViewID,
+	uint64 Frame,
+	bool& bInOutHistoryValid,
+	bool* bOutCreated) const
+{
+	NSS_TRACE_SCOPE("NSS::AcquireState");
+	ContextCache.AddReleased();
+	const ffxApiCreateContextDescNss Params = MakeNssContextParams(ContextSizes);
+	NSSStateRef CurrentNSSState;
+	bool HasValidContext = History && History->GetState().IsValid();
+	if (bOutCreated)
+	{
+		*bOutCreated = false;
+	}
+	// We want to reuse NSS states rather than recreating them wherever possible as they allocate significant
+	// memory for their internal resources.
+	// The current custom history is the ideal, but the recently released states can be reused with a simple
+	// reset too when the engine cuts the history. This reduces the memory churn imposed by camera cuts.
+	if (HasValidContext)
+	{
+		ffxApiCreateContextDescNss const& CurrentParams = History->GetState()->Params;
+		if ((History->GetState()->LastUsedFrame == Frame) || IsNssContextParamsChanged(CurrentParams, Params))
+		{
+			HasValidContext = false;
+		}
+		else
+		{
+			CurrentNSSState = History->GetState();
+		}
+	}
+	if (!HasValidContext)
+	{
+		NSS_TRACE_SCOPE("NSS::FindAvailableState");
+		CurrentNSSState = ContextCache.Find(Params, ViewID, Frame);
+		if (!CurrentNSSState)
+		{
+			// A context predicted for this frame that is still being created is no slower to wait for than
+			// creating a new one.
+			CurrentNSSState = ContextFactory.TakePending(Params);
+		}
+		if (CurrentNSSState)
+		{
+			HasValidContext = true;
+			bInOutHistoryValid = false;
+			CurrentNSSState->FramesOutOfBounds = 0;
+			// It may have been another view's, whose frames and motion say nothing about this one's.
+			CurrentNSSState->StaticFrameDetector.Reset();
+			CurrentNSSState->MotionReadbacks.Reset();
+			CurrentNSSState->MaxMotionPixels.Reset();
+		}
+	}
+	if (!HasValidContext)
+	{
+		// For a new context, allocate the necessary scratch memory for the chosen backend
+		CurrentNSSState = new NSSState(ApiAccessor);
+	}
+	check(CurrentNSSState);
+	CurrentNSSState->LastUsedFrame = Frame;
+	CurrentNSSState->ViewID = ViewID;
+
+	//----------------------------------------------------------------------------------------------------------
+	// Invalidate NSS Contexts
+	//   If a context already exists but it is not valid for the current frame's features, clean it up in
+	//   preparation for creating a new one.
+	//----------------------------------------------------------------------------------------------------------
+	if (HasValidContext)
+	{
+		ffxApiCreateContextDescNss const& CurrentParams = CurrentNSSState->Params;
+		// Display size must match for splitscreen to work.
+		if (IsNssContextParamsChanged(CurrentParams, Params))
+		{
+			ApiAccessor->ffxDestroyContext(&CurrentNSSState->Nss);
+			HasValidContext = false;
+			bInOutHistoryValid = false;
+		}
+	}
+	//------------------------------------------------------
+	// Create NSS Contexts
+	//   If no valid context currently exists, create one.
+	//------------------------------------------------------
+	if (!HasValidContext)
+	{
+		NSS_TRACE_SCOPE("NSS::CreateContext");
+		ffxApiCreateContextDescNss CreateParams = Params;
+		const double CreateStartTime = FPlatformTime::Seconds();
+		FfxErrorCode ErrorCode = ApiAccessor->ffxCreateContext(&CurrentNSSState->Nss, &CreateParams.header);
+		const double CreateSeconds = FPlatformTime::Seconds() - CreateStartTime;
+		ContextCache.RecordCreation(CreateSeconds);
+		check(ErrorCode == FFX_OK);
+		if (ErrorCode != FFX_OK)
+		{
+			return nullptr;
+		}
+		if (NSS_TRACE_IS_ENABLED())
+		{
+			NSSTrace::OutputContextCreated(
+				ViewID, ContextSizes.PaddedInputSize, ContextSizes.PaddedOutputSize, CreateSeconds, false);
+		}
+		bInOutHistoryValid = false;
+		FMemory::Memcpy(CurrentNSSState->Params, Params);
+		CurrentNSSState->UpdateGPUSizeBytes();
+		if (bOutCreated)
+		{
+			*bOutCreated = true;
+		}
+	}
+	return CurrentNSSState;
 }
 
 INGSharedBackend* NSS::GetApiAccessor(EFFXBackendAPI& Api)
 {
 	INGSharedBackend* ApiAccessor = nullptr;
+	if (UseCPUBackend())
+	{
+		INGSharedBackendModule* CPUBackend =
+			FModuleManager::GetModulePtr<INGSharedBackendModule>(TEXT("NGCPUBackend"));
+		ApiAccessor = CPUBackend ? NGSharedTrace::Wrap(CPUBackend->GetBackend()) : nullptr;
+		if (ApiAccessor)
+		{
+			Api = EFFXBackendAPI::CPU;
+		}
+		return ApiAccessor;
+	}
+
 	FString RHIName = GDynamicRHI->GetName();
 	INGSharedBackendModule* VkBackend = FModuleManager::GetModulePtr<INGSharedBackendModule>(TEXT("NGVulkanBackend"));
 
 	if (IsFeatureLevelSupported(GMaxRHIShaderPlatform, ERHIFeatureLevel::ES3_1) && RHIName == TEXT("Vulkan")
 		&& VkBackend)
 	{
-		ApiAccessor = VkBackend->GetBackend();
+		ApiAccessor = NGSharedTrace::Wrap(VkBackend->GetBackend());
 		if (ApiAccessor)
 		{
 			Api = EFFXBackendAPI::Vulkan;
@@ -206,12 +728,22 @@ void NSS::UpdateScreenPercentage()
 {
 	// Note: The ScreenPercentage should be in the range (0.0f, 100.0f).
 	static IConsoleVariable* ScreenPercentage = IConsoleManager::Get().FindConsoleVariable(TEXT("r.ScreenPercentage"));
-	float CurrentValue = ScreenPercentage->GetFloat();
-	if (CurrentValue >= 100.0f || CurrentValue <= 0.0f)
+	const float QualityModeScreenPercentage =
+		GetQualityModeScreenPercentage(CVarNSSQualityMode.GetValueOnGameThread());
+	if (QualityModeScreenPercentage > 0.0f)
+	{
+		SetScreenPercentage(QualityModeScreenPercentage);
+	}
+	else
 	{
-		ScreenPercentage->Set(50.0f, ECVF_SetByConsole);
-		UE_LOG(LogNSS, Warning, TEXT("%s"), ScreenPercentageLOG);
+		float CurrentValue = ScreenPercentage->GetFloat();
+		if (CurrentValue >= 100.0f || CurrentValue <= 0.0f)
+		{
+			ScreenPercentage->Set(50.0f, ECVF_SetByConsole);
+			UE_LOG(LogNSS, Warning, TEXT("%s"), ScreenPercentageLOG);
+		}
 	}
+	TargetScreenPercentage = ScreenPercentage->GetFloat();
 }
 
 void NSS::RestoreScreenPercentage()
@@ -220,6 +752,33 @@ void NSS::RestoreScreenPercentage()
 	ScreenPercentage->Set(SavedScreenPercentage, ECVF_SetByConsole);
 }
 
+void NSS::SetScreenPercentage(float Value)
+{
+	static IConsoleVariable* ScreenPercentage = IConsoleManager::Get().FindConsoleVariable(TEXT("r.ScreenPercentage"));
+	if (ScreenPercentage->GetFloat() != Value)
+	{
+		TGuardValue<bool> SettingScreenPercentage(bSettingScreenPercentage, true);
+		ScreenPercentage->Set(Value, ECVF_SetByConsole);
+	}
+}
+
+float NSS::GetQualityModeScreenPercentage(int32 QualityMode)
+{
+	switch (ENSSQualityMode(QualityMode))
+	{
+	case ENSSQualityMode::Quality:
+		return 100.0f / 1.5f;
+	case ENSSQualityMode::Balanced:
+		return 100.0f / 1.7f;
+	case ENSSQualityMode::Performance:
+		return 50.0f;
+	case ENSSQualityMode::UltraPerformance:
+		return 100.0f / 3.0f;
+	default:
+		return 0.0f;
+	}
+}
+
 void NSS::OnChangeNSSEnable(IConsoleVariable* Var)
 {
 	if (CVarEnableNSS.GetValueOnGameThread())
@@ -235,7 +794,7 @@ void NSS::OnChangeNSSEnable(IConsoleVariable* Var)
 
 void NSS::OnChangeScreenPercentage(IConsoleVariable* Var)
 {
-	if (CVarEnableNSS.GetValueOnGameThread())
+	if (CVarEnableNSS.GetValueOnGameThread() && !bSettingScreenPercentage)
 	{
 		if (Var->GetFloat() <= 0.0f || Var->GetFloat() >= 100.0f)
 		{
@@ -245,17 +804,22 @@ void NSS::OnChangeScreenPercentage(IConsoleVariable* Var)
 		else
 		{
 			SaveScreenPercentage();
+			TargetScreenPercentage = Var->GetFloat();
 		}
 	}
 }
 
-FRDGBuilder* NSS::GetGraphBuilder()
+void NSS::OnChangeQualityMode(IConsoleVariable* Var)
 {
-	return CurrentGraphBuilder;
+	if (CVarEnableNSS.GetValueOnGameThread())
+	{
+		UpdateScreenPercentage();
+	}
 }
 
 bool InitCreateContext(INGSharedBackend* ApiAccessor)
 {
+	NSS_TRACE_SCOPE("NSS::InitCreateContext");
 	static bool bSuccess = false;
 	static bool bInitialized = false;
 	if (bInitialized)
@@ -295,6 +859,15 @@ bool InitCreateContext(INGSharedBackend* ApiAccessor)
 
 void NSS::Initialize() const
 {
+	// This is called every frame, so once a backend is in use it only has to notice r.NSS.CPUBackend changing.
+	FScopeLock Lock(&InitializeMutex);
+	const bool bUseCPUBackend = UseCPUBackend();
+	if (IsApiSupported() && bUseCPUBackend == bInitializedWithCPUBackend)
+	{
+		return;
+	}
+	bInitializedWithCPUBackend = bUseCPUBackend;
+
 	ApiAccessor = GetApiAccessor(Api);
 	if (!ApiAccessor)
 	{
@@ -335,11 +908,6 @@ void NSS::Initialize() const
 
 namespace
 {
-	FIntPoint RoundUpToMultiple(FIntPoint in, uint32 multiple)
-	{
-		return ((in + multiple - 1) / multiple) * multiple;
-	}
-
 	INSS::FOutputs BlankOutput(FRDGBuilder& GraphBuilder, const INSS::FInputs& Inputs)
 	{
 		INSS::FOutputs Outputs;
@@ -357,10 +925,447 @@ namespace
 
 		return Outputs;
 	}
+
+	//----------------------------------------------------------------------------------------------------------------
+	// Padding in place
+	//   The SDK has no notion of a view offset and needs inputs that are a multiple of 8, but when the view starts at
+	//   the origin and the scene textures already have room for the padding only the border needs writing. The
+	//   scene textures are shared by the views of the family, so the border must not overlap another view's rect
+	//   (e.g. split screen or the other eye of a stereo pair), whose input would otherwise be overwritten before it
+	//   is upscaled itself. Past every view, the border holds nothing the engine reads.
+	//----------------------------------------------------------------------------------------------------------------
+	bool CanPadInPlace(const FViewInfo& View, const NSSPassInput& PassInputs, FIntPoint PaddedInputSize)
+	{
+		const FIntPoint ViewSize = PassInputs.SceneColor.ViewRect.Size();
+		const FIntRect BorderRects[] = {
+			FIntRect(ViewSize.X, 0, PaddedInputSize.X, PaddedInputSize.Y),
+			FIntRect(0, ViewSize.Y, PaddedInputSize.X, PaddedInputSize.Y),
+		};
+		for (const FSceneView* OtherView : View.Family->Views)
+		{
+			if (OtherView == &View)
+			{
+				continue;
+			}
+			const FIntRect& OtherRect = static_cast<const FViewInfo*>(OtherView)->ViewRect;
+			for (const FIntRect& BorderRect : BorderRects)
+			{
+				if (!BorderRect.IsEmpty() && BorderRect.Intersect(OtherRect))
+				{
+					return false;
+				}
+			}
+		}
+
+		auto HasRoomForPadding = [PaddedInputSize](const FScreenPassTexture& Input)
+		{
+			const FRDGTextureDesc& Desc = Input.Texture->Desc;
+			return Input.ViewRect.Min == FIntPoint::ZeroValue && Desc.Extent.X >= PaddedInputSize.X
+				   && Desc.Extent.Y >= PaddedInputSize.Y && Desc.NumSamples == 1;
+		};
+		return HasRoomForPadding(PassInputs.SceneColor) && HasRoomForPadding(PassInputs.SceneDepth)
+			   && EnumHasAnyFlags(PassInputs.SceneColor.Texture->Desc.Flags, TexCreate_RenderTargetable)
+			   && EnumHasAnyFlags(PassInputs.SceneDepth.Texture->Desc.Flags, TexCreate_DepthStencilTargetable);
+	}
+
+	void AddPadBorderPasses(FRDGBuilder& GraphBuilder,
+		const FViewInfo& View,
+		const NSSPassInput& PassInputs,
+		FIntPoint PaddedInputSize,
+		FRDGTextureRef BorderColor,
+		FRDGTextureRef BorderDepth,
+		NSSInputPreparationStats& Stats)
+	{
+		const FIntPoint ViewSize = PassInputs.SceneColor.ViewRect.Size();
+		const FIntRect BorderRects[] = {
+			FIntRect(ViewSize.X, 0, PaddedInputSize.X, ViewSize.Y),
+			FIntRect(0, ViewSize.Y, PaddedInputSize.X, PaddedInputSize.Y),
+		};
+		TShaderMapRef<FNssPadBorderPS> PixelShader(View.ShaderMap);
+		for (const FIntRect& BorderRect : BorderRects)
+		{
+			if (BorderRect.IsEmpty())
+			{
+				continue;
+			}
+			FNssPadBorderPS::FParameters* PassParameters = GraphBuilder.AllocParameters<FNssPadBorderPS::FParameters>();
+			PassParameters->InputViewSize = ViewSize;
+			PassParameters->OutputSize = FUintVector2(PaddedInputSize.X, PaddedInputSize.Y);
+			PassParameters->BorderStripWidth = FNssPrepareInputsCS::BorderStripWidth;
+			PassParameters->BorderColor = BorderColor;
+			PassParameters->BorderDepth = BorderDepth;
+			PassParameters->RenderTargets[0] =
+				FRenderTargetBinding(PassInputs.SceneColor.Texture, ERenderTargetLoadAction::ELoad);
+			PassParameters->RenderTargets.DepthStencil = FDepthStencilBinding(PassInputs.SceneDepth.Texture,
+				ERenderTargetLoadAction::ELoad,
+				FExclusiveDepthStencil::DepthWrite_StencilNop);
+			FPixelShaderUtils::AddFullscreenPass(GraphBuilder,
+				View.ShaderMap,
+				RDG_EVENT_NAME("ArmNss pad border %dx%d", BorderRect.Width(), BorderRect.Height()),
+				PixelShader,
+				PassParameters,
+				BorderRect,
+				nullptr,
+				nullptr,
+				TStaticDepthStencilState<true, CF_Always>::GetRHI());
+			Stats.NumPasses++;
+		}
+	}
+
+	//----------------------------------------------------------------------------------------------------------------
+	// Fused input preparation
+	//   Mirror pads the colour and depth (when the view isn't a multiple of 8) and writes the motion vectors NSS
+	//   consumes in a single compute pass, so each input texel is only read and written once.
+	//----------------------------------------------------------------------------------------------------------------
+	void AddPrepareInputsPass(FRDGBuilder& GraphBuilder,
+		NSSViewResourcePool& Resources,
+		const FViewInfo& View,
+		const NSSPassInput& PassInputs,
+		FIntPoint PaddedInputSize,
+		ENssInputPadding Padding,
+		FRDGTextureRef MotionVectorTexture,
+		FScreenPassTexture& OutPaddedColor,
+		FScreenPassTexture& OutPaddedDepth,
+		NSSInputPreparationStats& Stats)
+	{
+		const FIntRect InputViewRect = PassInputs.SceneColor.ViewRect;
+
+		FNssPrepareInputsCS::FParameters* PassParameters =
+			GraphBuilder.AllocParameters<FNssPrepareInputsCS::FParameters>();
+		PassParameters->InputColor = PassInputs.SceneColor.Texture;
+		PassParameters->InputDepth = PassInputs.SceneDepth.Texture;
+		PassParameters->InputVelocity = PassInputs.SceneVelocity.Texture;
+		PassParameters->InputViewMin = InputViewRect.Min;
+		PassParameters->InputViewSize = InputViewRect.Size();
+		PassParameters->OutputSize = FUintVector2(PaddedInputSize.X, PaddedInputSize.Y);
+		PassParameters->InvContentSize = FVector2f(1.0f / float(PaddedInputSize.X), 1.0f / float(PaddedInputSize.Y));
+		PassParameters->View = View.ViewUniformBuffer;
+		PassParameters->OutMotionVectors = GraphBuilder.CreateUAV(MotionVectorTexture);
+		PassParameters->BorderStripWidth = FNssPrepareInputsCS::BorderStripWidth;
+
+		// Not every scene colour format supports typed UAV stores (e.g. R11G11B10 on some mobile GPUs).
+		EPixelFormat ColorFormat = PassInputs.SceneColor.Texture->Desc.Format;
+		if (!EnumHasAllFlags(GPixelFormats[ColorFormat].Capabilities, EPixelFormatCapabilities::TypedUAVStore))
+		{
+			ColorFormat = PF_FloatRGBA;
+		}
+
+		FRDGTextureRef BorderColor = nullptr;
+		FRDGTextureRef BorderDepth = nullptr;
+		if (Padding == ENssInputPadding::Copy)
+		{
+			FRDGTextureDesc ColorPaddedDesc = FRDGTextureDesc::Create2D(
+				PaddedInputSize, ColorFormat, FClearValueBinding::Black, TexCreate_ShaderResource | TexCreate_UAV);
+			OutPaddedColor.Texture =
+				NSS::CreatePooledTexture(GraphBuilder, Resources, ColorPaddedDesc, TEXT("ArmNssPaddedInputSceneColor"));
+			OutPaddedColor.ViewRect = FIntRect(FIntPoint::ZeroValue, PaddedInputSize);
+
+			// Depth stencil formats can't be written from compute, so the padded depth is a plain float texture.
+			FRDGTextureDesc DepthPaddedDesc = FRDGTextureDesc::Create2D(
+				PaddedInputSize, PF_R32_FLOAT, FClearValueBinding::Black, TexCreate_ShaderResource | TexCreate_UAV);
+			OutPaddedDepth.Texture =
+				NSS::CreatePooledTexture(GraphBuilder, Resources, DepthPaddedDesc, TEXT("ArmNssPaddedInputSceneDepth"));
+			OutPaddedDepth.ViewRect = FIntRect(FIntPoint::ZeroValue, PaddedInputSize);
+
+			PassParameters->OutColor = GraphBuilder.CreateUAV(OutPaddedColor.Texture);
+			PassParameters->OutDepth = GraphBuilder.CreateUAV(OutPaddedDepth.Texture);
+			Stats.AddTexture(ColorPaddedDesc);
+			Stats.AddTexture(DepthPaddedDesc);
+		}
+		else if (Padding == ENssInputPadding::InPlace)
+		{
+			const FIntPoint ViewSize = InputViewRect.Size();
+			const int32 NumBorderTexels =
+				(PaddedInputSize.X - ViewSize.X) * ViewSize.Y + PaddedInputSize.X * (PaddedInputSize.Y - ViewSize.Y);
+			const FIntPoint StripSize(FNssPrepareInputsCS::BorderStripWidth,
+				FMath::DivideAndRoundUp(NumBorderTexels, int32(FNssPrepareInputsCS::BorderStripWidth)));
+			FRDGTextureDesc BorderColorDesc = FRDGTextureDesc::Create2D(
+				StripSize, ColorFormat, FClearValueBinding::Black, TexCreate_ShaderResource | TexCreate_UAV);
+			BorderColor = GraphBuilder.CreateTexture(BorderColorDesc, TEXT("ArmNssBorderSceneColor"));
+			FRDGTextureDesc BorderDepthDesc = FRDGTextureDesc::Create2D(
+				StripSize, PF_R32_FLOAT, FClearValueBinding::Black, TexCreate_ShaderResource | TexCreate_UAV);
+			BorderDepth = GraphBuilder.CreateTexture(BorderDepthDesc, TEXT("ArmNssBorderSceneDepth"));
+
+			PassParameters->OutBorderColor = GraphBuilder.CreateUAV(BorderColor);
+			PassParameters->OutBorderDepth = GraphBuilder.CreateUAV(BorderDepth);
+			Stats.AddTexture(BorderColorDesc);
+			Stats.AddTexture(BorderDepthDesc);
+
+			// The SDK is handed the scene textures themselves, with the padding written past the end of the view.
+			OutPaddedColor.ViewRect = FIntRect(FIntPoint::ZeroValue, PaddedInputSize);
+			OutPaddedDepth.ViewRect = FIntRect(FIntPoint::ZeroValue, PaddedInputSize);
+		}
+
+		FNssPrepareInputsCS::FPermutationDomain PermutationVector;
+		PermutationVector.Set<FNssPrepareInputsCS::FPadMode>(Padding);
+		TShaderMapRef<FNssPrepareInputsCS> ComputeShader(View.ShaderMap, PermutationVector);
+		FComputeShaderUtils::AddPass(GraphBuilder,
+			RDG_EVENT_NAME("ArmNss PrepareInputs (CS) %dx%d", PaddedInputSize.X, PaddedInputSize.Y),
+			ComputeShader,
+			PassParameters,
+			FComputeShaderUtils::GetGroupCount(PaddedInputSize,
+				FIntPoint(FNssPrepareInputsCS::ThreadgroupSizeX, FNssPrepareInputsCS::ThreadgroupSizeY)));
+		Stats.NumPasses++;
+
+		if (Padding == ENssInputPadding::InPlace)
+		{
+			AddPadBorderPasses(GraphBuilder, View, PassInputs, PaddedInputSize, BorderColor, BorderDepth, Stats);
+		}
+	}
+
+	//----------------------------------------------------------------------------------------------------------------
+	// Static frame motion
+	//   Measures the longest motion vector of the objects moving by themselves in a paused view, e.g. actors ticking
+	//   while the game is paused, for r.NSS.StaticFrameSkip. The result is read once the GPU is done with it a few
+	//   frames later, so the most recent one read is returned and only ever vetoes the reuse.
+	//----------------------------------------------------------------------------------------------------------------
+	constexpr int32 MaxMotionReadbacks = 4;
+
+	TOptional<float> MeasureStaticFrameMotion(
+		FRDGBuilder& GraphBuilder, const FViewInfo& View, NSSState& State, const NSSPassInput& PassInputs)
+	{
+		TUniquePtr<FRHIGPUBufferReadback> FreeReadback;
+		while (State.MotionReadbacks.Num() > 0 && State.MotionReadbacks[0]->IsReady())
+		{
+			float MaxMotionPixels = 0.0f;
+			FMemory::Memcpy(&MaxMotionPixels, State.MotionReadbacks[0]->Lock(sizeof(float)), sizeof(float));
+			State.MotionReadbacks[0]->Unlock();
+			State.MaxMotionPixels = MaxMotionPixels;
+			FreeReadback = MoveTemp(State.MotionReadbacks[0]);
+			State.MotionReadbacks.RemoveAt(0);
+		}
+		if (State.MotionReadbacks.Num() >= MaxMotionReadbacks)
+		{
+			return State.MaxMotionPixels;
+		}
+
+		FRDGBufferRef MaxMotion = GraphBuilder.CreateBuffer(
+			FRDGBufferDesc::CreateBufferDesc(sizeof(uint32), 1), TEXT("ArmNssStaticFrameMaxMotion"));
+		FRDGBufferUAVRef MaxMotionUAV = GraphBuilder.CreateUAV(MaxMotion, PF_R32_UINT);
+		AddClearUAVPass(GraphBuilder, MaxMotionUAV, 0u);
+		const FIntRect InputViewRect = PassInputs.SceneVelocity.ViewRect;
+		FNssMotionReductionCS::FParameters* PassParameters =
+			GraphBuilder.AllocParameters<FNssMotionReductionCS::FParameters>();
+		PassParameters->InputVelocity = PassInputs.SceneVelocity.Texture;
+		PassParameters->InputViewMin = InputViewRect.Min;
+		PassParameters->InputViewSize = InputViewRect.Size();
+		PassParameters->OutMaxMotion = MaxMotionUAV;
+		TShaderMapRef<FNssMotionReductionCS> ComputeShader(View.ShaderMap);
+		FComputeShaderUtils::AddPass(GraphBuilder,
+			RDG_EVENT_NAME("ArmNss StaticFrameMotion (CS)"),
+			ComputeShader,
+			PassParameters,
+			FComputeShaderUtils::GetGroupCount(InputViewRect.Size(),
+				FIntPoint(FNssMotionReductionCS::ThreadgroupSizeX, FNssMotionReductionCS::ThreadgroupSizeY)));
+		if (!FreeReadback)
+		{
+			FreeReadback = MakeUnique<FRHIGPUBufferReadback>(TEXT("ArmNssStaticFrameMaxMotion"));
+		}
+		AddEnqueueCopyPass(GraphBuilder, FreeReadback.Get(), MaxMotion, sizeof(uint32));
+		State.MotionReadbacks.Add(MoveTemp(FreeReadback));
+		return State.MaxMotionPixels;
+	}
+
+#if NSS_PREVIEWS_ENABLED
+	//----------------------------------------------------------------------------------------------------------------
+	// Sparse tiles
+	//   Classifies the tiles of the padded inputs for r.NSS.SparseTiles against the features of the last frame's tiles
+	//   kept in its history. The counts of tiles are read back a few frames later, like the static frame motion.
+	//----------------------------------------------------------------------------------------------------------------
+	constexpr int32 MaxTileReadbacks = 4;
+
+	struct NSSSparseTileCounts
+	{
+		uint32 Changed = 0;
+		uint32 Active = 0;
+		uint32 Classified = 0;
+	};
+
+	// Returns this frame's tile features, which the next frame is compared with.
+	FRDGTextureRef AddSparseTilesPasses(FRDGBuilder& GraphBuilder,
+		NSSViewResourcePool& Resources,
+		const FViewInfo& View,
+		NSSState& State,
+		const NSSHistory* PrevHistory,
+		const FScreenPassTexture& PaddedInputColor,
+		const FScreenPassTexture& PaddedInputDepth,
+		FRDGTextureRef MotionVectorTexture,
+		FIntPoint PaddedInputSize,
+		NSSSparseTileCounts& OutCounts)
+	{
+		TUniquePtr<FRHIGPUBufferReadback> FreeReadback;
+		while (State.TileReadbacks.Num() > 0 && State.TileReadbacks[0]->IsReady())
+		{
+			const uint32* Counts = static_cast<const uint32*>(State.TileReadbacks[0]->Lock(3 * sizeof(uint32)));
+			OutCounts.Changed += Counts[0];
+			OutCounts.Active += Counts[1];
+			OutCounts.Classified += Counts[2];
+			State.TileReadbacks[0]->Unlock();
+			FreeReadback = MoveTemp(State.TileReadbacks[0]);
+			State.TileReadbacks.RemoveAt(0);
+		}
+
+		const int32 TileSize = FMath::Max(CVarNSSSparseTilesTileSize.GetValueOnRenderThread(), 8);
+		const FIntPoint NumTiles(FMath::DivideAndRoundUp(PaddedInputSize.X, TileSize),
+			FMath::DivideAndRoundUp(PaddedInputSize.Y, TileSize));
+		const bool bHasPrevious = PrevHistory && PrevHistory->TileFeatures.IsValid()
+								  && PrevHistory->TileFeatures->GetDesc().Extent == NumTiles;
+		FRDGTextureRef TileFeatures = NSS::CreatePooledTexture(GraphBuilder,
+			Resources,
+			FRDGTextureDesc::Create2D(NumTiles,
+				PF_A32B32G32R32F,
+				FClearValueBinding::None,
+				TexCreate_ShaderResource | TexCreate_UAV),
+			TEXT("ArmNssTileFeatures"),
+			false);
+		const FRDGTextureDesc MaskDesc = FRDGTextureDesc::Create2D(
+			NumTiles, PF_R8_UINT, FClearValueBinding::None, TexCreate_ShaderResource | TexCreate_UAV);
+		FRDGTextureRef Changed = GraphBuilder.CreateTexture(MaskDesc, TEXT("ArmNssChangedTiles"));
+		FRDGTextureRef Active = GraphBuilder.CreateTexture(MaskDesc, TEXT("ArmNssActiveTiles"));
+
+		FNssClassifyTilesCS::FParameters* ClassifyParameters =
+			GraphBuilder.AllocParameters<FNssClassifyTilesCS::FParameters>();
+		ClassifyParameters->InputColor = PaddedInputColor.Texture;
+		ClassifyParameters->InputDepth = PaddedInputDepth.Texture;
+		ClassifyParameters->InputMotionVectors = MotionVectorTexture;
+		ClassifyParameters->PrevFeatures = GSystemTextures.GetBlackDummy(GraphBuilder);
+		if (bHasPrevious)
+		{
+			ClassifyParameters->PrevFeatures = GraphBuilder.RegisterExternalTexture(PrevHistory->TileFeatures);
+		}
+		ClassifyParameters->InputColorMin = PaddedInputColor.ViewRect.Min;
+		ClassifyParameters->InputDepthMin = PaddedInputDepth.ViewRect.Min;
+		ClassifyParameters->PaddedSize = PaddedInputSize;
+		ClassifyParameters->TileSize = TileSize;
+		ClassifyParameters->bHasPrevious = bHasPrevious ? 1 : 0;
+		ClassifyParameters->MotionThresholdPixels = CVarNSSSparseTilesMotionThreshold.GetValueOnRenderThread();
+		ClassifyParameters->DepthThreshold = CVarNSSSparseTilesDepthThreshold.GetValueOnRenderThread();
+		ClassifyParameters->LumaThreshold = CVarNSSSparseTilesLumaThreshold.GetValueOnRenderThread();
+		ClassifyParameters->OutFeatures = GraphBuilder.CreateUAV(TileFeatures);
+		ClassifyParameters->OutChanged = GraphBuilder.CreateUAV(Changed);
+		TShaderMapRef<FNssClassifyTilesCS> ClassifyShader(View.ShaderMap);
+		FComputeShaderUtils::AddPass(GraphBuilder,
+			RDG_EVENT_NAME("ArmNss ClassifyTiles (CS) %dx%d", NumTiles.X, NumTiles.Y),
+			ClassifyShader,
+			ClassifyParameters,
+			FIntVector(NumTiles.X, NumTiles.Y, 1));
+
+		FRDGBufferRef TileCounts = GraphBuilder.CreateBuffer(
+			FRDGBufferDesc::CreateBufferDesc(sizeof(uint32), 3), TEXT("ArmNssSparseTileCounts"));
+		FRDGBufferUAVRef TileCountsUAV = GraphBuilder.CreateUAV(TileCounts, PF_R32_UINT);
+		AddClearUAVPass(GraphBuilder, TileCountsUAV, 0u);
+		FNssDilateTilesCS::FParameters* DilateParameters =
+			GraphBuilder.AllocParameters<FNssDilateTilesCS::FParameters>();
+		DilateParameters->Changed = Changed;
+		DilateParameters->NumTiles = NumTiles;
+		DilateParameters->HaloTiles = FMath::Max(CVarNSSSparseTilesHalo.GetValueOnRenderThread(), 0);
+		DilateParameters->OutActive = GraphBuilder.CreateUAV(Active);
+		DilateParameters->OutTileCounts = TileCountsUAV;
+		TShaderMapRef<FNssDilateTilesCS> DilateShader(View.ShaderMap);
+		FComputeShaderUtils::AddPass(GraphBuilder,
+			RDG_EVENT_NAME("ArmNss DilateTiles (CS)"),
+			DilateShader,
+			DilateParameters,
+			FComputeShaderUtils::GetGroupCount(
+				NumTiles, FIntPoint(FNssDilateTilesCS::ThreadgroupSizeX, FNssDilateTilesCS::ThreadgroupSizeY)));
+		if (State.TileReadbacks.Num() < MaxTileReadbacks)
+		{
+			if (!FreeReadback)
+			{
+				FreeReadback = MakeUnique<FRHIGPUBufferReadback>(TEXT("ArmNssSparseTileCounts"));
+			}
+			AddEnqueueCopyPass(GraphBuilder, FreeReadback.Get(), TileCounts, 3 * sizeof(uint32));
+			State.TileReadbacks.Add(MoveTemp(FreeReadback));
+		}
+
+		return TileFeatures;
+	}
+#endif
+}
+
+FRDGTextureRef NSS::CreatePooledTexture(FRDGBuilder& GraphBuilder,
+	NSSViewResourcePool& Resources,
+	const FRDGTextureDesc& Desc,
+	const TCHAR* Name,
+	bool bBucketExtent)
+{
+	check(Desc.IsTexture2D() && Desc.NumMips == 1 && Desc.NumSamples == 1 && Desc.ArraySize == 1);
+	NSSResourceKey Key;
+	Key.Extent = bBucketExtent
+					 ? GetBucketedExtent(Desc.Extent, CVarNSSResourcePoolBucketSize.GetValueOnRenderThread())
+					 : Desc.Extent;
+	Key.Format = Desc.Format;
+	Key.Flags = Desc.Flags;
+	TRefCountPtr<IPooledRenderTarget> RenderTarget = Resources.Acquire(Key,
+		GFrameCounterRenderThread,
+		[&Desc, Name](const NSSResourceKey& NewKey)
+		{
+			// Allocated outside of the engine's render target pool, which would otherwise also hold a reference.
+			FRDGTextureDesc PooledDesc = Desc;
+			PooledDesc.Extent = NewKey.Extent;
+			FTextureRHIRef Texture = RHICreateTexture(FRHITextureCreateDesc(PooledDesc, ERHIAccess::SRVMask, Name));
+			return CreateRenderTarget(Texture, Name);
+		});
+	return GraphBuilder.RegisterExternalTexture(RenderTarget, Name);
+}
+
+NSSResourcePoolStats NSS::GetResourcePoolStats() const
+{
+	return ViewResources.GetStats();
+}
+
+NSSGPUTimings NSS::GetGPUTimings() const
+{
+	return GPUTimer.GetLatestTimings();
+}
+
+void NSS::StartCapture(const FString& Path, int32 NumFrames, const NSSCaptureSettings& Settings)
+{
+	FrameCapture.Start(Path, NumFrames, Settings);
+}
+
+void NSS::SetRegionOfInterest(uint32 ViewID, const NSSRegionOfInterest& Region)
+{
+	FScopeLock Lock(&RegionsOfInterestMutex);
+	RegionsOfInterest.Add(ViewID, Region);
+}
+
+void NSS::ClearRegionOfInterest(uint32 ViewID)
+{
+	FScopeLock Lock(&RegionsOfInterestMutex);
+	RegionsOfInterest.Remove(ViewID);
+}
+
+NSSRegionOfInterest NSS::GetRegionOfInterest(uint32 ViewID) const
+{
+	{
+		FScopeLock Lock(&RegionsOfInterestMutex);
+		if (const NSSRegionOfInterest* Found = RegionsOfInterest.Find(ViewID))
+		{
+			return *Found;
+		}
+	}
+	NSSRegionOfInterest Region;
+	Region.Center = FVector2f(
+		CVarNSSROICenterX.GetValueOnRenderThread(), CVarNSSROICenterY.GetValueOnRenderThread());
+	Region.Radius = CVarNSSROIRadius.GetValueOnRenderThread();
+	Region.Feather = CVarNSSROIFeather.GetValueOnRenderThread();
+	return Region;
+}
+
+FRDGTextureRef NSS::RegisterMotionVectorTexture(
+	FRDGBuilder& GraphBuilder, NSSViewResourcePool& Resources, FIntPoint Extent)
+{
+	FRDGTextureDesc Desc = FRDGTextureDesc::Create2D(Extent,
+		PF_G16R16F,
+		FClearValueBinding::Transparent,
+		TexCreate_ShaderResource | TexCreate_UAV | TexCreate_RenderTargetable);
+	return CreatePooledTexture(GraphBuilder, Resources, Desc, TEXT("NSSMotionVectorTexture"));
 }
 
 INSS::FOutputs NSS::AddPasses(FRDGBuilder& GraphBuilder, const NSSView& SceneView, const NSSPassInput& PassInputs) const
 {
+	NSS_TRACE_SCOPE("NSS::AddPasses");
 	const FViewInfo& View = (FViewInfo&)(SceneView);
 	FGlobalShaderMap* ShaderMap = GetGlobalShaderMap(View.GetFeatureLevel());
 	FIntPoint InputExtents = View.ViewRect.Size();
@@ -377,10 +1382,20 @@ INSS::FOutputs NSS::AddPasses(FRDGBuilder& GraphBuilder, const NSSView& SceneVie
 
 	RDG_GPU_STAT_SCOPE(GraphBuilder, ArmNSSPass);
 	RDG_EVENT_SCOPE(GraphBuilder, "ArmNSSPass");
-	CurrentGraphBuilder = &GraphBuilder;
+	// Everything the view creates comes from its own pool, so views don't contend with each other.
+	NSSViewResourcePool& Resources =
+		ViewResources.FindOrAdd(View.ViewState ? View.ViewState->UniqueID : 0, GFrameCounterRenderThread);
 	bool bHistoryValid = View.PrevViewInfo.TemporalAAHistory.IsValid() && View.ViewState && !View.bCameraCut;
 	const bool CanWritePrevViewInfo = !View.bStatePrevViewInfoIsReadOnly && View.ViewState;
 	const bool bRenderDebugViews = CVarNSSDebug.GetValueOnRenderThread() == 1;
+	const bool bFusedInputPreparation = CVarNSSFusedInputPreparation.GetValueOnRenderThread() != 0;
+	const bool bZeroCopyInputs = CVarNSSZeroCopyInputs.GetValueOnRenderThread() != 0;
+	NSSGPUTimer* StageTimer = CVarNSSGPUTiming.GetValueOnRenderThread() != 0 ? &GPUTimer : nullptr;
+	if (StageTimer)
+	{
+		StageTimer->AddView(GFrameCounterRenderThread);
+	}
+	NSSInputPreparationStats InputPreparationStats;
 	ITemporalUpscaler::FOutputs Outputs;
 	// Note that the texture extent might be LARGER than the ViewRect, as in the editor it won't shrink the render
 	// target if the viewport is shrunk (as an optimisation presumably).
@@ -393,31 +1408,109 @@ INSS::FOutputs NSS::AddPasses(FRDGBuilder& GraphBuilder, const NSSView& SceneVie
 	//      545 pads to 552.
 	//      552 * 2 =  1104
 	//      1104 - 1090 = 14
-	FIntPoint PaddedInputSize = RoundUpToMultiple(PassInputs.SceneColor.ViewRect.Size(), 8);
+	// With dynamic resolution the ratio changes every frame so it is taken from the view instead.
+	const bool bDynamicResolutionContext = CVarNSSDynamicResolution.GetValueOnRenderThread() != 0;
+	const NSSContextSizes FrameSizes =
+		bDynamicResolutionContext
+			? GetNssDynamicResolutionFrameSizes(PassInputs.SceneColor.ViewRect.Size(), PassInputs.OutputViewRect.Size())
+			: GetNssContextSizes(PassInputs.SceneColor.ViewRect.Size(), UpscaleRatio);
+	FIntPoint PaddedInputSize = FrameSizes.PaddedInputSize;
 	FIntPoint PaddingOnInput = PaddedInputSize - PassInputs.SceneColor.ViewRect.Size();
-	FVector2d ScaledPaddedInputSizeF = FVector2d(PaddedInputSize) * UpscaleRatio;
-	FIntPoint PaddedOutputSize =
-		FIntPoint(FMath::RoundToInt(ScaledPaddedInputSizeF.X), FMath::RoundToInt(ScaledPaddedInputSizeF.Y));
+	FIntPoint PaddedOutputSize = FrameSizes.PaddedOutputSize;
 	FIntPoint PaddingOnOutput = PaddedOutputSize - PassInputs.OutputViewRect.Size();
+	TRefCountPtr<INSSCustomHistory> PrevCustomHistory = PassInputs.PrevHistory;
+	if (PrevCustomHistory.IsValid() && (PrevCustomHistory->GetDebugName() != GetDebugName()))
+	{
+		PrevCustomHistory.SafeRelease();
+	}
+	NSSHistory* CustomHistory = static_cast<NSSHistory*>(PrevCustomHistory.GetReference());
+	bool HasValidContext = CustomHistory && CustomHistory->GetState().IsValid();
+	//--------------------------------------------------------------------------------------------------------------
+	// Static Frames
+	//   With r.NSS.StaticFrameSkip a view of a paused world whose camera and jitter are still outputs its converged
+	//   history again in place of the dispatch, for up to r.NSS.StaticFrameSkip.MaxReuseFrames frames in a row. The
+	//   inputs aren't prepared and the context is left as it is. See NSSStaticFrameDetector.
+	//--------------------------------------------------------------------------------------------------------------
+	bool bReuseHistory = false;
+	if (CVarNSSStaticFrameSkip.GetValueOnRenderThread() != 0 && HasValidContext && !bRenderDebugViews
+		&& CustomHistory->GetState()->LastUsedFrame != GFrameCounterRenderThread)
+	{
+		NSSState& HistoryState = *CustomHistory->GetState();
+		NSSStaticFrameInputs StaticInputs;
+		StaticInputs.WorldToClip = View.ViewMatrices.GetViewMatrix() * View.ViewMatrices.GetProjectionNoAAMatrix();
+		StaticInputs.InputSize = PassInputs.SceneColor.ViewRect.Size();
+		StaticInputs.OutputSize = PassInputs.OutputViewRect.Size();
+		StaticInputs.PreExposure = View.PreExposure;
+		StaticInputs.JitterSequenceLength = View.TemporalJitterSequenceLength;
+		StaticInputs.bHistoryReset = !bHistoryValid;
+		StaticInputs.bWorldPaused = View.Family->bWorldIsPaused;
+		if (StaticInputs.bWorldPaused)
+		{
+			StaticInputs.MaxMotionPixels = MeasureStaticFrameMotion(GraphBuilder, View, HistoryState, PassInputs);
+		}
+		else
+		{
+			// The motion of a running world says nothing about the next pause.
+			HistoryState.MaxMotionPixels.Reset();
+		}
+		NSSStaticFrameSettings StaticSettings;
+		StaticSettings.ConvergeFrames = CVarNSSStaticFrameSkipConvergeFrames.GetValueOnRenderThread();
+		StaticSettings.MaxReuseFrames = CVarNSSStaticFrameSkipMaxReuseFrames.GetValueOnRenderThread();
+		bReuseHistory =
+			HistoryState.StaticFrameDetector.Update(StaticInputs, StaticSettings) == ENSSStaticFrameDecision::Reuse
+			&& CustomHistory->PaddedUpscaledColour.IsValid() && CustomHistory->PaddedDepth.IsValid()
+			&& CustomHistory->PaddedUpscaledColourSize == PaddedOutputSize;
+	}
+	ViewsUpscaled.fetch_add(1, std::memory_order_relaxed);
+	if (bReuseHistory)
+	{
+		ViewsReused.fetch_add(1, std::memory_order_relaxed);
+	}
 	// Copy the input scene color, depth and velocity textures and add padding around the edges if necessary
 	FScreenPassTexture PaddedInputColor = PassInputs.SceneColor;
 	FScreenPassTexture PaddedInputDepth = PassInputs.SceneDepth;
 	FScreenPassTexture PaddedInputVelocity = PassInputs.SceneVelocity;
-	if (PaddingOnInput != FIntPoint::ZeroValue)
+	FRDGTextureRef MotionVectorTexture = nullptr;
+	// Padding in place relies on the fused pass to mirror the velocity, which is never copied.
+	if (!bReuseHistory && (bFusedInputPreparation || bZeroCopyInputs))
+	{
+		RDG_GPU_STAT_SCOPE(GraphBuilder, ArmNSSInputPreparation);
+		NSSGPUStageScope StageScope(GraphBuilder, StageTimer, ENSSGPUStage::InputPreparation);
+		ENssInputPadding Padding = ENssInputPadding::None;
+		if (PaddingOnInput != FIntPoint::ZeroValue)
+		{
+			Padding = bZeroCopyInputs && CanPadInPlace(View, PassInputs, PaddedInputSize)
+						  ? ENssInputPadding::InPlace
+						  : ENssInputPadding::Copy;
+		}
+		MotionVectorTexture = RegisterMotionVectorTexture(GraphBuilder, Resources, PaddedInputSize);
+		AddPrepareInputsPass(GraphBuilder,
+			Resources,
+			View,
+			PassInputs,
+			PaddedInputSize,
+			Padding,
+			MotionVectorTexture,
+			PaddedInputColor,
+			PaddedInputDepth,
+			InputPreparationStats);
+	}
+	else if (!bReuseHistory && PaddingOnInput != FIntPoint::ZeroValue)
 	{
+		RDG_GPU_STAT_SCOPE(GraphBuilder, ArmNSSInputPreparation);
+		NSSGPUStageScope StageScope(GraphBuilder, StageTimer, ENSSGPUStage::InputPreparation);
 		FRDGTextureDesc ColorPaddedDesc = PassInputs.SceneColor.Texture->Desc;
 		ColorPaddedDesc.Extent = PassInputs.SceneColor.ViewRect.Size() + PaddingOnInput;
 		ColorPaddedDesc.Flags |= TexCreate_RenderTargetable;
-		PaddedInputColor.Texture = GraphBuilder.CreateTexture(
-			ColorPaddedDesc, TEXT("ArmNssPaddedInputSceneColor"), ERDGTextureFlags::MultiFrame);
-		// Note: the ViewRect on the output is the full texture, as we allocate one of the exact correct size
+		PaddedInputColor.Texture =
+			CreatePooledTexture(GraphBuilder, Resources, ColorPaddedDesc, TEXT("ArmNssPaddedInputSceneColor"));
+		// Note: the pooled texture may be larger than requested, the padded view is always at the origin
 		PaddedInputColor.ViewRect = FIntRect(FIntPoint::ZeroValue, ColorPaddedDesc.Extent);
 		FRDGTextureDesc VelocityPaddedDesc = PassInputs.SceneVelocity.Texture->Desc;
 		VelocityPaddedDesc.Extent = PassInputs.SceneVelocity.ViewRect.Size() + PaddingOnInput;
 		VelocityPaddedDesc.Flags |= TexCreate_RenderTargetable;
-		PaddedInputVelocity.Texture = GraphBuilder.CreateTexture(
-			VelocityPaddedDesc, TEXT("ArmNssPaddedInputSceneVelocity"), ERDGTextureFlags::MultiFrame);
-		// Note: the ViewRect on the output is the full texture, as we allocate one of the exact correct size
+		PaddedInputVelocity.Texture =
+			CreatePooledTexture(GraphBuilder, Resources, VelocityPaddedDesc, TEXT("ArmNssPaddedInputSceneVelocity"));
 		PaddedInputVelocity.ViewRect = FIntRect(FIntPoint::ZeroValue, VelocityPaddedDesc.Extent);
 		FRDGTextureDesc DepthPaddedDesc = PassInputs.SceneDepth.Texture->Desc;
 		DepthPaddedDesc.Format = PF_DepthStencil;
@@ -425,10 +1518,13 @@ INSS::FOutputs NSS::AddPasses(FRDGBuilder& GraphBuilder, const NSSView& SceneVie
 		DepthPaddedDesc.Flags = DepthPaddedDesc.Flags & ~TexCreate_UAV;
 		DepthPaddedDesc.Flags = DepthPaddedDesc.Flags & ~TexCreate_RenderTargetable;
 		DepthPaddedDesc.Flags |= TexCreate_DepthStencilTargetable;
-		PaddedInputDepth.Texture = GraphBuilder.CreateTexture(
-			DepthPaddedDesc, TEXT("ArmNssPaddedInputSceneDepth"), ERDGTextureFlags::MultiFrame);
-		// Note: the ViewRect on the output is the full texture, as we allocate one of the exact correct size
+		PaddedInputDepth.Texture =
+			CreatePooledTexture(GraphBuilder, Resources, DepthPaddedDesc, TEXT("ArmNssPaddedInputSceneDepth"));
 		PaddedInputDepth.ViewRect = FIntRect(FIntPoint::ZeroValue, DepthPaddedDesc.Extent);
+		InputPreparationStats.AddTexture(ColorPaddedDesc);
+		InputPreparationStats.AddTexture(VelocityPaddedDesc);
+		InputPreparationStats.AddTexture(DepthPaddedDesc);
+		InputPreparationStats.NumPasses++;
 		FNssMirrorPadPS::FParameters* PassParameters = GraphBuilder.AllocParameters<FNssMirrorPadPS::FParameters>();
 		PassParameters->InSceneColor =
 			GetScreenPassTextureInput(PassInputs.SceneColor, TStaticSamplerState<SF_Point>::GetRHI());
@@ -455,13 +1551,6 @@ INSS::FOutputs NSS::AddPasses(FRDGBuilder& GraphBuilder, const NSSView& SceneVie
 			TStaticDepthStencilState<true, CF_Always>::GetRHI());
 	}
 	NSSStateRef CurrentNSSState;
-	TRefCountPtr<INSSCustomHistory> PrevCustomHistory = PassInputs.PrevHistory;
-	if (PrevCustomHistory.IsValid() && (PrevCustomHistory->GetDebugName() != GetDebugName()))
-	{
-		PrevCustomHistory.SafeRelease();
-	}
-	NSSHistory* CustomHistory = static_cast<NSSHistory*>(PrevCustomHistory.GetReference());
-	bool HasValidContext = CustomHistory && CustomHistory->GetState().IsValid();
 	TRefCountPtr<NSSHistory> NewHistory;
 	//--------------------------------------------------------------------------------------------------------------
 	// Initialize the NSS Context
@@ -469,93 +1558,39 @@ INSS::FOutputs NSS::AddPasses(FRDGBuilder& GraphBuilder, const NSSView& SceneVie
 	//   context was created, tear down any existing contexts and create a new one matching the current frame.
 	//--------------------------------------------------------------------------------------------------------------
 	{
-		ffxApiCreateContextDescNss Params;
-		FMemory::Memzero(Params);
-		Params.header.type = FFX_API_CREATE_CONTEXT_DESC_TYPE_NSS;
 		//----------------------------------------------------------------------------------------------------------
 		// Describe the Current Frame
 		//   Collect the features of the current frame and the current NSS history,
 		//   so we can make decisions about whether any existing NSS context is currently usable.
 		//----------------------------------------------------------------------------------------------------------
-		// NSS settings
-		{
-			Params.flags = 0;
-			Params.flags |= FFX_API_NSS_CONTEXT_FLAG_QUANTIZED; // Currently we only support quantized model.
-			Params.flags |= bool(ERHIZBuffer::IsInverted) ? FFX_API_NSS_CONTEXT_FLAG_DEPTH_INVERTED : 0;
-			Params.flags |= FFX_API_NSS_CONTEXT_FLAG_HIGH_DYNAMIC_RANGE | FFX_API_NSS_CONTEXT_FLAG_DEPTH_INFINITE;
-#if !PLATFORM_WINDOWS
-			Params.flags |= FFX_API_NSS_CONTEXT_FLAG_ALLOW_16BIT;
-#endif
-			Params.flags |= FFX_API_NSS_CONTEXT_FLAG_READ_TENSORS_AS_IMAGES;
-			// Final resolution (upscaled)
-			Params.maxUpscaleSize.height = PaddedOutputSize.Y;
-			Params.maxUpscaleSize.width = PaddedOutputSize.X;
-			// Render resolution (downscaled)
-			Params.maxRenderSize.height = PaddedInputSize.Y;
-			Params.maxRenderSize.width = PaddedInputSize.X;
-#if DO_CHECK || DO_GUARD_SLOW || DO_ENSURE || WITH_EDITOR
-			Params.flags |= FFX_API_NSS_CONTEXT_FLAG_ENABLE_DEBUG_CHECKING;
-			// Register message callback
-			Params.fpMessage = &NSS::OnNSSMessage;
-#endif
-		}
-		// We want to reuse NSS states rather than recreating them wherever possible as they allocate significant
-		// memory for their internal resources.
-		// The current custom history is the ideal, but the recently released states can be reused with a simple
-		// reset too when the engine cuts the history. This reduces the memory churn imposed by camera cuts.
-		if (HasValidContext)
-		{
-			ffxApiCreateContextDescNss const& CurrentParams = CustomHistory->GetState()->Params;
-			if ((CustomHistory->GetState()->LastUsedFrame == GFrameCounterRenderThread)
-				|| IsNssContextParamsChanged(CurrentParams, Params))
-			{
-				HasValidContext = false;
-			}
-			else
-			{
-				CurrentNSSState = CustomHistory->GetState();
-			}
-		}
-		if (!HasValidContext)
+		NSSContextSizes ContextSizes = FrameSizes;
+		if (bDynamicResolutionContext)
 		{
-			FScopeLock Lock(&Mutex);
-			TSet<NSSStateRef> DisposeStates;
-			for (auto& State : AvailableStates)
-			{
-				ffxApiCreateContextDescNss const& CurrentParams = State->Params;
-				if ((State->LastUsedFrame == GFrameCounterRenderThread)
-					|| (View.ViewState && State->ViewID != View.ViewState->UniqueID))
-				{
-					// These states can't be reused immediately but perhaps a future frame,
-					// otherwise we break split screen.
-					continue;
-				}
-				else if (IsNssContextParamsChanged(CurrentParams, Params))
-				{
-					// States that can't be trivially reused need to just be released to save memory.
-					DisposeStates.Add(State);
-				}
-				else
-				{
-					CurrentNSSState = State;
-					HasValidContext = true;
-					bHistoryValid = false;
-					break;
-				}
-			}
-			for (auto& State : DisposeStates)
+			// A single context for the largest render size the view can use, which only follows changes of the bounds
+			// once they have settled.
+			const FIntPoint OutputSize = PassInputs.OutputViewRect.Size();
+			const float MaxResolutionFraction = FMath::Max(View.Family->GetPrimaryResolutionFractionUpperBound(),
+				QualityGovernorMaxFraction.load(std::memory_order_relaxed));
+			const FIntPoint MaxInputSize(FMath::CeilToInt(OutputSize.X * MaxResolutionFraction),
+				FMath::CeilToInt(OutputSize.Y * MaxResolutionFraction));
+			const NSSContextSizes TargetSizes =
+				GetNssDynamicResolutionContextSizes(MaxInputSize, OutputSize, GetMinUpsampleResolutionFraction());
+			NSSDynamicResolutionSettings Settings;
+			Settings.Headroom = CVarNSSDynamicResolutionHeadroom.GetValueOnRenderThread();
+			Settings.ResizeDelayFrames = CVarNSSDynamicResolutionResizeDelayFrames.GetValueOnRenderThread();
+			NSSState* HistoryState = HasValidContext ? CustomHistory->GetState().GetReference() : nullptr;
+			int32 FramesOutOfBounds = HistoryState ? HistoryState->FramesOutOfBounds : 0;
+			ContextSizes = UpdateNssDynamicResolutionContextSizes(
+				HistoryState ? GetNssContextSizes(HistoryState->Params) : NSSContextSizes(),
+				FrameSizes,
+				TargetSizes,
+				Settings,
+				FramesOutOfBounds);
+			if (HistoryState)
 			{
-				AvailableStates.Remove(State);
+				HistoryState->FramesOutOfBounds = FramesOutOfBounds;
 			}
 		}
-		if (!HasValidContext)
-		{
-			// For a new context, allocate the necessary scratch memory for the chosen backend
-			CurrentNSSState = new NSSState(ApiAccessor);
-		}
-		check(CurrentNSSState);
-		CurrentNSSState->LastUsedFrame = GFrameCounterRenderThread;
-		CurrentNSSState->ViewID = View.ViewState->UniqueID;
 		//----------------------------------------------------------------------------------------------------------
 		// Update History Data (Part 1)
 		//   Prepare the view to receive this frame's history data.
@@ -568,88 +1603,105 @@ INSS::FOutputs NSS::AddPasses(FRDGBuilder& GraphBuilder, const NSSView& SceneVie
 			View.ViewState->PrevFrameViewInfo.TemporalAAHistory.SafeRelease();
 			View.ViewState->PrevFrameViewInfo.TemporalAAHistory.ViewportRect =
 				FIntRect(0, 0, OutputExtents.X, OutputExtents.Y);
-			View.ViewState->PrevFrameViewInfo.TemporalAAHistory.ReferenceBufferSize = OutputExtents;
 		}
-		NewHistory = new NSSHistory(CurrentNSSState, const_cast<NSS*>(this));
-		check(NewHistory);
-
-		//----------------------------------------------------------------------------------------------------------
-		// Invalidate NSS Contexts
-		//   If a context already exists but it is not valid for the current frame's features, clean it up in
-		//   preparation for creating a new one.
-		//----------------------------------------------------------------------------------------------------------
-		if (HasValidContext)
+		if (bReuseHistory)
 		{
-			ffxApiCreateContextDescNss const& CurrentParams = CurrentNSSState->Params;
-			// Display size must match for splitscreen to work.
-			if (IsNssContextParamsChanged(CurrentParams, Params))
-			{
-				ApiAccessor->ffxDestroyContext(&CurrentNSSState->Nss);
-				HasValidContext = false;
-				bHistoryValid = false;
-			}
+			// The network doesn't run, so the context is kept as it is even if it no longer matches the frame.
+			CurrentNSSState = CustomHistory->GetState();
+			CurrentNSSState->LastUsedFrame = GFrameCounterRenderThread;
+		}
+		else
+		{
+			CurrentNSSState = AcquireState(ContextSizes,
+				HasValidContext ? CustomHistory : nullptr,
+				View.ViewState->UniqueID,
+				GFrameCounterRenderThread,
+				bHistoryValid);
 		}
-		//------------------------------------------------------
-		// Create NSS Contexts
-		//   If no valid context currently exists, create one.
-		//------------------------------------------------------
-		if (!HasValidContext)
+		if (!CurrentNSSState)
 		{
-			FfxErrorCode ErrorCode = ApiAccessor->ffxCreateContext(&CurrentNSSState->Nss, &Params.header);
-			check(ErrorCode == FFX_OK);
-			if (ErrorCode != FFX_OK)
+			return BlankOutput(GraphBuilder, PassInputs);
+		}
+		NewHistory = new NSSHistory(CurrentNSSState, const_cast<NSS*>(this));
+		check(NewHistory);
+	}
+	//--------------------------------------------------------------------------------------------------------------
+	// Cross-Eye Reuse
+	//   With r.NSS.XR.CrossEyeReuse the secondary eye of a stereo pair only runs the network on one frame in
+	//   r.NSS.XR.SecondaryEyeInterval, and has the primary eye's output of the frame reprojected into it otherwise.
+	//   The eyes have their own contexts as usual. The SDK's temporal state in the secondary eye's context misses
+	//   the reprojected frames, so the dispatch that follows them resets it rather than carrying on from inputs and
+	//   an output history that it hasn't seen.
+	//--------------------------------------------------------------------------------------------------------------
+	const bool bCrossEyeReuse = CVarNSSXRCrossEyeReuse.GetValueOnRenderThread() != 0
+								&& IStereoRendering::IsStereoEyeView(View) && !bRenderDebugViews;
+	TOptional<NSSStereoPrimaryEye> PrimaryEye;
+	if (bCrossEyeReuse && bHistoryValid && !bReuseHistory && IStereoRendering::IsASecondaryView(View)
+		&& CurrentNSSState->FramesReprojected + 1 < CVarNSSXRSecondaryEyeInterval.GetValueOnRenderThread())
+	{
+		const FViewInfo* PrimaryView = View.GetPrimaryView();
+		if (PrimaryView && PrimaryView != &View && PrimaryView->ViewState)
+		{
+			FScopeLock Lock(&StereoMutex);
+			const NSSStereoPrimaryEye* Found = StereoPrimaryEyes.Find(PrimaryView->ViewState->UniqueID);
+			// The primary eye must have been upscaled to the same size earlier in this graph.
+			if (Found && Found->GraphBuilder == &GraphBuilder && Found->Frame == GFrameCounterRenderThread
+				&& Found->InputSize == PassInputs.SceneColor.ViewRect.Size()
+				&& Found->OutputSize == PassInputs.OutputViewRect.Size())
 			{
-				return BlankOutput(GraphBuilder, PassInputs);
+				PrimaryEye = *Found;
 			}
-			HasValidContext = true;
-			bHistoryValid = false;
-			FMemory::Memcpy(CurrentNSSState->Params, Params);
 		}
 	}
+	const bool bResumeAfterReprojection = !PrimaryEye.IsSet() && CurrentNSSState->FramesReprojected > 0;
+	CurrentNSSState->FramesReprojected = PrimaryEye.IsSet() ? CurrentNSSState->FramesReprojected + 1 : 0;
 	//--------------------------------------------------------------------------------------------------------------
 	// Organize Inputs (Part 1)
 	//   Some inputs NSS requires are available now, but will no longer be directly available once we get inside
 	//   the RenderGraph.  Go ahead and collect the ones we can.
 	//--------------------------------------------------------------------------------------------------------------
-	ffxApiDispatchDescNss NssDispatchParams = {};
+	NSSDispatchFrameParams DispatchFrame;
+	DispatchFrame.PaddedInputSize = PaddedInputSize;
+	DispatchFrame.PaddedOutputSize = PaddedOutputSize;
+	DispatchFrame.JitterPixels = FVector2f(PassInputs.TemporalJitterPixels);
+	// Whether to abandon the history in the state on camera cuts, or after reprojected frames
+	DispatchFrame.bReset = !bHistoryValid || bResumeAfterReprojection;
+	if (DispatchFrame.bReset)
 	{
-		NssDispatchParams.header.type = FFX_API_DISPATCH_DESC_TYPE_NSS;
-		NssDispatchParams.flags = 0;
-		NssDispatchParams.flags |= bRenderDebugViews ? FFX_API_NSS_DISPATCH_FLAG_DRAW_DEBUG_VIEW : 0;
-		// Whether to abandon the history in the state on camera cuts
-		NssDispatchParams.reset = !bHistoryValid;
-		NssDispatchParams.frameTimeDelta = View.Family->Time.GetDeltaWorldTimeSeconds() * 1000.f;
-		// Reference shaders use subtraction of jitter and it's in input resolution units, instead of UV units.
-		NssDispatchParams.jitterOffset.x = -PassInputs.TemporalJitterPixels.X;
-		NssDispatchParams.jitterOffset.y = -PassInputs.TemporalJitterPixels.Y;
-		NssDispatchParams.renderSize.width = PaddedInputSize.X;
-		NssDispatchParams.renderSize.height = PaddedInputSize.Y;
-		NssDispatchParams.upscaleSize.width = PaddedOutputSize.X;
-		NssDispatchParams.upscaleSize.height = PaddedOutputSize.Y;
-		// Parameters for motion vectors:
-		NssDispatchParams.motionVectorScale.x = PaddedInputSize.X;
-		NssDispatchParams.motionVectorScale.y = PaddedInputSize.Y;
-		NssDispatchParams.cameraFovAngleVertical = View.ViewMatrices.ComputeHalfFieldOfViewPerAxis().Y * 2.0f;
-		if (bool(ERHIZBuffer::IsInverted))
-		{
-			NssDispatchParams.cameraNear = FLT_MAX;
-			NssDispatchParams.cameraFar = View.ViewMatrices.ComputeNearPlane();
-		}
-		else
-		{
-			NssDispatchParams.cameraNear = View.ViewMatrices.ComputeNearPlane();
-			NssDispatchParams.cameraFar = FLT_MAX;
-		}
+		NSS_TRACE_COUNT(HistoryReset);
 	}
+	DispatchFrame.FrameTimeDeltaSeconds = View.Family->Time.GetDeltaWorldTimeSeconds();
+	DispatchFrame.FovAngleVertical = View.ViewMatrices.ComputeHalfFieldOfViewPerAxis().Y * 2.0f;
+	DispatchFrame.NearPlane = View.ViewMatrices.ComputeNearPlane();
+	DispatchFrame.bDebugViews = bRenderDebugViews;
+	const ffxApiDispatchDescNss NssDispatchParams = MakeDispatchParams(DispatchFrame);
 	//------------------------------
 	// Add NSS to the RenderGraph
 	//------------------------------
 	FRDGTextureDesc PaddedOutputColorDesc = PassInputs.SceneColor.Texture->Desc;
-	PaddedOutputColorDesc.Extent = PaddedOutputSize;
-	PaddedOutputColorDesc.Flags = TexCreate_ShaderResource | TexCreate_UAV;
+	// The output is allocated at the context's upscale size and this frame's padded output is at its origin, so that
+	// a dynamic resolution context keeps one output and history extent while the padding changes from frame to frame.
+	PaddedOutputColorDesc.Extent =
+		GetNssContextSizes(CurrentNSSState->Params).PaddedOutputSize.ComponentMax(PaddedOutputSize);
+	// Render targetable as this may be handed downstream as the scene colour rather than a cropped copy.
+	PaddedOutputColorDesc.Flags = TexCreate_ShaderResource | TexCreate_UAV | TexCreate_RenderTargetable;
 	PaddedOutputColorDesc.Format = EPixelFormat::PF_FloatR11G11B10;
-	FRDGTextureRef PaddedOutputColor = GraphBuilder.CreateTexture(
-		PaddedOutputColorDesc, TEXT("ArmNSSPaddedOutputSceneColor"), ERDGTextureFlags::MultiFrame);
+	if (CanWritePrevViewInfo)
+	{
+		// The history is the padded output, with the padding outside of the viewport.
+		View.ViewState->PrevFrameViewInfo.TemporalAAHistory.ReferenceBufferSize = PaddedOutputColorDesc.Extent;
+	}
+	// The output isn't bucketed: the SDK's history must match the context's upscale size exactly.
+	FRDGTextureRef PaddedOutputColor = nullptr;
+	if (bReuseHistory)
+	{
+		PaddedOutputColor = GraphBuilder.RegisterExternalTexture(CustomHistory->PaddedUpscaledColour);
+	}
+	else
+	{
+		PaddedOutputColor = CreatePooledTexture(
+			GraphBuilder, Resources, PaddedOutputColorDesc, TEXT("ArmNSSPaddedOutputSceneColor"), false);
+	}
 	NSSPass::FParameters* PassParameters = GraphBuilder.AllocParameters<NSSPass::FParameters>();
 	PassParameters->ColorTexture = PaddedInputColor.Texture;
 	PassParameters->DepthTexture = PaddedInputDepth.Texture;
@@ -659,7 +1711,7 @@ INSS::FOutputs NSS::AddPasses(FRDGBuilder& GraphBuilder, const NSSView& SceneVie
 	if (bRenderDebugViews)
 	{
 		DebugViews =
-			GraphBuilder.CreateTexture(PaddedOutputColorDesc, TEXT("ArmNSSDebugViews"), ERDGTextureFlags::MultiFrame);
+			CreatePooledTexture(GraphBuilder, Resources, PaddedOutputColorDesc, TEXT("ArmNSSDebugViews"), false);
 		PassParameters->DebugViewsTexture = GraphBuilder.CreateUAV(DebugViews);
 	}
 	else
@@ -684,27 +1736,67 @@ INSS::FOutputs NSS::AddPasses(FRDGBuilder& GraphBuilder, const NSSView& SceneVie
 	}
 	auto* ApiAccess = ApiAccessor;
 	auto CurrentApi = Api;
-	if (CurrentApi == EFFXBackendAPI::Vulkan)
+	bool bDispatched = false;
+	if (bReuseHistory)
+	{
+		// The history is the output, see Static Frames above.
+		INC_DWORD_STAT(STAT_NSS_StaticFramesReused);
+		CSV_CUSTOM_STAT(NSS, StaticFramesReused, 1, ECsvCustomStatOp::Accumulate);
+	}
+	else if (PrimaryEye.IsSet())
+	{
+		//------------------------------------------------------------------------------------------------------
+		// Stereo Reprojection
+		//   In place of the dispatch: the primary eye's output where it sees the same surfaces, and this eye's own
+		//   render where it doesn't.
+		//------------------------------------------------------------------------------------------------------
+		RDG_GPU_STAT_SCOPE(GraphBuilder, ArmNSSStereoReproject);
+		const FMatrix SecondaryClipToWorld =
+			View.ViewMatrices.ComputeInvProjectionNoAAMatrix() * View.ViewMatrices.GetInvViewMatrix();
+		const FIntPoint PrimaryOutputExtent = PrimaryEye->Output->Desc.Extent;
+		const FIntPoint SecondaryColorExtent = PaddedInputColor.Texture->Desc.Extent;
+		FNssStereoReprojectPS::FParameters* ReprojectParameters =
+			GraphBuilder.AllocParameters<FNssStereoReprojectPS::FParameters>();
+		ReprojectParameters->PrimaryOutput = PrimaryEye->Output;
+		ReprojectParameters->PrimaryDepth = PrimaryEye->Depth;
+		ReprojectParameters->SecondaryColor = PaddedInputColor.Texture;
+		ReprojectParameters->SecondaryDepth = PaddedInputDepth.Texture;
+		ReprojectParameters->LinearSampler = TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp>::GetRHI();
+		ReprojectParameters->InputViewSize = PassInputs.SceneColor.ViewRect.Size();
+		ReprojectParameters->OutputViewSize = PassInputs.OutputViewRect.Size();
+		ReprojectParameters->PrimaryDepthMin = PrimaryEye->DepthViewRect.Min;
+		ReprojectParameters->SecondaryDepthMin = PaddedInputDepth.ViewRect.Min;
+		ReprojectParameters->SecondaryColorMin = PaddedInputColor.ViewRect.Min;
+		ReprojectParameters->InvPrimaryOutputExtent =
+			FVector2f(1.0f / float(PrimaryOutputExtent.X), 1.0f / float(PrimaryOutputExtent.Y));
+		ReprojectParameters->InvSecondaryColorExtent =
+			FVector2f(1.0f / float(SecondaryColorExtent.X), 1.0f / float(SecondaryColorExtent.Y));
+		ReprojectParameters->SecondaryClipToPrimaryClip = FMatrix44f(SecondaryClipToWorld * PrimaryEye->WorldToClip);
+		ReprojectParameters->DisocclusionThreshold = CVarNSSXRDisocclusionThreshold.GetValueOnRenderThread();
+		ReprojectParameters->RenderTargets[0] =
+			FRenderTargetBinding(PaddedOutputColor, ERenderTargetLoadAction::ENoAction);
+		TShaderMapRef<FNssStereoReprojectPS> ReprojectShader(ShaderMap);
+		FPixelShaderUtils::AddFullscreenPass(GraphBuilder,
+			ShaderMap,
+			RDG_EVENT_NAME("ArmNss stereo reproject"),
+			ReprojectShader,
+			ReprojectParameters,
+			FIntRect(FIntPoint::ZeroValue, PaddedOutputSize));
+		INC_DWORD_STAT(STAT_NSS_ReprojectedEyes);
+		CSV_CUSTOM_STAT(NSS, ReprojectedEyes, 1, ECsvCustomStatOp::Accumulate);
+	}
+	else if (CurrentApi == EFFXBackendAPI::Vulkan || CurrentApi == EFFXBackendAPI::CPU)
 	{
 		//------------------------------------------------------------------------------------------------------
 		// Consolidate Motion Vectors
 		//   UE4 motion vectors are in sparse format by default.  Convert them to a format consumable by NSS.
+		//   The fused input preparation pass has already done this.
 		//------------------------------------------------------------------------------------------------------
-		if (!IsValidRef(MotionVectorRT) || MotionVectorRT->GetDesc().Extent.X != PaddedInputSize.X
-			|| MotionVectorRT->GetDesc().Extent.Y != PaddedInputSize.Y)
-		{
-			ETextureCreateFlags DescFlags = TexCreate_ShaderResource | TexCreate_UAV | TexCreate_RenderTargetable;
-			FPooledRenderTargetDesc Desc(FPooledRenderTargetDesc::Create2DDesc(PaddedInputSize,
-				PF_G16R16F,
-				FClearValueBinding::Transparent,
-				DescFlags,
-				TexCreate_ShaderResource | TexCreate_UAV | TexCreate_RenderTargetable,
-				false));
-			GRenderTargetPool.FindFreeElement(
-				GraphBuilder.RHICmdList, Desc, MotionVectorRT, TEXT("NSSMotionVectorTexture"));
-		}
-		FRDGTextureRef MotionVectorTexture = GraphBuilder.RegisterExternalTexture(MotionVectorRT);
+		if (!MotionVectorTexture)
 		{
+			RDG_GPU_STAT_SCOPE(GraphBuilder, ArmNSSInputPreparation);
+			NSSGPUStageScope StageScope(GraphBuilder, StageTimer, ENSSGPUStage::InputPreparation);
+			MotionVectorTexture = RegisterMotionVectorTexture(GraphBuilder, Resources, PaddedInputSize);
 			FNssConvertVelocity::FParameters* MvPassParameters =
 				GraphBuilder.AllocParameters<FNssConvertVelocity::FParameters>();
 			FRDGTextureUAVDesc OutputDesc(MotionVectorTexture);
@@ -726,15 +1818,32 @@ INSS::FOutputs NSS::AddPasses(FRDGBuilder& GraphBuilder, const NSSView& SceneVie
 				ConvertVelocityShader,
 				MvPassParameters,
 				PaddedInputVelocity.ViewRect);
+			InputPreparationStats.NumPasses++;
 		}
 		PassParameters->VelocityTexture = MotionVectorTexture;
 		PassParameters->ExposureValue = View.PreExposure;
-		GraphBuilder.AddPass(RDG_EVENT_NAME("ArmNG NSS (VK backend)"),
+		bDispatched = true;
+		RDG_GPU_STAT_SCOPE(GraphBuilder, ArmNSSDispatch);
+		NSSGPUStageScope StageScope(GraphBuilder, StageTimer, ENSSGPUStage::Dispatch);
+		const bool bFlushAfterDispatch = CVarNSSFlushAfterDispatch.GetValueOnRenderThread() != 0;
+		GraphBuilder.AddPass(
+			RDG_EVENT_NAME("ArmNG NSS (%s backend)", CurrentApi == EFFXBackendAPI::CPU ? TEXT("CPU") : TEXT("VK")),
 			PassParameters,
 			ERDGPassFlags::Compute | ERDGPassFlags::Raster | ERDGPassFlags::SkipRenderPass,
-			[&View, &PassInputs, CurrentApi, ApiAccess, PassParameters, NssDispatchParams, CurrentNSSState](
-				FRHICommandListImmediate& RHICmdList)
+			[&View,
+				&PassInputs,
+				CurrentApi,
+				ApiAccess,
+				PassParameters,
+				NssDispatchParams,
+				CurrentNSSState,
+				StageTimer,
+				bFlushAfterDispatch,
+				Frame = GFrameCounterRenderThread](FRHICommandListImmediate& RHICmdList)
 			{
+				// The render thread time spent recording the dispatch, including any flush.
+				SCOPE_CYCLE_COUNTER(STAT_NSS_DispatchRecording);
+				CSV_SCOPED_TIMING_STAT(NSS, DispatchRecording);
 				ffxApiDispatchDescNss DispatchParams = NssDispatchParams;
 				DispatchParams.color = ApiAccess->GetNativeResource(
 					PassParameters->ColorTexture->GetRHI(), FFX_API_RESOURCE_STATE_COMPUTE_READ);
@@ -763,28 +1872,166 @@ INSS::FOutputs NSS::AddPasses(FRDGBuilder& GraphBuilder, const NSSView& SceneVie
 				}
 				ApiAccess->ForceUAVTransition(
 					RHICmdList, PassParameters->OutputTexture->GetParentRHI(), ERHIAccess::UAVMask);
-				RHICmdList.EnqueueLambda(
-					[ApiAccess, CurrentNSSState, DispatchParams](FRHICommandListImmediate& cmd) mutable
+				// Recorded in order with the surrounding RHI commands when the RHI thread gets to it, so the render
+				// thread doesn't have to wait for the RHI thread.
+				ApiAccess->EnqueueNativeCommands(RHICmdList,
+					[ApiAccess, CurrentNSSState, DispatchParams, StageTimer, Frame](FfxCommandList CommandList) mutable
 					{
-						DispatchParams.commandList = ApiAccess->GetNativeCommandBuffer(cmd, nullptr);
+						DispatchParams.commandList = CommandList;
 						const auto Code = ApiAccess->ffxDispatch(&CurrentNSSState->Nss, &DispatchParams.header);
 						check(Code == FFX_OK);
+						NGSharedDispatchTimings DispatchTimings;
+						if (StageTimer && ApiAccess->GetDispatchTimings(&CurrentNSSState->Nss, DispatchTimings))
+						{
+							StageTimer->AddDispatchTimings(Frame, DispatchTimings);
+						}
 					});
-				RHICmdList.ImmediateFlush(EImmediateFlushType::DispatchToRHIThread);
+				if (bFlushAfterDispatch)
+				{
+					RHICmdList.ImmediateFlush(EImmediateFlushType::DispatchToRHIThread);
+				}
 			});
+		//------------------------------------------------------------------------------------------------------
+		// Capture
+		//   Reads back exactly what the dispatch was given, when r.NSS.Capture is recording this view.
+		//------------------------------------------------------------------------------------------------------
+		if (View.ViewState && FrameCapture.ShouldCapture(View.ViewState->UniqueID))
+		{
+			NSSReplayFrame CaptureFrame;
+			CaptureFrame.InputSize = PassInputs.SceneColor.ViewRect.Size();
+			CaptureFrame.OutputSize = PassInputs.OutputViewRect.Size();
+			CaptureFrame.InputViewRect = PassInputs.SceneColor.ViewRect;
+			CaptureFrame.OutputViewRect = PassInputs.OutputViewRect;
+			CaptureFrame.JitterPixels = DispatchFrame.JitterPixels;
+			CaptureFrame.PreExposure = View.PreExposure;
+			CaptureFrame.bCameraCut = DispatchFrame.bReset;
+			CaptureFrame.FrameTimeDeltaSeconds = DispatchFrame.FrameTimeDeltaSeconds;
+			CaptureFrame.FovAngleVertical = DispatchFrame.FovAngleVertical;
+			CaptureFrame.NearPlane = DispatchFrame.NearPlane;
+			CaptureFrame.bPrepared = true;
+			const bool bCaptureHistory = !DispatchFrame.bReset && CustomHistory != nullptr
+										 && CustomHistory->PaddedUpscaledColour.IsValid()
+										 && CustomHistory->PaddedDepth.IsValid();
+			const FRDGTextureRef CaptureTextures[] = {PassParameters->ColorTexture.GetTexture(),
+				PassParameters->DepthTexture.GetTexture(),
+				PassParameters->VelocityTexture.GetTexture(),
+				bCaptureHistory ? PassParameters->OutputTm1Texture.GetTexture() : nullptr,
+				bCaptureHistory ? PassParameters->DepthTm1Texture.GetTexture() : nullptr};
+			const FIntRect CaptureRects[] = {
+				FIntRect(PaddedInputColor.ViewRect.Min, PaddedInputColor.ViewRect.Min + PaddedInputSize),
+				FIntRect(PaddedInputDepth.ViewRect.Min, PaddedInputDepth.ViewRect.Min + PaddedInputSize),
+				FIntRect(FIntPoint::ZeroValue, PaddedInputSize),
+				bCaptureHistory ? FIntRect(FIntPoint::ZeroValue, CustomHistory->PaddedUpscaledColourSize) : FIntRect(),
+				bCaptureHistory ? CustomHistory->PaddedDepthViewRect : FIntRect()};
+			FrameCapture.AddFrame(GraphBuilder, MoveTemp(CaptureFrame), CaptureTextures, CaptureRects);
+		}
+	}
+
+	//--------------------------------------------------------------------------------------------------------------
+	// Sparse Tiles
+	//   With r.NSS.SparseTiles the tiles whose motion, depth or luma changed are found and counted, with a halo
+	//   of active tiles around them that the network would have to run on. The SDK dispatches the whole frame,
+	//   so this only measures the potential saving, at a cost, and isn't in shipping builds.
+	//--------------------------------------------------------------------------------------------------------------
+	FRDGTextureRef TileFeatures = nullptr;
+#if NSS_PREVIEWS_ENABLED
+	if (!bRenderDebugViews && CVarNSSSparseTiles.GetValueOnRenderThread() != 0 && bDispatched)
+	{
+		NSSSparseTileCounts TileCounts;
+		TileFeatures = AddSparseTilesPasses(GraphBuilder,
+			Resources,
+			View,
+			*CurrentNSSState,
+			bHistoryValid ? CustomHistory : nullptr,
+			PaddedInputColor,
+			PaddedInputDepth,
+			MotionVectorTexture,
+			PaddedInputSize,
+			TileCounts);
+		TilesChanged.fetch_add(TileCounts.Changed, std::memory_order_relaxed);
+		TilesActive.fetch_add(TileCounts.Active, std::memory_order_relaxed);
+		TilesClassified.fetch_add(TileCounts.Classified, std::memory_order_relaxed);
+	}
+#endif
+
+	//--------------------------------------------------------------------------------------------------------------
+	// Region of Interest
+	//   With r.NSS.ROI the output keeps the network's output within the view's region of interest only, and has a
+	//   bilinear upscale of the render in the periphery, blended in across the region's feathered edge. The SDK
+	//   dispatches the whole frame, so this only previews the result of running the network on the region, at a
+	//   cost, and isn't in shipping builds. The share of the output the region covers is reported. The history keeps
+	//   the whole of the network's output.
+	//--------------------------------------------------------------------------------------------------------------
+	FRDGTextureRef FinalOutputColor = PaddedOutputColor;
+#if NSS_PREVIEWS_ENABLED
+	if (CVarNSSROI.GetValueOnRenderThread() != 0 && bDispatched && !bRenderDebugViews)
+	{
+		RDG_GPU_STAT_SCOPE(GraphBuilder, ArmNSSRegionOfInterest);
+		const NSSRegionOfInterest Region = GetRegionOfInterest(View.ViewState->UniqueID);
+		const FIntPoint OutputViewSize = PassInputs.OutputViewRect.Size();
+		const FIntPoint InputColorExtent = PaddedInputColor.Texture->Desc.Extent;
+		FinalOutputColor = CreatePooledTexture(
+			GraphBuilder, Resources, PaddedOutputColorDesc, TEXT("ArmNSSRegionOfInterestOutput"), false);
+		FNssRegionOfInterestPS::FParameters* RegionParameters =
+			GraphBuilder.AllocParameters<FNssRegionOfInterestPS::FParameters>();
+		RegionParameters->NetworkOutput = PaddedOutputColor;
+		RegionParameters->InputColor = PaddedInputColor.Texture;
+		RegionParameters->LinearSampler = TStaticSamplerState<SF_Bilinear, AM_Clamp, AM_Clamp>::GetRHI();
+		RegionParameters->InputViewSize = PassInputs.SceneColor.ViewRect.Size();
+		RegionParameters->OutputViewSize = OutputViewSize;
+		RegionParameters->InputColorMin = PaddedInputColor.ViewRect.Min;
+		RegionParameters->InvInputColorExtent =
+			FVector2f(1.0f / float(InputColorExtent.X), 1.0f / float(InputColorExtent.Y));
+		RegionParameters->RegionCenter = Region.Center;
+		RegionParameters->RegionRadius = Region.Radius;
+		RegionParameters->RegionFeather = Region.Feather;
+		RegionParameters->RenderTargets[0] = FRenderTargetBinding(FinalOutputColor, ERenderTargetLoadAction::ENoAction);
+		TShaderMapRef<FNssRegionOfInterestPS> RegionShader(ShaderMap);
+		FPixelShaderUtils::AddFullscreenPass(GraphBuilder,
+			ShaderMap,
+			RDG_EVENT_NAME("ArmNss region of interest"),
+			RegionShader,
+			RegionParameters,
+			FIntRect(FIntPoint::ZeroValue, PaddedOutputSize));
+		RegionOfInterestTexels.fetch_add(
+			NSSReference::CountRegionOfInterestTexels(Region, OutputViewSize), std::memory_order_relaxed);
+		RegionOfInterestViewTexels.fetch_add(OutputViewSize.X * OutputViewSize.Y, std::memory_order_relaxed);
+	}
+#endif
+
+	// Kept for the secondary eye, which is upscaled after this one.
+	if (bCrossEyeReuse && IStereoRendering::IsAPrimaryView(View) && View.ViewState)
+	{
+		NSSStereoPrimaryEye Eye;
+		Eye.GraphBuilder = &GraphBuilder;
+		Eye.Frame = GFrameCounterRenderThread;
+		Eye.InputSize = PassInputs.SceneColor.ViewRect.Size();
+		Eye.OutputSize = PassInputs.OutputViewRect.Size();
+		Eye.Output = PaddedOutputColor;
+		Eye.Depth = PaddedInputDepth.Texture;
+		Eye.DepthViewRect = PaddedInputDepth.ViewRect;
+		Eye.WorldToClip = View.ViewMatrices.GetViewMatrix() * View.ViewMatrices.GetProjectionNoAAMatrix();
+		FScopeLock Lock(&StereoMutex);
+		StereoPrimaryEyes.Add(View.ViewState->UniqueID, Eye);
 	}
 
 	if (bRenderDebugViews)
 	{
 		// Output Debug Views
-		Outputs.FullRes = CopyAndCropIfNeeded(
-			GraphBuilder, FScreenPassTexture(DebugViews), PaddingOnOutput, TEXT("ArmNssOutputDebugViews"));
+		Outputs.FullRes = CopyAndCropIfNeeded(GraphBuilder,
+			FScreenPassTexture(DebugViews, FIntRect(FIntPoint::ZeroValue, PaddedOutputSize)),
+			PaddingOnOutput,
+			TEXT("ArmNssOutputDebugViews"),
+			StageTimer);
 	}
 	else
 	{
 		// Output Final Colour
-		Outputs.FullRes = CopyAndCropIfNeeded(
-			GraphBuilder, FScreenPassTexture(PaddedOutputColor), PaddingOnOutput, TEXT("ArmNssOutputSceneColor"));
+		Outputs.FullRes = CopyAndCropIfNeeded(GraphBuilder,
+			FScreenPassTexture(FinalOutputColor, FIntRect(FIntPoint::ZeroValue, PaddedOutputSize)),
+			PaddingOnOutput,
+			TEXT("ArmNssOutputSceneColor"),
+			StageTimer);
 	}
 	//--------------------------------------------------------------------------------------------------------------
 	// Update History Data (Part 2)
@@ -797,10 +2044,27 @@ INSS::FOutputs NSS::AddPasses(FRDGBuilder& GraphBuilder, const NSSView& SceneVie
 		// keeping behavior consistent with engine resources like TemporalAA that skip history
 		// updates such as when the world is paused.
 		GraphBuilder.QueueTextureExtraction(PaddedOutputColor, &NewHistory->PaddedUpscaledColour);
-		GraphBuilder.QueueTextureExtraction(PaddedInputDepth.Texture, &NewHistory->PaddedDepth);
+		NewHistory->PaddedUpscaledColourSize = PaddedOutputSize;
+		if (bReuseHistory)
+		{
+			// The depth the reused output was dispatched with.
+			NewHistory->PaddedDepth = CustomHistory->PaddedDepth;
+			NewHistory->PaddedDepthViewRect = CustomHistory->PaddedDepthViewRect;
+			NewHistory->TileFeatures = CustomHistory->TileFeatures;
+		}
+		else
+		{
+			GraphBuilder.QueueTextureExtraction(PaddedInputDepth.Texture, &NewHistory->PaddedDepth);
+			NewHistory->PaddedDepthViewRect = PaddedInputDepth.ViewRect;
+		}
+		if (TileFeatures)
+		{
+			GraphBuilder.QueueTextureExtraction(TileFeatures, &NewHistory->TileFeatures);
+		}
 		GraphBuilder.QueueTextureExtraction(
 			PaddedOutputColor, &View.ViewState->PrevFrameViewInfo.TemporalAAHistory.RT[0]);
 	}
+	InputPreparationStats.Publish();
 	Outputs.NewHistory = NewHistory;
 	DeferredCleanup(GFrameCounterRenderThread);
 	return Outputs;
@@ -808,11 +2072,10 @@ INSS::FOutputs NSS::AddPasses(FRDGBuilder& GraphBuilder, const NSSView& SceneVie
 
 INSS* NSS::Fork_GameThread(const class FSceneViewFamily& InViewFamily) const
 {
+	NSS_TRACE_SCOPE("NSS::Fork");
 	Initialize();
 
-	INSSModule& NSSModuleInterface = FModuleManager::GetModuleChecked<INSSModule>(TEXT("NSS"));
-
-	return new NSSProxy(NSSModuleInterface.GetNSSUpscaler());
+	return new NSSProxy(const_cast<NSS*>(this));
 }
 
 float NSS::GetMinUpsampleResolutionFraction() const
@@ -839,18 +2102,142 @@ float NSS::GetMaxUpsampleResolutionFraction() const
 	}
 }
 
-void NSS::SetPostProcessingInputs(FPostProcessingInputs const& NewInputs)
-{
-	PostInputs = NewInputs;
-}
-
 //-------------------------------------------------------------------------------------
 // As the upscaler retains some resources during the frame they must be released here to avoid leaking or accessing
 // dangling pointers.
 //-------------------------------------------------------------------------------------
 void NSS::EndOfFrame()
 {
-	PostInputs.SceneTextures = nullptr;
+	NSS_TRACE_SCOPE("NSS::EndOfFrame");
+	{
+		// The primary eyes' textures belong to graphs that have been executed.
+		FScopeLock Lock(&StereoMutex);
+		StereoPrimaryEyes.Reset();
+	}
+	ViewResources.Trim(GFrameCounterRenderThread,
+		uint64(FMath::Max(CVarNSSResourcePoolMaxSizeMB.GetValueOnRenderThread(), 0)) * 1024 * 1024,
+		uint32(FMath::Max(CVarNSSResourcePoolMaxUnusedFrames.GetValueOnRenderThread(), 0)));
+	const NSSResourcePoolStats PoolStats = ViewResources.GetStats();
+	INC_DWORD_STAT_BY(STAT_NSS_PoolHits, PoolStats.Hits - PublishedPoolStats.Hits);
+	INC_DWORD_STAT_BY(STAT_NSS_PoolMisses, PoolStats.Misses - PublishedPoolStats.Misses);
+	INC_DWORD_STAT_BY(STAT_NSS_PoolEvictions, PoolStats.Evictions - PublishedPoolStats.Evictions);
+	SET_DWORD_STAT(STAT_NSS_PoolResources, PoolStats.NumResources);
+	SET_MEMORY_STAT(STAT_NSS_PoolMemory, PoolStats.AllocatedBytes);
+	CSV_CUSTOM_STAT(NSS, PoolMisses, int32(PoolStats.Misses - PublishedPoolStats.Misses), ECsvCustomStatOp::Accumulate);
+	CSV_CUSTOM_STAT(NSS, PoolMB, float(double(PoolStats.AllocatedBytes) / (1024.0 * 1024.0)), ECsvCustomStatOp::Set);
+	PublishedPoolStats = PoolStats;
+
+	const NSSContextCacheStats CacheStats = ContextCache.GetStats();
+	INC_DWORD_STAT_BY(STAT_NSS_ContextCacheHits, CacheStats.Hits - PublishedContextCacheStats.Hits);
+	INC_DWORD_STAT_BY(STAT_NSS_ContextCreations, CacheStats.Creations - PublishedContextCacheStats.Creations);
+	INC_DWORD_STAT_BY(STAT_NSS_ContextCacheEvictions, CacheStats.Evictions - PublishedContextCacheStats.Evictions);
+	INC_DWORD_STAT_BY(STAT_NSS_ContextCacheLockContentions,
+		CacheStats.LockContentions - PublishedContextCacheStats.LockContentions);
+	SET_DWORD_STAT(STAT_NSS_ContextCacheContexts, CacheStats.NumCached);
+	SET_MEMORY_STAT(STAT_NSS_ContextCacheMemory, CacheStats.CachedBytes);
+	SET_FLOAT_STAT(STAT_NSS_ContextCacheHitRate, float(CacheStats.GetHitRate() * 100.0));
+	SET_FLOAT_STAT(STAT_NSS_ContextCreationMsAvoided, float(CacheStats.GetSecondsAvoided() * 1000.0));
+	CSV_CUSTOM_STAT(NSS, ContextCacheHitRate, float(CacheStats.GetHitRate() * 100.0), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(NSS,
+		ContextCreations,
+		int32(CacheStats.Creations - PublishedContextCacheStats.Creations),
+		ECsvCustomStatOp::Accumulate);
+	const uint64 PreviousContextCreations = PublishedContextCacheStats.Creations;
+	PublishedContextCacheStats = CacheStats;
+
+	ContextFactory.Flush(ContextCache, GFrameCounterRenderThread);
+	const NSSContextFactoryStats FactoryStats = ContextFactory.GetStats();
+	INC_DWORD_STAT_BY(STAT_NSS_ContextsPrecreated, FactoryStats.Created - PublishedContextFactoryStats.Created);
+	INC_DWORD_STAT_BY(STAT_NSS_ContextPrecreationWaits, FactoryStats.Waits - PublishedContextFactoryStats.Waits);
+	SET_DWORD_STAT(STAT_NSS_ContextPrecreationsPending, FactoryStats.NumPending);
+	CSV_CUSTOM_STAT(NSS,
+		ContextsPrecreated,
+		int32(FactoryStats.Created - PublishedContextFactoryStats.Created),
+		ECsvCustomStatOp::Accumulate);
+	PublishedContextFactoryStats = FactoryStats;
+
+	const uint32 FrameViewsUpscaled = ViewsUpscaled.exchange(0, std::memory_order_relaxed);
+	const uint32 FrameViewsReused = ViewsReused.exchange(0, std::memory_order_relaxed);
+	if (FrameViewsUpscaled > 0)
+	{
+		const float ReuseRate = float(double(FrameViewsReused) * 100.0 / double(FrameViewsUpscaled));
+		SET_FLOAT_STAT(STAT_NSS_StaticFrameReuseRate, ReuseRate);
+		CSV_CUSTOM_STAT(NSS, StaticFrameReuseRate, ReuseRate, ECsvCustomStatOp::Set);
+	}
+	// The tiles of the frames read back this frame, so these follow the rendered frames a few frames behind.
+	const uint32 FrameTilesClassified = TilesClassified.exchange(0, std::memory_order_relaxed);
+	const uint32 FrameTilesChanged = TilesChanged.exchange(0, std::memory_order_relaxed);
+	const uint32 FrameTilesActive = TilesActive.exchange(0, std::memory_order_relaxed);
+	if (FrameTilesClassified > 0)
+	{
+		const float ChangedRate = float(double(FrameTilesChanged) * 100.0 / double(FrameTilesClassified));
+		const float ActiveRate = float(double(FrameTilesActive) * 100.0 / double(FrameTilesClassified));
+		SET_FLOAT_STAT(STAT_NSS_SparseTilesChanged, ChangedRate);
+		SET_FLOAT_STAT(STAT_NSS_SparseTilesActive, ActiveRate);
+		CSV_CUSTOM_STAT(NSS, SparseTilesChanged, ChangedRate, ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(NSS, SparseTilesActive, ActiveRate, ECsvCustomStatOp::Set);
+	}
+	const uint64 FrameRegionOfInterestTexels = RegionOfInterestTexels.exchange(0, std::memory_order_relaxed);
+	const uint64 FrameRegionOfInterestViewTexels = RegionOfInterestViewTexels.exchange(0, std::memory_order_relaxed);
+	if (FrameRegionOfInterestViewTexels > 0)
+	{
+		// The share of the output the network would run on, as the SDK still dispatches the whole frame.
+		const float RegionRate =
+			float(double(FrameRegionOfInterestTexels) * 100.0 / double(FrameRegionOfInterestViewTexels));
+		SET_FLOAT_STAT(STAT_NSS_RegionOfInterestPixels, RegionRate);
+		CSV_CUSTOM_STAT(NSS, RegionOfInterestPixels, RegionRate, ECsvCustomStatOp::Set);
+	}
+
+	const NSSHistoryMemoryStats HistoryStats = GetTotalHistoryMemoryStats();
+	const uint64 TotalBytes = HistoryStats.GetTotalBytes() + CacheStats.CachedBytes + PoolStats.AllocatedBytes;
+	SET_DWORD_STAT(STAT_NSS_Histories, HistoryStats.NumHistories);
+	SET_MEMORY_STAT(STAT_NSS_HistoryMemory, HistoryStats.TextureBytes);
+	SET_MEMORY_STAT(STAT_NSS_ContextMemory, HistoryStats.ContextBytes);
+	SET_MEMORY_STAT(STAT_NSS_ContextScratchMemory, HistoryStats.ContextScratchBytes);
+	SET_MEMORY_STAT(STAT_NSS_TotalMemory, TotalBytes);
+	CSV_CUSTOM_STAT(
+		NSS, HistoryMB, float(double(HistoryStats.TextureBytes) / (1024.0 * 1024.0)), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(
+		NSS, ContextMB, float(double(HistoryStats.ContextBytes) / (1024.0 * 1024.0)), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(NSS, TotalMB, float(double(TotalBytes) / (1024.0 * 1024.0)), ECsvCustomStatOp::Set);
+	if (NSS_TRACE_IS_ENABLED())
+	{
+		NSSTraceCounters TraceCounters;
+		TraceCounters.LiveContexts = HistoryStats.NumContexts + CacheStats.NumCached;
+		TraceCounters.PooledTextures = PoolStats.NumResources;
+		TraceCounters.AllocatedBytes = TotalBytes;
+		TraceCounters.ContextCreations = int32(CacheStats.Creations - PreviousContextCreations);
+		NSSTrace::OutputCounters(TraceCounters);
+	}
+
+	GPUTimer.Update(GFrameCounterRenderThread);
+	FrameCapture.Update();
+	if (CVarNSSGPUTiming.GetValueOnRenderThread() != 0)
+	{
+		const NSSGPUTimings GPUTimings = GPUTimer.GetLatestTimings();
+		const float InputPreparationMs = float(GPUTimings.GetMilliseconds(ENSSGPUStage::InputPreparation));
+		const float DispatchMs = float(GPUTimings.GetMilliseconds(ENSSGPUStage::Dispatch));
+		const float DispatchInputPreparationMs =
+			float(GPUTimings.GetMilliseconds(ENSSGPUStage::DispatchInputPreparation));
+		const float DispatchInferenceMs = float(GPUTimings.GetMilliseconds(ENSSGPUStage::DispatchInference));
+		const float DispatchOutputResolveMs = float(GPUTimings.GetMilliseconds(ENSSGPUStage::DispatchOutputResolve));
+		const float OutputCropMs = float(GPUTimings.GetMilliseconds(ENSSGPUStage::OutputCrop));
+		const float TotalMs = float(GPUTimings.GetTotalMilliseconds());
+		SET_FLOAT_STAT(STAT_NSS_GPUInputPreparation, InputPreparationMs);
+		SET_FLOAT_STAT(STAT_NSS_GPUDispatch, DispatchMs);
+		SET_FLOAT_STAT(STAT_NSS_GPUDispatchInputPreparation, DispatchInputPreparationMs);
+		SET_FLOAT_STAT(STAT_NSS_GPUDispatchInference, DispatchInferenceMs);
+		SET_FLOAT_STAT(STAT_NSS_GPUDispatchOutputResolve, DispatchOutputResolveMs);
+		SET_FLOAT_STAT(STAT_NSS_GPUOutputCrop, OutputCropMs);
+		SET_FLOAT_STAT(STAT_NSS_GPUTotal, TotalMs);
+		CSV_CUSTOM_STAT(NSS, GPUInputPreparationMs, InputPreparationMs, ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(NSS, GPUDispatchMs, DispatchMs, ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(NSS, GPUDispatchInputPreparationMs, DispatchInputPreparationMs, ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(NSS, GPUDispatchInferenceMs, DispatchInferenceMs, ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(NSS, GPUDispatchOutputResolveMs, DispatchOutputResolveMs, ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(NSS, GPUOutputCropMs, OutputCropMs, ECsvCustomStatOp::Set);
+		CSV_CUSTOM_STAT(NSS, GPUTotalMs, TotalMs, ECsvCustomStatOp::Set);
+	}
 #if WITH_EDITOR
 	bEnabledInEditor = true;
 #endif
@@ -864,6 +2251,108 @@ void NSS::UpdateDynamicResolutionState()
 	GEngine->GetDynamicResolutionCurrentStateInfos(DynamicResolutionStateInfos);
 }
 
+//-------------------------------------------------------------------------------------
+// The governor trades render resolution for GPU time, between r.NSS.Governor.MinScreenPercentage and the screen
+// percentage of the quality mode. It is fed the RHI's measurement of the whole GPU frame, which lags a couple of
+// frames behind, and applies its choice through r.ScreenPercentage so that everything else that follows the screen
+// percentage keeps working. The contexts of the views are created for its highest fraction, see AddPasses, so that
+// its changes don't recreate them.
+//-------------------------------------------------------------------------------------
+void NSS::UpdateQualityGovernor()
+{
+	if (QualityGovernorFrame == GFrameCounter)
+	{
+		return;
+	}
+	const bool bContinued = bQualityGovernorActive && QualityGovernorFrame + 1 == GFrameCounter;
+	QualityGovernorFrame = GFrameCounter;
+	if (!CVarNSSGovernor.GetValueOnGameThread())
+	{
+		if (bQualityGovernorActive)
+		{
+			bQualityGovernorActive = false;
+			QualityGovernorMaxFraction.store(0.0f, std::memory_order_relaxed);
+			SetScreenPercentage(TargetScreenPercentage);
+		}
+		return;
+	}
+
+	NSSQualityGovernorSettings Settings;
+	Settings.BudgetMilliseconds = CVarNSSGovernorBudgetMs.GetValueOnGameThread();
+	Settings.MaxFraction = TargetScreenPercentage / 100.0f;
+	Settings.MinFraction =
+		FMath::Min(CVarNSSGovernorMinScreenPercentage.GetValueOnGameThread(), TargetScreenPercentage) / 100.0f;
+	Settings.Hysteresis = CVarNSSGovernorHysteresis.GetValueOnGameThread();
+	Settings.SettleFrames = CVarNSSGovernorSettleFrames.GetValueOnGameThread();
+	if (!bContinued)
+	{
+		// Frame times from before a gap in rendering, or with the governor off, say nothing about the next frame.
+		QualityGovernor.Reset(Settings.MaxFraction);
+		bQualityGovernorActive = true;
+	}
+	QualityGovernorMaxFraction.store(Settings.MaxFraction, std::memory_order_relaxed);
+
+	const double GPUMilliseconds = FPlatformTime::ToMilliseconds(RHIGetGPUFrameCycles());
+	const float ScreenPercentage = QualityGovernor.Update(GPUMilliseconds, Settings) * 100.0f;
+	SetScreenPercentage(ScreenPercentage);
+	SET_FLOAT_STAT(STAT_NSS_GovernorScreenPercentage, ScreenPercentage);
+	SET_FLOAT_STAT(STAT_NSS_GovernorGPUFrameTime, float(QualityGovernor.GetSmoothedMilliseconds()));
+	CSV_CUSTOM_STAT(NSS, GovernorScreenPercentage, ScreenPercentage, ECsvCustomStatOp::Set);
+}
+
+//-------------------------------------------------------------------------------------
+// Context creation can take long enough to hitch, so when a view's output size, the screen percentage or the dynamic
+// resolution bounds change the context the view is going to need is created ahead of time on a background task.
+// AddPasses takes it from the context cache, waits for it if it isn't finished, or creates one itself if the
+// prediction was wrong.
+//-------------------------------------------------------------------------------------
+void NSS::PredictContexts(const FSceneViewFamily& ViewFamily)
+{
+	if (!CVarNSSContextPrecreation.GetValueOnGameThread() || !IsApiSupported())
+	{
+		return;
+	}
+
+	static const IConsoleVariable* ScreenPercentageVar =
+		IConsoleManager::Get().FindConsoleVariable(TEXT("r.ScreenPercentage"));
+	NSSContextPrediction Prediction;
+	Prediction.ScreenPercentage = ScreenPercentageVar ? ScreenPercentageVar->GetFloat() : 100.f;
+	const EDynamicResolutionStatus DynamicResolutionStatus = DynamicResolutionStateInfos.Status;
+	Prediction.bDynamicResolution = DynamicResolutionStatus == EDynamicResolutionStatus::Enabled
+									|| DynamicResolutionStatus == EDynamicResolutionStatus::DebugForceEnabled;
+	Prediction.MaxResolutionFraction =
+		DynamicResolutionStateInfos.ResolutionFractionUpperBounds[GDynamicPrimaryResolutionFraction];
+	Prediction.bDynamicResolutionContext = CVarNSSDynamicResolution.GetValueOnGameThread() != 0;
+	if (Prediction.bDynamicResolutionContext)
+	{
+		// The contexts are created for the governor's highest screen percentage rather than its current one.
+		const float GovernorMaxScreenPercentage = QualityGovernorMaxFraction.load(std::memory_order_relaxed) * 100.0f;
+		Prediction.ScreenPercentage = FMath::Max(Prediction.ScreenPercentage, GovernorMaxScreenPercentage);
+	}
+	Prediction.MinResolutionFraction = GetMinUpsampleResolutionFraction();
+	for (const FSceneView* View : ViewFamily.Views)
+	{
+		Prediction.OutputSize = View->UnscaledViewRect.Size();
+		if (Prediction.OutputSize.X <= 0 || Prediction.OutputSize.Y <= 0 || ContextPredictions.Contains(Prediction))
+		{
+			continue;
+		}
+		// Enough for every view of split screen and stereo to alternate between a couple of settings.
+		static constexpr int32 MaxPredictions = 8;
+		if (ContextPredictions.Num() == MaxPredictions)
+		{
+			ContextPredictions.RemoveAt(0);
+		}
+		ContextPredictions.Add(Prediction);
+
+		const ffxApiCreateContextDescNss Params = MakeNssContextParams(PredictNssContextSizes(Prediction));
+		if (!ContextCache.Contains(Params))
+		{
+			ContextFactory.Request(ApiAccessor, Params);
+		}
+	}
+}
+
 //-------------------------------------------------------------------------------------
 // In the Editor it is necessary to disable the view extension via the upscaler API so it doesn't cause conflicts.
 //-------------------------------------------------------------------------------------
@@ -27,23 +27,74 @@
 #include "Containers/LockFreeList.h"
 #include "Engine/Engine.h"
 #include "NGSharedBackend.h"
+#include "NSSCapture.h"
+#include "NSSContextCache.h"
+#include "NSSContextFactory.h"
+#include "NSSGPUTimer.h"
 #include "NSSHistory.h"
+#include "NSSQualityGovernor.h"
+#include "NSSRegionOfInterest.h"
+#include "NSSResourcePool.h"
+#include "NSSStats.h"
 #include "PostProcess/PostProcessUpscale.h"
 #include "PostProcess/PostProcessing.h"
 #include "PostProcess/TemporalAA.h"
 #include "ScreenSpaceDenoise.h"
 #include "Shaders/NssConvertVelocity.h"
 #include "Shaders/NssMirrorPad.h"
+#include "Shaders/NssMotionReduction.h"
+#include "Shaders/NssPrepareInputs.h"
+#include "Shaders/NssRegionOfInterest.h"
+#include "Shaders/NssSparseTiles.h"
+#include "Shaders/NssStereoReproject.h"
 #include "TemporalUpscaler.h"
+
+#include <atomic>
+
+// The runtime previews that measure what a technique would save rather than saving anything, r.NSS.SparseTiles and
+// r.NSS.ROI, are compiled out of shipping builds. The replay commandlet measures the same on captured sequences.
+#define NSS_PREVIEWS_ENABLED (!UE_BUILD_SHIPPING)
+
 using INSS = UE::Renderer::Private::ITemporalUpscaler;
 using NSSPassInput = UE::Renderer::Private::ITemporalUpscaler::FInputs;
 using NSSView = FSceneView;
+// The intermediates of one view.
+using NSSViewResourcePool = TNSSResourcePool<IPooledRenderTarget>;
 
 #ifndef ENGINE_HAS_DENOISE_INDIRECT
 #define ENGINE_HAS_DENOISE_INDIRECT 0
 #endif
 
-struct FPostProcessingInputs;
+// What an NSS dispatch needs to know about the frame besides its resources.
+struct NSSDispatchFrameParams
+{
+	FIntPoint PaddedInputSize = FIntPoint::ZeroValue;
+	FIntPoint PaddedOutputSize = FIntPoint::ZeroValue;
+	// The view's TemporalJitterPixels.
+	FVector2f JitterPixels = FVector2f::ZeroVector;
+	// Whether the history can't be used, e.g. on camera cuts.
+	bool bReset = false;
+	float FrameTimeDeltaSeconds = 0.0f;
+	float FovAngleVertical = 0.0f;
+	float NearPlane = 0.0f;
+	bool bDebugViews = false;
+};
+
+// What the secondary eye of a stereo pair needs from the primary eye's frame to reproject its output.
+struct NSSStereoPrimaryEye
+{
+	// The graph and frame the textures belong to.
+	const FRDGBuilder* GraphBuilder = nullptr;
+	uint64 Frame = 0;
+	FIntPoint InputSize = FIntPoint::ZeroValue;
+	FIntPoint OutputSize = FIntPoint::ZeroValue;
+	// The padded output, with the view at the origin.
+	FRDGTextureRef Output = nullptr;
+	FRDGTextureRef Depth = nullptr;
+	FIntRect DepthViewRect;
+	// Without jitter.
+	FMatrix WorldToClip = FMatrix::Identity;
+};
 
 //-------------------------------------------------------------------------------------
 // The core upscaler implementation for NSS.
@@ -59,10 +110,37 @@ public:
 
 	const TCHAR* GetDebugName() const override;
 
+	// Hands a state its history no longer needs to the context cache. Any thread.
 	void ReleaseState(NSSStateRef State);
 
+	static ffxApiDispatchDescNss MakeDispatchParams(const NSSDispatchFrameParams& Frame);
+
+	// Returns the state to use for a frame of ViewID with ContextSizes: the state of History when it still fits,
+	// otherwise a released or pending state, otherwise a new one. bInOutHistoryValid is cleared when the state's
+	// history can't be used. Returns null if a context couldn't be created.
+	NSSStateRef AcquireState(const NSSContextSizes& ContextSizes,
+		NSSHistory* History,
+		uint32 ViewID,
+		uint64 Frame,
+		bool& bInOutHistoryValid,
+		bool* bOutCreated = nullptr) const;
+
+	// Live histories, tracked for memory accounting.
+	void AddHistory(const NSSHistory* History);
+	void RemoveHistory(const NSSHistory* History);
+
+	// Memory retained by the live histories, keyed by ViewID when bPerView is set and under 0 otherwise.
+	TMap<uint32, NSSHistoryMemoryStats> GetHistoryMemoryStats(bool bPerView) const;
+	// The same as GetHistoryMemoryStats(false) without allocating, for EndOfFrame.
+	NSSHistoryMemoryStats GetTotalHistoryMemoryStats() const;
+
+	// Logs the memory used by each view, the context cache and the resource pool (r.NSS.DumpMemory).
+	void DumpMemory() const;
+
 	// Keeping this in for the purposes of checking that everything is initialized correctly.
 	static class INGSharedBackend* GetApiAccessor(EFFXBackendAPI& Api);
+	// Whether r.NSS.CPUBackend selects the CPU reference backend over the RHI's.
+	static bool UseCPUBackend();
 
 #if DO_CHECK || DO_GUARD_SLOW || DO_ENSURE || WITH_EDITOR
 	static void OnNSSMessage(uint32 type, const wchar_t* message);
@@ -71,11 +149,14 @@ public:
 	static void SaveScreenPercentage();
 	static void UpdateScreenPercentage();
 	static void RestoreScreenPercentage();
+	// Sets r.ScreenPercentage for NSS' own purposes, without it being saved as the user's.
+	static void SetScreenPercentage(float Value);
+	// The screen percentage of an r.NSS.QualityMode, 0 for Custom.
+	static float GetQualityModeScreenPercentage(int32 QualityMode);
 
 	static void OnChangeNSSEnable(IConsoleVariable* Var);
 	static void OnChangeScreenPercentage(IConsoleVariable* Var);
-
-	class FRDGBuilder* GetGraphBuilder();
+	static void OnChangeQualityMode(IConsoleVariable* Var);
 
 	INSS::FOutputs AddPasses(
 		FRDGBuilder& GraphBuilder, const NSSView& View, const NSSPassInput& PassInputs) const override;
@@ -85,12 +166,18 @@ public:
 	float GetMinUpsampleResolutionFraction() const override;
 	float GetMaxUpsampleResolutionFraction() const override;
 
-	void SetPostProcessingInputs(FPostProcessingInputs const& Inputs);
-
 	void EndOfFrame();
 
 	void UpdateDynamicResolutionState();
 
+	// Picks the screen percentage of the next frame from the GPU frame time when r.NSS.Governor.Enable is set. Called
+	// from the game thread for each view family, and only acts on the first of a frame.
+	void UpdateQualityGovernor();
+
+	// Starts creating the contexts the views of ViewFamily are predicted to need in the background, when
+	// r.NSS.ContextPrecreation is enabled.
+	void PredictContexts(const class FSceneViewFamily& ViewFamily);
+
 #if WITH_EDITOR
 	bool IsEnabledInEditor() const;
 	void SetEnabledInEditor(bool bEnabled);
@@ -174,28 +261,101 @@ public:
 		const FDiffuseIndirectInputs& Inputs,
 		const FAmbientOcclusionRayTracingConfig Config) const override;
 
+	// Returns a texture from a view's resource pool, which is retained across frames. The extent is rounded up to the
+	// pool's bucket size when bBucketExtent is set, so the texture may be larger than Desc.
+	static FRDGTextureRef CreatePooledTexture(FRDGBuilder& GraphBuilder,
+		NSSViewResourcePool& Resources,
+		const FRDGTextureDesc& Desc,
+		const TCHAR* Name,
+		bool bBucketExtent = true);
+
+	// The totals of every view's resource pool.
+	NSSResourcePoolStats GetResourcePoolStats() const;
+
+	// GPU time of each stage of the most recent frame that has been read back, when r.NSS.GPUTiming is enabled.
+	NSSGPUTimings GetGPUTimings() const;
+
+	// Captures the inputs of the next NumFrames frames of a view to a file (r.NSS.Capture). Render thread.
+	void StartCapture(const FString& Path, int32 NumFrames, const NSSCaptureSettings& Settings);
+
+	// The regions of interest of r.NSS.ROI set by game code, keyed by ViewID. Any thread.
+	void SetRegionOfInterest(uint32 ViewID, const NSSRegionOfInterest& Region);
+	void ClearRegionOfInterest(uint32 ViewID);
+	// The region set for ViewID, otherwise the one of the r.NSS.ROI.* cvars. Render thread.
+	NSSRegionOfInterest GetRegionOfInterest(uint32 ViewID) const;
+
 	inline bool IsApiSupported() const
 	{
 		return Api != EFFXBackendAPI::Unknown && Api != EFFXBackendAPI::Unsupported;
 	}
 
+	// The backend chosen by Initialize().
+	inline EFFXBackendAPI GetApi() const
+	{
+		return Api;
+	}
+
+	inline INGSharedBackend* GetBackend() const
+	{
+		return ApiAccessor;
+	}
+
 private:
 	void DeferredCleanup(uint64 FrameNum) const;
+	// Adds History to Stats, counting its context unless it is already in CountedStates. HistoriesMutex is held.
+	void AddHistoryMemoryStats(const NSSHistory& History, NSSHistoryMemoryStats& Stats) const;
+	static FRDGTextureRef RegisterMotionVectorTexture(
+		FRDGBuilder& GraphBuilder, NSSViewResourcePool& Resources, FIntPoint Extent);
 
-	mutable FPostProcessingInputs PostInputs;
 	FDynamicResolutionStateInfos DynamicResolutionStateInfos;
-	mutable FCriticalSection Mutex;
-	// For handling of FFX NSS States while it is temporarily turned off
-	// - avoids reallocating stuff and just keeps it around
-	// Will we ever need this? Will we have camera cuts without NSS?
-	mutable TSet<NSSStateRef> AvailableStates;
+	// Released NSS states, kept so that they can be reused rather than recreated.
+	mutable NSSContextCache ContextCache;
+	NSSContextCacheStats PublishedContextCacheStats;
+	mutable NSSContextFactory ContextFactory;
+	NSSContextFactoryStats PublishedContextFactoryStats;
+	// The most recent predictions made by PredictContexts, so that unchanged views are skipped.
+	TArray<NSSContextPrediction> ContextPredictions;
 	mutable EFFXBackendAPI Api;
 	mutable class INGSharedBackend* ApiAccessor;
-	mutable class FRDGBuilder* CurrentGraphBuilder;
+	// Whether ApiAccessor was chosen with r.NSS.CPUBackend in effect.
+	mutable bool bInitializedWithCPUBackend;
+	// Serialises Initialize() between views adding their passes concurrently.
+	mutable FCriticalSection InitializeMutex;
 	mutable const IScreenSpaceDenoiser* WrappedDenoiser;
-	mutable TRefCountPtr<IPooledRenderTarget> MotionVectorRT;
+	// The intermediates of each view, keyed by ViewID. Nothing else AddPasses uses is shared between views unguarded.
+	mutable TNSSViewResourcePools<IPooledRenderTarget> ViewResources;
+	NSSResourcePoolStats PublishedPoolStats;
+	mutable FCriticalSection HistoriesMutex;
+	TSet<const NSSHistory*> Histories;
+	// Contexts already counted by the memory stats, kept so that the set's memory is reused from frame to frame.
+	mutable TSet<const NSSState*> CountedStates;
+	mutable NSSGPUTimer GPUTimer;
+	mutable NSSFrameCapture FrameCapture;
+	// The primary eyes of this frame's stereo pairs, keyed by ViewID, when r.NSS.XR.CrossEyeReuse is on.
+	mutable FCriticalSection StereoMutex;
+	mutable TMap<uint32, NSSStereoPrimaryEye> StereoPrimaryEyes;
+	NSSQualityGovernor QualityGovernor;
+	uint64 QualityGovernorFrame = 0;
+	bool bQualityGovernorActive = false;
+	// The highest render fraction the governor can pick, which the views' contexts are created for, 0 without it.
+	std::atomic<float> QualityGovernorMaxFraction{0.0f};
+	// Views upscaled this frame, and those of them that reused their history (r.NSS.StaticFrameSkip).
+	mutable std::atomic<uint32> ViewsUpscaled{0};
+	mutable std::atomic<uint32> ViewsReused{0};
+	// Tiles changed, active and classified in the frames read back since the last frame (r.NSS.SparseTiles).
+	mutable std::atomic<uint32> TilesChanged{0};
+	mutable std::atomic<uint32> TilesActive{0};
+	mutable std::atomic<uint32> TilesClassified{0};
+	mutable FCriticalSection RegionsOfInterestMutex;
+	TMap<uint32, NSSRegionOfInterest> RegionsOfInterest;
+	// Output texels of the views upscaled this frame with r.NSS.ROI, and those of them the network ran on.
+	mutable std::atomic<uint64> RegionOfInterestViewTexels{0};
+	mutable std::atomic<uint64> RegionOfInterestTexels{0};
 #if WITH_EDITOR
 	bool bEnabledInEditor;
 #endif
 	static float SavedScreenPercentage;
+	// The screen percentage set by the quality mode or the user, which the governor doesn't go above.
+	static float TargetScreenPercentage;
+	static bool bSettingScreenPercentage;
 };
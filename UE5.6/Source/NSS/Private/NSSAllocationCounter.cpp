@@ -0,0 +1,179 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#include "NSSAllocationCounter.h"
+
+#include "HAL/MemoryBase.h"
+#include "Templates/TypeCompatibleBytes.h"
+
+namespace
+{
+	// The counts of the current thread's counter, if it is being counted.
+	thread_local NSSAllocationCounts* GThreadAllocationCounts = nullptr;
+
+	//-------------------------------------------------------------------------------------
+	// Forwards everything to the allocator it wraps, counting the calls made by threads that are being counted.
+	//-------------------------------------------------------------------------------------
+	class NSSCountingMalloc final : public FMalloc
+	{
+	public:
+		explicit NSSCountingMalloc(FMalloc* InInner) : Inner(InInner)
+		{}
+
+		void* Malloc(SIZE_T Count, uint32 Alignment) override
+		{
+			CountAllocation(Count);
+			return Inner->Malloc(Count, Alignment);
+		}
+
+		void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+		{
+			CountAllocation(Count);
+			return Inner->TryMalloc(Count, Alignment);
+		}
+
+		void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			CountReallocation(Original, Count);
+			return Inner->Realloc(Original, Count, Alignment);
+		}
+
+		void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+		{
+			CountReallocation(Original, Count);
+			return Inner->TryRealloc(Original, Count, Alignment);
+		}
+
+		void Free(void* Original) override
+		{
+			if (Original && GThreadAllocationCounts)
+			{
+				GThreadAllocationCounts->Frees++;
+			}
+			Inner->Free(Original);
+		}
+
+		SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override
+		{
+			return Inner->QuantizeSize(Count, Alignment);
+		}
+
+		bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override
+		{
+			return Inner->GetAllocationSize(Original, SizeOut);
+		}
+
+		void Trim(bool bTrimThreadCaches) override
+		{
+			Inner->Trim(bTrimThreadCaches);
+		}
+
+		void SetupTLSCachesOnCurrentThread() override
+		{
+			Inner->SetupTLSCachesOnCurrentThread();
+		}
+
+		void ClearAndDisableTLSCachesOnCurrentThread() override
+		{
+			Inner->ClearAndDisableTLSCachesOnCurrentThread();
+		}
+
+		void InitializeStatsMetadata() override
+		{
+			Inner->InitializeStatsMetadata();
+		}
+
+		void UpdateStats() override
+		{
+			Inner->UpdateStats();
+		}
+
+		void GetAllocatorStats(FGenericMemoryStats& OutStats) override
+		{
+			Inner->GetAllocatorStats(OutStats);
+		}
+
+		void DumpAllocatorStats(FOutputDevice& Ar) override
+		{
+			Inner->DumpAllocatorStats(Ar);
+		}
+
+		bool IsInternallyThreadSafe() const override
+		{
+			return Inner->IsInternallyThreadSafe();
+		}
+
+		bool ValidateHeap() override
+		{
+			return Inner->ValidateHeap();
+		}
+
+		const TCHAR* GetDescriptiveName() override
+		{
+			return Inner->GetDescriptiveName();
+		}
+
+	private:
+		static void CountAllocation(SIZE_T Count)
+		{
+			if (GThreadAllocationCounts)
+			{
+				GThreadAllocationCounts->Allocations++;
+				GThreadAllocationCounts->AllocatedBytes += Count;
+			}
+		}
+
+		static void CountReallocation(void* Original, SIZE_T Count)
+		{
+			if (GThreadAllocationCounts)
+			{
+				if (Original)
+				{
+					GThreadAllocationCounts->Reallocations++;
+				}
+				else
+				{
+					GThreadAllocationCounts->Allocations++;
+				}
+				GThreadAllocationCounts->AllocatedBytes += Count;
+			}
+		}
+
+		FMalloc* Inner;
+	};
+
+	// Installs the proxy the first time it is needed. It is never removed, as memory allocated through it may be
+	// freed at any point later.
+	bool InstallCountingMalloc()
+	{
+		static FCriticalSection Mutex;
+		static TTypeCompatibleBytes<NSSCountingMalloc> Storage;
+		static bool bInstalled = false;
+		FScopeLock Lock(&Mutex);
+		if (!bInstalled && GMalloc)
+		{
+			GMalloc = new (Storage.GetTypedPtr()) NSSCountingMalloc(GMalloc);
+			bInstalled = true;
+		}
+		return bInstalled;
+	}
+}
+
+NSSScopedAllocationCounter::NSSScopedAllocationCounter()
+{
+	check(GThreadAllocationCounts == nullptr);
+	if (InstallCountingMalloc())
+	{
+		GThreadAllocationCounts = &Counts;
+	}
+}
+
+NSSScopedAllocationCounter::~NSSScopedAllocationCounter()
+{
+	GThreadAllocationCounts = nullptr;
+}
+
+bool NSSScopedAllocationCounter::IsAvailable()
+{
+	return InstallCountingMalloc();
+}
@@ -0,0 +1,44 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Heap allocations made by a thread while it was being counted.
+struct NSSAllocationCounts
+{
+	uint64 Allocations = 0;
+	uint64 Reallocations = 0;
+	uint64 Frees = 0;
+	uint64 AllocatedBytes = 0;
+
+	// Allocations and reallocations, which are what a steady state frame should avoid.
+	uint64 GetTotal() const
+	{
+		return Allocations + Reallocations;
+	}
+};
+
+//-------------------------------------------------------------------------------------
+// Counts the heap allocations made by the current thread while in scope. The first counter installs a proxy around
+// GMalloc that stays in place for the rest of the run; threads that aren't being counted only pay for a thread-local
+// check. Scopes can't be nested.
+//-------------------------------------------------------------------------------------
+class NSSScopedAllocationCounter
+{
+public:
+	NSSScopedAllocationCounter();
+	~NSSScopedAllocationCounter();
+
+	NSSAllocationCounts GetCounts() const
+	{
+		return Counts;
+	}
+
+	// Whether the proxy is in place, which needs GMalloc to have been created.
+	static bool IsAvailable();
+
+private:
+	NSSAllocationCounts Counts;
+};
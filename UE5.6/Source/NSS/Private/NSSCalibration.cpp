@@ -0,0 +1,321 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#include "NSSCalibration.h"
+
+#include "Async/Async.h"
+#include "Engine/GameViewportClient.h"
+#include "HAL/IConsoleManager.h"
+#include "LogNSS.h"
+#include "Misc/ConfigCacheIni.h"
+#include "NGSettings.h"
+#include "NSS.h"
+#include "NSSGPUTimer.h"
+#include "NSSModule.h"
+#include "NSSReplay.h"
+#include "RHI.h"
+#include "Tasks/Task.h"
+#include "UnrealClient.h"
+
+namespace
+{
+	const TCHAR* CalibrationSection = TEXT("/Script/NGSettings.NGSettings.Calibration");
+
+	// The quality modes from the highest screen percentage to the lowest.
+	constexpr ENSSQualityMode CalibratedQualityModes[] = {ENSSQualityMode::Quality,
+		ENSSQualityMode::Balanced,
+		ENSSQualityMode::Performance,
+		ENSSQualityMode::UltraPerformance};
+
+	// The calibration CalibrateNSSOnFirstLaunch runs in the background.
+	UE::Tasks::FTask CalibrationTask;
+	std::atomic<bool> bCancelCalibration = false;
+
+	NSSCalibrationRecord CalibrateNSS(
+		const NSS& Upscaler, const NSSCalibrationSettings& Settings, double TargetMilliseconds)
+	{
+		NSSCalibrationRecord Record;
+		Record.TargetMilliseconds = TargetMilliseconds;
+		const double StartSeconds = FPlatformTime::Seconds();
+		Record.Measurements = MeasureNSSCalibration(Upscaler, Settings);
+		Record.QualityMode = ChooseNSSCalibrationQualityMode(Record.Measurements, TargetMilliseconds);
+		if (Record.QualityMode == int32(ENSSQualityMode::Custom))
+		{
+			UE_LOG(LogNSS, Display, TEXT("NSS couldn't be timed on the GPU, so it isn't calibrated."));
+			return Record;
+		}
+		UE_LOG(LogNSS,
+			Display,
+			TEXT("NSS calibrated for %.2fms at %dx%d in %.2fs: %s"),
+			TargetMilliseconds,
+			Settings.OutputSize.X,
+			Settings.OutputSize.Y,
+			FPlatformTime::Seconds() - StartSeconds,
+			*Record.ToString());
+		return Record;
+	}
+
+	// Stores and applies a calibration, unless nothing could be measured, so that it is tried again next time.
+	void ApplyNSSCalibration(const FString& DeviceKey, const NSSCalibrationRecord& Record, bool bSave)
+	{
+		if (Record.QualityMode == int32(ENSSQualityMode::Custom))
+		{
+			return;
+		}
+		if (bSave)
+		{
+			SaveNSSCalibration(DeviceKey, Record);
+		}
+		CVarNSSQualityMode->Set(Record.QualityMode, ECVF_SetByCode);
+	}
+
+	FAutoConsoleCommand CmdNSSCalibrate(TEXT("r.NSS.Calibrate"),
+		TEXT("r.NSS.Calibrate: times NSS at each quality mode now, stores the result for this GPU and driver and "
+			 "applies it to r.NSS.QualityMode."),
+		FConsoleCommandDelegate::CreateLambda(
+			[]()
+			{
+				NSSModule* Module = FModuleManager::GetModulePtr<NSSModule>(TEXT("NSS"));
+				const NSS* Upscaler = Module ? Module->GetNSSUpscaler() : nullptr;
+				if (!Upscaler || !Upscaler->IsApiSupported())
+				{
+					UE_LOG(LogNSS, Display, TEXT("NSS isn't initialized."));
+					return;
+				}
+				NSSCalibrationSettings Settings;
+				if (GEngine && GEngine->GameViewport && GEngine->GameViewport->Viewport)
+				{
+					Settings.OutputSize = GEngine->GameViewport->Viewport->GetSizeXY();
+				}
+				const NSSCalibrationRecord Record =
+					CalibrateNSS(*Upscaler, Settings, CVarNSSCalibrationTargetMs.GetValueOnGameThread());
+				ApplyNSSCalibration(GetNSSCalibrationDeviceKey(), Record, true);
+			}));
+}
+
+NSSCalibrationMeasurement MeasureNSSCalibrationTimings(
+	int32 QualityMode, float ScreenPercentage, TConstArrayView<double> FrameMilliseconds, float Percentile)
+{
+	NSSCalibrationMeasurement Measurement;
+	Measurement.QualityMode = QualityMode;
+	Measurement.ScreenPercentage = ScreenPercentage;
+	TArray<double> Timed;
+	Timed.Reserve(FrameMilliseconds.Num());
+	for (double Milliseconds : FrameMilliseconds)
+	{
+		if (Milliseconds > 0.0)
+		{
+			Timed.Add(Milliseconds);
+		}
+	}
+	Measurement.NumFrames = Timed.Num();
+	if (Timed.Num() > 0)
+	{
+		Timed.Sort();
+		const double Rank = double(Timed.Num()) * FMath::Clamp(Percentile, 0.0f, 1.0f);
+		Measurement.Milliseconds = Timed[FMath::Clamp(FMath::CeilToInt32(Rank) - 1, 0, Timed.Num() - 1)];
+	}
+	return Measurement;
+}
+
+int32 ChooseNSSCalibrationQualityMode(
+	TConstArrayView<NSSCalibrationMeasurement> Measurements, double TargetMilliseconds)
+{
+	const NSSCalibrationMeasurement* Best = nullptr;
+	const NSSCalibrationMeasurement* Lowest = nullptr;
+	for (const NSSCalibrationMeasurement& Measurement : Measurements)
+	{
+		if (Measurement.NumFrames == 0)
+		{
+			continue;
+		}
+		if (!Lowest || Measurement.ScreenPercentage < Lowest->ScreenPercentage)
+		{
+			Lowest = &Measurement;
+		}
+		if (Measurement.Milliseconds <= TargetMilliseconds
+			&& (!Best || Measurement.ScreenPercentage > Best->ScreenPercentage))
+		{
+			Best = &Measurement;
+		}
+	}
+	if (Best)
+	{
+		return Best->QualityMode;
+	}
+	return Lowest ? Lowest->QualityMode : int32(ENSSQualityMode::Custom);
+}
+
+FString NSSCalibrationRecord::ToString() const
+{
+	FString Modes;
+	for (const NSSCalibrationMeasurement& Measurement : Measurements)
+	{
+		if (Measurement.NumFrames > 0)
+		{
+			Modes += FString::Printf(TEXT("%s%d:%.3f"),
+				Modes.IsEmpty() ? TEXT("") : TEXT(";"),
+				Measurement.QualityMode,
+				Measurement.Milliseconds);
+		}
+	}
+	return FString::Printf(TEXT("QualityMode=%d,TargetMs=%.3f,Modes=%s"), QualityMode, TargetMilliseconds, *Modes);
+}
+
+bool ParseNSSCalibrationRecord(const FString& String, NSSCalibrationRecord& OutRecord)
+{
+	NSSCalibrationRecord Record;
+	if (!FParse::Value(*String, TEXT("QualityMode="), Record.QualityMode)
+		|| !FParse::Value(*String, TEXT("TargetMs="), Record.TargetMilliseconds))
+	{
+		return false;
+	}
+	FString Modes;
+	FParse::Value(*String, TEXT("Modes="), Modes);
+	TArray<FString> Entries;
+	Modes.ParseIntoArray(Entries, TEXT(";"));
+	for (const FString& Entry : Entries)
+	{
+		FString Mode;
+		FString Milliseconds;
+		if (!Entry.Split(TEXT(":"), &Mode, &Milliseconds))
+		{
+			return false;
+		}
+		NSSCalibrationMeasurement& Measurement = Record.Measurements.AddDefaulted_GetRef();
+		Measurement.QualityMode = FCString::Atoi(*Mode);
+		Measurement.ScreenPercentage = NSS::GetQualityModeScreenPercentage(Measurement.QualityMode);
+		Measurement.Milliseconds = FCString::Atod(*Milliseconds);
+		Measurement.NumFrames = 1;
+	}
+	OutRecord = MoveTemp(Record);
+	return true;
+}
+
+FString MakeNSSCalibrationDeviceKey(const FString& AdapterName, const FString& DriverVersion)
+{
+	// Config keys can't hold spaces or the characters the config syntax uses.
+	FString Key = AdapterName.TrimStartAndEnd() + TEXT("_") + DriverVersion.TrimStartAndEnd();
+	for (TCHAR& Character : Key)
+	{
+		if (!FChar::IsAlnum(Character) && Character != TEXT('-') && Character != TEXT('.'))
+		{
+			Character = TEXT('_');
+		}
+	}
+	return Key;
+}
+
+FString GetNSSCalibrationDeviceKey()
+{
+	// The internal driver version, as the user facing one isn't always set on mobile.
+	return MakeNSSCalibrationDeviceKey(GRHIAdapterName, GRHIAdapterInternalDriverVersion);
+}
+
+bool LoadNSSCalibration(const FString& DeviceKey, NSSCalibrationRecord& OutRecord)
+{
+	FString String;
+	return GConfig->GetString(CalibrationSection, *DeviceKey, String, GEngineIni)
+		   && ParseNSSCalibrationRecord(String, OutRecord);
+}
+
+void SaveNSSCalibration(const FString& DeviceKey, const NSSCalibrationRecord& Record)
+{
+	GConfig->SetString(CalibrationSection, *DeviceKey, *Record.ToString(), GEngineIni);
+	GConfig->Flush(false, GEngineIni);
+}
+
+TArray<NSSCalibrationMeasurement> MeasureNSSCalibration(const NSS& Upscaler, const NSSCalibrationSettings& Settings)
+{
+	TArray<NSSCalibrationMeasurement> Measurements;
+	if (!Upscaler.IsApiSupported())
+	{
+		return Measurements;
+	}
+	const bool bCPUBackend = Upscaler.GetApi() == EFFXBackendAPI::CPU;
+	if (!bCPUBackend && !GSupportsTimestampRenderQueries)
+	{
+		UE_LOG(LogNSS, Log, TEXT("NSS can't be calibrated without GPU timestamps."));
+		return Measurements;
+	}
+	NSSRHITimestampSource TimestampSource;
+	for (ENSSQualityMode QualityMode : CalibratedQualityModes)
+	{
+		if (Settings.Cancel && *Settings.Cancel)
+		{
+			break;
+		}
+		const float ScreenPercentage = NSS::GetQualityModeScreenPercentage(int32(QualityMode));
+		const FIntPoint InputSize(FMath::CeilToInt(Settings.OutputSize.X * ScreenPercentage / 100.0f),
+			FMath::CeilToInt(Settings.OutputSize.Y * ScreenPercentage / 100.0f));
+		const NSSReplaySequence Sequence =
+			MakeSyntheticNSSReplaySequence(InputSize, Settings.OutputSize, FMath::Max(Settings.Frames, 1), 0);
+		NSSReplayResults Results;
+		{
+			// The warmup creates the context, which isn't part of the cost of a frame.
+			NSSReplayer Replayer(Upscaler, *Upscaler.GetBackend(), Upscaler.GetApi());
+			if (!bCPUBackend)
+			{
+				Replayer.SetGPUTimestampSource(&TimestampSource);
+			}
+			Results = Replayer.Replay(Sequence, Settings.WarmupFrames);
+		}
+		// Frames whose timestamps couldn't be read back are left out.
+		TArray<double> FrameMilliseconds;
+		for (const NSSReplayFrameResult& Frame : Results.Frames)
+		{
+			FrameMilliseconds.Add(bCPUBackend ? Frame.DispatchMilliseconds : Frame.GPUMilliseconds.Get(0.0));
+		}
+		Measurements.Add(
+			MeasureNSSCalibrationTimings(int32(QualityMode), ScreenPercentage, FrameMilliseconds, Settings.Percentile));
+	}
+	return Measurements;
+}
+
+void CalibrateNSSOnFirstLaunch(const NSS& Upscaler, FIntPoint OutputSize)
+{
+	static bool bCalibrated = false;
+	const int32 Calibration = CVarNSSCalibration.GetValueOnGameThread();
+	if (bCalibrated || Calibration == 0 || !Upscaler.IsApiSupported() || OutputSize.X <= 0 || OutputSize.Y <= 0)
+	{
+		return;
+	}
+	bCalibrated = true;
+
+	const FString DeviceKey = GetNSSCalibrationDeviceKey();
+	const double TargetMilliseconds = CVarNSSCalibrationTargetMs.GetValueOnGameThread();
+	NSSCalibrationRecord Record;
+	if (Calibration != 2 && LoadNSSCalibration(DeviceKey, Record)
+		&& FMath::IsNearlyEqual(Record.TargetMilliseconds, TargetMilliseconds, 1e-3))
+	{
+		ApplyNSSCalibration(DeviceKey, Record, false);
+		return;
+	}
+	// Replayed on a worker, one frame in flight at a time, while the game keeps rendering at its quality mode.
+	NSSCalibrationSettings Settings;
+	Settings.OutputSize = OutputSize;
+	Settings.Cancel = &bCancelCalibration;
+	CalibrationTask = UE::Tasks::Launch(UE_SOURCE_LOCATION,
+		[&Upscaler, Settings, TargetMilliseconds, DeviceKey]()
+		{
+			const NSSCalibrationRecord Calibrated = CalibrateNSS(Upscaler, Settings, TargetMilliseconds);
+			AsyncTask(ENamedThreads::GameThread,
+				[DeviceKey, Calibrated]()
+				{
+					// A cancelled calibration hasn't measured every quality mode.
+					if (!bCancelCalibration)
+					{
+						ApplyNSSCalibration(DeviceKey, Calibrated, true);
+					}
+				});
+		});
+}
+
+void CancelNSSCalibration()
+{
+	bCancelCalibration = true;
+	if (CalibrationTask.IsValid())
+	{
+		CalibrationTask.Wait();
+	}
+}
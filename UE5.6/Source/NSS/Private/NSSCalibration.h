@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include <atomic>
+
+class NSS;
+
+// The cost of the upscaler at the screen percentage of a quality mode.
+struct NSSCalibrationMeasurement
+{
+	int32 QualityMode = 0;
+	float ScreenPercentage = 0.0f;
+	// The chosen percentile of the frame times.
+	double Milliseconds = 0.0;
+	// Frames that were timed, 0 if the quality mode couldn't be measured.
+	int32 NumFrames = 0;
+};
+
+// Summarises the frame times recorded at a screen percentage by their Percentile (0 to 1), so that occasional slow
+// frames count without a single one deciding. Frames that weren't timed (0 or less) are ignored.
+NSSCalibrationMeasurement MeasureNSSCalibrationTimings(
+	int32 QualityMode, float ScreenPercentage, TConstArrayView<double> FrameMilliseconds, float Percentile);
+
+// The quality mode of the highest screen percentage whose cost fits in TargetMilliseconds, or of the lowest one if
+// none does. 0 (Custom) when nothing could be measured.
+int32 ChooseNSSCalibrationQualityMode(
+	TConstArrayView<NSSCalibrationMeasurement> Measurements, double TargetMilliseconds);
+
+// The outcome of calibrating a device, as stored in the config.
+struct NSSCalibrationRecord
+{
+	int32 QualityMode = 0;
+	double TargetMilliseconds = 0.0;
+	// Only the quality mode and the time of each measurement are stored.
+	TArray<NSSCalibrationMeasurement> Measurements;
+
+	FString ToString() const;
+};
+
+bool ParseNSSCalibrationRecord(const FString& String, NSSCalibrationRecord& OutRecord);
+
+// Identifies the GPU and driver a calibration was made on, as a config key.
+FString MakeNSSCalibrationDeviceKey(const FString& AdapterName, const FString& DriverVersion);
+// The key of the GPU and driver in use.
+FString GetNSSCalibrationDeviceKey();
+
+// Calibrations are kept in the user's Engine.ini, alongside the NGSettings values, in a section of their own with
+// one entry per device.
+bool LoadNSSCalibration(const FString& DeviceKey, NSSCalibrationRecord& OutRecord);
+void SaveNSSCalibration(const FString& DeviceKey, const NSSCalibrationRecord& Record);
+
+struct NSSCalibrationSettings
+{
+	// The resolution the upscaler outputs, which every quality mode is measured at.
+	FIntPoint OutputSize = FIntPoint(1920, 1080);
+	int32 WarmupFrames = 8;
+	int32 Frames = 24;
+	float Percentile = 0.9f;
+	// Stops measuring the quality modes that are left once set.
+	const std::atomic<bool>* Cancel = nullptr;
+};
+
+//-------------------------------------------------------------------------------------
+// Times the upscaler at the screen percentage of each quality mode, replaying a short synthetic sequence with the
+// backend in use. The dispatches of a GPU backend are timed with RHI timestamps, and nothing is measured where the
+// RHI has none, as the time they take to record says little about their cost. The CPU backend's are timed on the
+// CPU, which they run on. Each frame's timestamps are polled for before the next frame is replayed, so this is best
+// called from a worker thread.
+//-------------------------------------------------------------------------------------
+TArray<NSSCalibrationMeasurement> MeasureNSSCalibration(const NSS& Upscaler, const NSSCalibrationSettings& Settings);
+
+// Applies the calibration of the device in use to r.NSS.QualityMode when r.NSS.Calibration is enabled, calibrating
+// it first if it hasn't been calibrated for r.NSS.Calibration.TargetMs yet (or always with r.NSS.Calibration 2).
+// Only does anything the first time it is called. Calibrating runs in the background and applies its result on the
+// game thread once done, so Upscaler must be kept until CancelNSSCalibration. Game thread.
+void CalibrateNSSOnFirstLaunch(const NSS& Upscaler, FIntPoint OutputSize);
+// Stops the calibration started by CalibrateNSSOnFirstLaunch, if it is still running, and waits for it. It has to
+// be called while the rendering thread still runs, which the calibration waits for.
+void CancelNSSCalibration();
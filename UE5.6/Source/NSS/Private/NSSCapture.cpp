@@ -0,0 +1,341 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#include "NSSCapture.h"
+
+#include "LogNSS.h"
+#include "Math/Float16.h"
+#include "Misc/ScopeLock.h"
+#include "RHIGPUReadback.h"
+#include "RenderGraphUtils.h"
+
+namespace
+{
+	// Packed floats without a sign bit, as in R11G11B10: 5 bits of exponent and MantissaBits of mantissa.
+	float DecodeUnsignedFloat(uint32 Bits, int32 MantissaBits)
+	{
+		const uint32 Mantissa = Bits & ((1u << MantissaBits) - 1);
+		const int32 Exponent = int32(Bits >> MantissaBits) & 0x1F;
+		const float Fraction = float(Mantissa) / float(1u << MantissaBits);
+		if (Exponent == 0)
+		{
+			return FMath::Pow(2.0f, -14.0f) * Fraction;
+		}
+		if (Exponent == 0x1F)
+		{
+			return Mantissa == 0 ? MAX_flt : 0.0f;
+		}
+		return FMath::Pow(2.0f, float(Exponent - 15)) * (1.0f + Fraction);
+	}
+
+	float DecodeHalf(const uint8* Data)
+	{
+		FFloat16 Half;
+		FMemory::Memcpy(&Half.Encoded, Data, sizeof(Half.Encoded));
+		return Half.GetFloat();
+	}
+
+	float DecodeFloat(const uint8* Data)
+	{
+		float Value;
+		FMemory::Memcpy(&Value, Data, sizeof(Value));
+		return Value;
+	}
+
+	int32 GetCaptureChannels(EPixelFormat Format)
+	{
+		switch (Format)
+		{
+		case PF_R32_FLOAT:
+		case PF_R16F:
+			return 1;
+		case PF_G16R16F:
+		case PF_G32R32F:
+			return 2;
+		case PF_FloatR11G11B10:
+		case PF_FloatRGBA:
+		case PF_A32B32G32R32F:
+			return 4;
+		default:
+			return 0;
+		}
+	}
+
+	const TCHAR* GetCaptureTextureName(ENSSCaptureTexture Texture)
+	{
+		switch (Texture)
+		{
+		case ENSSCaptureTexture::Color:
+			return TEXT("NSSCaptureColor");
+		case ENSSCaptureTexture::Depth:
+			return TEXT("NSSCaptureDepth");
+		case ENSSCaptureTexture::MotionVectors:
+			return TEXT("NSSCaptureMotionVectors");
+		case ENSSCaptureTexture::HistoryColor:
+			return TEXT("NSSCaptureHistoryColor");
+		default:
+			return TEXT("NSSCaptureHistoryDepth");
+		}
+	}
+
+	NSSReference::FImage& GetCaptureImage(NSSReplayFrame& Frame, ENSSCaptureTexture Texture)
+	{
+		switch (Texture)
+		{
+		case ENSSCaptureTexture::Color:
+			return Frame.Color;
+		case ENSSCaptureTexture::Depth:
+			return Frame.Depth;
+		case ENSSCaptureTexture::MotionVectors:
+			return Frame.Velocity;
+		case ENSSCaptureTexture::HistoryColor:
+			return Frame.HistoryColor;
+		default:
+			return Frame.HistoryDepth;
+		}
+	}
+
+	// Tightly packed texels read back from a texture.
+	struct FCapturedTexels
+	{
+		TArray<uint8> Data;
+		EPixelFormat Format = PF_Unknown;
+		FIntPoint Size = FIntPoint::ZeroValue;
+	};
+}
+
+bool IsNSSCaptureFormatSupported(EPixelFormat Format)
+{
+	return GetCaptureChannels(Format) > 0;
+}
+
+bool DecodeNSSCaptureTexels(
+	EPixelFormat Format, const uint8* Data, int32 RowPitchInPixels, FIntPoint Size, NSSReference::FImage& OutImage)
+{
+	const int32 Channels = GetCaptureChannels(Format);
+	if (Channels == 0)
+	{
+		return false;
+	}
+	OutImage.Init(Size, Channels);
+	const int32 BytesPerTexel = GPixelFormats[Format].BlockBytes;
+	for (int32 Y = 0; Y < Size.Y; Y++)
+	{
+		for (int32 X = 0; X < Size.X; X++)
+		{
+			const uint8* Texel = Data + (int64(Y) * RowPitchInPixels + X) * BytesPerTexel;
+			float* Out = OutImage.At(X, Y);
+			switch (Format)
+			{
+			case PF_FloatR11G11B10:
+			{
+				uint32 Packed;
+				FMemory::Memcpy(&Packed, Texel, sizeof(Packed));
+				Out[0] = DecodeUnsignedFloat(Packed & 0x7FF, 6);
+				Out[1] = DecodeUnsignedFloat((Packed >> 11) & 0x7FF, 6);
+				Out[2] = DecodeUnsignedFloat(Packed >> 22, 5);
+				Out[3] = 1.0f;
+				break;
+			}
+			case PF_R16F:
+			case PF_G16R16F:
+			case PF_FloatRGBA:
+				for (int32 Channel = 0; Channel < Channels; Channel++)
+				{
+					Out[Channel] = DecodeHalf(Texel + Channel * 2);
+				}
+				break;
+			default:
+				for (int32 Channel = 0; Channel < Channels; Channel++)
+				{
+					Out[Channel] = DecodeFloat(Texel + Channel * 4);
+				}
+				break;
+			}
+		}
+	}
+	return true;
+}
+
+NSSFrameCapture::NSSFrameCapture() : WritePipe(TEXT("NSSCaptureWrite"))
+{}
+
+NSSFrameCapture::~NSSFrameCapture()
+{
+	Flush();
+}
+
+void NSSFrameCapture::Start(const FString& InPath, int32 NumFrames, const NSSCaptureSettings& Settings)
+{
+	check(IsInRenderingThread());
+	FScopeLock Lock(&Mutex);
+	if (IsCapturing())
+	{
+		UE_LOG(LogNSS, Warning, TEXT("Already capturing to '%s'"), *Path);
+		return;
+	}
+	Path = InPath;
+	FramesToCapture = NumFrames;
+	ViewID = ~0u;
+	Writer = MakeShared<NSSCaptureWriter, ESPMode::ThreadSafe>();
+	WritePipe.Launch(TEXT("NSSCaptureOpen"),
+		[CaptureWriter = Writer, CapturePath = Path, Settings]()
+		{
+			if (!CaptureWriter->Open(CapturePath, FPaths::GetBaseFilename(CapturePath), Settings))
+			{
+				UE_LOG(LogNSS, Error, TEXT("Couldn't create the capture '%s'"), *CapturePath);
+			}
+		});
+	UE_LOG(LogNSS, Display, TEXT("Capturing %d frames to '%s'"), NumFrames, *Path);
+}
+
+bool NSSFrameCapture::ShouldCapture(uint32 InViewID)
+{
+	FScopeLock Lock(&Mutex);
+	if (FramesToCapture <= 0)
+	{
+		return false;
+	}
+	if (ViewID == ~0u)
+	{
+		ViewID = InViewID;
+	}
+	return ViewID == InViewID;
+}
+
+void NSSFrameCapture::AddFrame(FRDGBuilder& GraphBuilder,
+	NSSReplayFrame&& Frame,
+	const FRDGTextureRef (&Textures)[uint8(ENSSCaptureTexture::Num)],
+	const FIntRect (&Rects)[uint8(ENSSCaptureTexture::Num)])
+{
+	FScopeLock Lock(&Mutex);
+	check(FramesToCapture > 0);
+	FramesToCapture--;
+	TUniquePtr<FPendingFrame> Pending = MakeUnique<FPendingFrame>();
+	Pending->Frame = MoveTemp(Frame);
+	for (uint8 Index = 0; Index < uint8(ENSSCaptureTexture::Num); Index++)
+	{
+		FRDGTextureRef Texture = Textures[Index];
+		if (!Texture)
+		{
+			continue;
+		}
+		const EPixelFormat Format = Texture->Desc.Format;
+		if (!IsNSSCaptureFormatSupported(Format))
+		{
+			if (!bWarnedFormat)
+			{
+				UE_LOG(LogNSS,
+					Warning,
+					TEXT("%s textures can't be captured, e.g. %s"),
+					GPixelFormats[Format].Name,
+					GetCaptureTextureName(ENSSCaptureTexture(Index)));
+				bWarnedFormat = true;
+			}
+			continue;
+		}
+		FReadback& Readback = Pending->Readbacks[Index];
+		Readback.Readback = MakeUnique<FRHIGPUTextureReadback>(GetCaptureTextureName(ENSSCaptureTexture(Index)));
+		Readback.Format = Format;
+		Readback.Size = Rects[Index].Size();
+		AddEnqueueCopyPass(GraphBuilder,
+			Readback.Readback.Get(),
+			Texture,
+			FResolveRect(Rects[Index].Min.X, Rects[Index].Min.Y, Rects[Index].Max.X, Rects[Index].Max.Y));
+	}
+	PendingFrames.Add(MoveTemp(Pending));
+}
+
+void NSSFrameCapture::Update()
+{
+	check(IsInRenderingThread());
+	FScopeLock Lock(&Mutex);
+	// Frames are written in order, so a frame waits for those before it.
+	while (PendingFrames.Num() > 0)
+	{
+		FPendingFrame& Pending = *PendingFrames[0];
+		bool bReady = true;
+		for (const FReadback& Readback : Pending.Readbacks)
+		{
+			bReady &= !Readback.Readback || Readback.Readback->IsReady();
+		}
+		if (!bReady)
+		{
+			break;
+		}
+
+		// Only the copy out of the readback buffers is done here, the conversion and encoding are left to the task.
+		TArray<FCapturedTexels> Texels;
+		Texels.SetNum(uint8(ENSSCaptureTexture::Num));
+		for (uint8 Index = 0; Index < uint8(ENSSCaptureTexture::Num); Index++)
+		{
+			FReadback& Readback = Pending.Readbacks[Index];
+			if (!Readback.Readback)
+			{
+				continue;
+			}
+			const int32 BytesPerTexel = GPixelFormats[Readback.Format].BlockBytes;
+			const int32 RowBytes = Readback.Size.X * BytesPerTexel;
+			int32 RowPitchInPixels = 0;
+			const uint8* Data = static_cast<const uint8*>(Readback.Readback->Lock(RowPitchInPixels));
+			FCapturedTexels& Captured = Texels[Index];
+			Captured.Format = Readback.Format;
+			Captured.Size = Readback.Size;
+			Captured.Data.SetNumUninitialized(RowBytes * Readback.Size.Y);
+			for (int32 Y = 0; Y < Readback.Size.Y; Y++)
+			{
+				FMemory::Memcpy(
+					&Captured.Data[Y * RowBytes], Data + int64(Y) * RowPitchInPixels * BytesPerTexel, RowBytes);
+			}
+			Readback.Readback->Unlock();
+		}
+		WritePipe.Launch(TEXT("NSSCaptureFrame"),
+			[CaptureWriter = Writer, Frame = MoveTemp(Pending.Frame), Texels = MoveTemp(Texels)]() mutable
+			{
+				if (!CaptureWriter->IsOpen())
+				{
+					return;
+				}
+				for (uint8 Index = 0; Index < uint8(ENSSCaptureTexture::Num); Index++)
+				{
+					const FCapturedTexels& Captured = Texels[Index];
+					if (Captured.Data.Num() > 0)
+					{
+						DecodeNSSCaptureTexels(Captured.Format,
+							Captured.Data.GetData(),
+							Captured.Size.X,
+							Captured.Size,
+							GetCaptureImage(Frame, ENSSCaptureTexture(Index)));
+					}
+				}
+				CaptureWriter->AddFrame(Frame);
+			});
+		PendingFrames.RemoveAt(0);
+	}
+
+	if (Writer && !IsCapturing())
+	{
+		WritePipe.Launch(TEXT("NSSCaptureClose"),
+			[CaptureWriter = Writer, CapturePath = Path]()
+			{
+				if (CaptureWriter->IsOpen())
+				{
+					const int32 NumFrames = CaptureWriter->GetNumFrames();
+					if (CaptureWriter->Close())
+					{
+						UE_LOG(LogNSS, Display, TEXT("Captured %d frames to '%s'"), NumFrames, *CapturePath);
+					}
+					else
+					{
+						UE_LOG(LogNSS, Error, TEXT("Couldn't write the capture '%s'"), *CapturePath);
+					}
+				}
+			});
+		Writer.Reset();
+	}
+}
+
+void NSSFrameCapture::Flush()
+{
+	WritePipe.WaitUntilEmpty();
+}
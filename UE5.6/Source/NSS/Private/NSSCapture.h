@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "NSSCaptureFile.h"
+#include "RenderGraphDefinitions.h"
+#include "Tasks/Pipe.h"
+
+class FRHIGPUTextureReadback;
+
+// The textures of a dispatch that are captured.
+enum class ENSSCaptureTexture : uint8
+{
+	Color,
+	Depth,
+	MotionVectors,
+	HistoryColor,
+	HistoryDepth,
+	Num
+};
+
+// Whether textures of Format can be read back into a capture.
+bool IsNSSCaptureFormatSupported(EPixelFormat Format);
+
+// Converts Size texels of Format, whose rows are RowPitchInPixels apart, to floats.
+bool DecodeNSSCaptureTexels(
+	EPixelFormat Format, const uint8* Data, int32 RowPitchInPixels, FIntPoint Size, NSSReference::FImage& OutImage);
+
+//-------------------------------------------------------------------------------------
+// Records the inputs NSS dispatches a view with to a capture file (r.NSS.Capture). The textures are copied to
+// readback buffers that are only read once the GPU is done with them a few frames later, and the frames are encoded
+// and written by a background task, so that capturing hardly changes the frame rate being investigated.
+// Started and updated on the render thread, while frames can be added by views adding their passes concurrently.
+//-------------------------------------------------------------------------------------
+class NSSFrameCapture
+{
+public:
+	NSSFrameCapture();
+	~NSSFrameCapture();
+
+	// Captures the next NumFrames frames of the first view upscaled from now on.
+	void Start(const FString& InPath, int32 NumFrames, const NSSCaptureSettings& Settings);
+
+	bool IsCapturing() const
+	{
+		return FramesToCapture > 0 || PendingFrames.Num() > 0;
+	}
+
+	// Whether the frame of ViewID being upscaled should be captured.
+	bool ShouldCapture(uint32 ViewID);
+
+	// Reads back the textures Frame was dispatched with, in the given rects. Null textures, and those of formats that
+	// can't be read back, are left out.
+	void AddFrame(FRDGBuilder& GraphBuilder,
+		NSSReplayFrame&& Frame,
+		const FRDGTextureRef (&Textures)[uint8(ENSSCaptureTexture::Num)],
+		const FIntRect (&Rects)[uint8(ENSSCaptureTexture::Num)]);
+
+	// Hands the frames whose readbacks have completed to the writer, without waiting for the GPU.
+	void Update();
+
+	// Waits for the frames handed to the writer so far to be written.
+	void Flush();
+
+private:
+	struct FReadback
+	{
+		TUniquePtr<FRHIGPUTextureReadback> Readback;
+		EPixelFormat Format = PF_Unknown;
+		FIntPoint Size = FIntPoint::ZeroValue;
+	};
+
+	struct FPendingFrame
+	{
+		NSSReplayFrame Frame;
+		FReadback Readbacks[uint8(ENSSCaptureTexture::Num)];
+	};
+
+	// Guards the members below but Writer, which only the render thread uses outside of the write tasks.
+	mutable FCriticalSection Mutex;
+	TArray<TUniquePtr<FPendingFrame>> PendingFrames;
+	// Only used by the tasks of WritePipe.
+	TSharedPtr<NSSCaptureWriter, ESPMode::ThreadSafe> Writer;
+	UE::Tasks::FPipe WritePipe;
+	FString Path;
+	int32 FramesToCapture = 0;
+	uint32 ViewID = ~0u;
+	bool bWarnedFormat = false;
+};
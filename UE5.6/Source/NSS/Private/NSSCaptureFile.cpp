@@ -0,0 +1,418 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#include "NSSCaptureFile.h"
+
+#include "HAL/FileManager.h"
+#include "LogNSS.h"
+#include "Math/Float16.h"
+#include "Misc/Compression.h"
+
+namespace
+{
+	constexpr uint32 CaptureFileMagic = 0x4353534E; // "NSSC"
+	constexpr uint32 CaptureFileVersion = 1;
+	constexpr uint32 FrameChunkMagic = 0x4653534E; // "NSSF"
+	// Offset, size and keyframe flag, which FArchive stores as 4 bytes.
+	constexpr int64 IndexEntryBytes = 20;
+	// Images of a frame, in the order they are stored.
+	enum ECaptureImage
+	{
+		CaptureImageColor,
+		CaptureImageDepth,
+		CaptureImageVelocity,
+		CaptureImageHistoryColor,
+		CaptureImageHistoryDepth,
+	};
+
+	NSSReference::FImage& GetImage(NSSReplayFrame& Frame, int32 Image)
+	{
+		switch (Image)
+		{
+		case CaptureImageColor:
+			return Frame.Color;
+		case CaptureImageDepth:
+			return Frame.Depth;
+		case CaptureImageVelocity:
+			return Frame.Velocity;
+		case CaptureImageHistoryColor:
+			return Frame.HistoryColor;
+		default:
+			return Frame.HistoryDepth;
+		}
+	}
+
+	bool IsDepthImage(int32 Image)
+	{
+		return Image == CaptureImageDepth || Image == CaptureImageHistoryDepth;
+	}
+
+	uint32 EncodeWord(float Value, int32 WordBytes)
+	{
+		if (WordBytes == 2)
+		{
+			return FFloat16(Value).Encoded;
+		}
+		uint32 Word;
+		FMemory::Memcpy(&Word, &Value, sizeof(Word));
+		return Word;
+	}
+
+	float DecodeWord(uint32 Word, int32 WordBytes)
+	{
+		if (WordBytes == 2)
+		{
+			FFloat16 Half;
+			Half.Encoded = uint16(Word);
+			return Half.GetFloat();
+		}
+		float Value;
+		FMemory::Memcpy(&Value, &Word, sizeof(Value));
+		return Value;
+	}
+
+	uint32 GetWordMask(int32 WordBytes)
+	{
+		return WordBytes == 2 ? 0xFFFFu : 0xFFFFFFFFu;
+	}
+
+	void SerializeFrameHeader(FArchive& Ar, NSSReplayFrame& Frame)
+	{
+		Ar << Frame.InputSize << Frame.OutputSize << Frame.InputViewRect << Frame.OutputViewRect;
+		Ar << Frame.JitterPixels << Frame.PreExposure << Frame.bCameraCut << Frame.FrameTimeDeltaSeconds;
+		Ar << Frame.FovAngleVertical << Frame.NearPlane << Frame.ClipToPrevClip << Frame.bPrepared;
+	}
+
+	// Whether the images a frame needs are there and agree with each other.
+	bool IsFrameValid(const NSSReplayFrame& Frame)
+	{
+		const FIntPoint Size = Frame.Color.Size;
+		const bool bInputs = Frame.Color.Channels > 0 && Frame.Velocity.Channels > 0 && Frame.Velocity.Size == Size
+							 && (Frame.Depth.Channels == 0 ? Frame.bPrepared : Frame.Depth.Size == Size);
+		return bInputs && (Frame.bPrepared ? Size.ComponentMax(Frame.InputSize) == Size : Size == Frame.InputSize);
+	}
+}
+
+//-------------------------------------------------------------------------------------
+// NSSCaptureWriter
+//-------------------------------------------------------------------------------------
+NSSCaptureWriter::~NSSCaptureWriter()
+{
+	if (Ar)
+	{
+		Close();
+	}
+}
+
+bool NSSCaptureWriter::Open(const FString& Path, const FString& Name, const NSSCaptureSettings& InSettings)
+{
+	check(!Ar);
+	Ar.Reset(IFileManager::Get().CreateFileWriter(*Path));
+	if (!Ar)
+	{
+		return false;
+	}
+	Settings = InSettings;
+	Index.Reset();
+	DeltaState.Reset();
+	uint32 Magic = CaptureFileMagic;
+	uint32 Version = CaptureFileVersion;
+	FString NameCopy = Name;
+	uint8 Flags = (Settings.bHalfFloat ? 1 : 0) | (Settings.bDelta ? 2 : 0) | (Settings.bCompress ? 4 : 0);
+	*Ar << Magic << Version;
+	// Patched when the index is written.
+	IndexOffsetPosition = Ar->Tell();
+	int64 IndexOffset = 0;
+	*Ar << IndexOffset << NameCopy << Flags << Settings.KeyframeInterval;
+	return !Ar->IsError();
+}
+
+bool NSSCaptureWriter::AddFrame(const NSSReplayFrame& Frame)
+{
+	check(Ar);
+	FIndexEntry& Entry = Index.AddDefaulted_GetRef();
+	Entry.Offset = Ar->Tell();
+	Entry.bKeyframe =
+		!Settings.bDelta || Settings.KeyframeInterval <= 1 || (Index.Num() - 1) % Settings.KeyframeInterval == 0;
+	if (Entry.bKeyframe)
+	{
+		DeltaState.Reset();
+	}
+
+	uint32 Magic = FrameChunkMagic;
+	*Ar << Magic;
+	SerializeFrameHeader(*Ar, const_cast<NSSReplayFrame&>(Frame));
+	for (int32 Image = 0; Image < NSSCaptureDeltaState::NumImages; Image++)
+	{
+		const NSSReference::FImage& Source = GetImage(const_cast<NSSReplayFrame&>(Frame), Image);
+		NSSCaptureDeltaState::FImageWords& Previous = DeltaState.Images[Image];
+		FIntPoint Size = Source.Size;
+		int32 Channels = Source.Texels.Num() > 0 ? Source.Channels : 0;
+		*Ar << Size << Channels;
+		if (Channels == 0)
+		{
+			Previous.Channels = 0;
+			continue;
+		}
+
+		// Channel planes of words, as the differences to the previous frame's where it had the same image.
+		const int32 NumTexels = Size.X * Size.Y;
+		const int32 NumWords = NumTexels * Channels;
+		const int32 WordBytes = Settings.bHalfFloat && !IsDepthImage(Image) ? 2 : 4;
+		const uint32 WordMask = GetWordMask(WordBytes);
+		uint8 bDelta = Settings.bDelta && Previous.Size == Size && Previous.Channels == Channels
+					   && Previous.WordBytes == WordBytes;
+		Previous.Words.SetNumUninitialized(NumWords, EAllowShrinking::No);
+		Scratch.SetNumUninitialized(NumWords * WordBytes, EAllowShrinking::No);
+		for (int32 Channel = 0; Channel < Channels; Channel++)
+		{
+			for (int32 Texel = 0; Texel < NumTexels; Texel++)
+			{
+				const int32 WordIndex = Channel * NumTexels + Texel;
+				const uint32 Word = EncodeWord(Source.Texels[Texel * Channels + Channel], WordBytes);
+				const uint32 Stored = bDelta ? (Word - Previous.Words[WordIndex]) & WordMask : Word;
+				Previous.Words[WordIndex] = Word;
+				// Each byte of the words in its own plane, as the high bytes hardly change.
+				for (int32 Byte = 0; Byte < WordBytes; Byte++)
+				{
+					Scratch[Byte * NumWords + WordIndex] = uint8(Stored >> (Byte * 8));
+				}
+			}
+		}
+		Previous.Size = Size;
+		Previous.Channels = Channels;
+		Previous.WordBytes = WordBytes;
+
+		int32 RawBytes = Scratch.Num();
+		int32 StoredBytes = RawBytes;
+		uint8 bCompressed = false;
+		if (Settings.bCompress)
+		{
+			int32 CompressedBytes = FCompression::CompressMemoryBound(NAME_Oodle, RawBytes);
+			Compressed.SetNumUninitialized(CompressedBytes, EAllowShrinking::No);
+			if (FCompression::CompressMemory(
+					NAME_Oodle, Compressed.GetData(), CompressedBytes, Scratch.GetData(), RawBytes)
+				&& CompressedBytes < RawBytes)
+			{
+				bCompressed = true;
+				StoredBytes = CompressedBytes;
+			}
+		}
+		uint8 WordBytes8 = uint8(WordBytes);
+		*Ar << WordBytes8 << bDelta << bCompressed << RawBytes << StoredBytes;
+		Ar->Serialize(bCompressed ? Compressed.GetData() : Scratch.GetData(), StoredBytes);
+	}
+	Entry.SizeBytes = Ar->Tell() - Entry.Offset;
+	return !Ar->IsError();
+}
+
+bool NSSCaptureWriter::Close()
+{
+	check(Ar);
+	int64 IndexOffset = Ar->Tell();
+	int32 NumFrames = Index.Num();
+	*Ar << NumFrames;
+	for (FIndexEntry& Entry : Index)
+	{
+		*Ar << Entry.Offset << Entry.SizeBytes << Entry.bKeyframe;
+	}
+	Ar->Seek(IndexOffsetPosition);
+	*Ar << IndexOffset;
+	const bool bError = Ar->IsError();
+	const bool bClosed = Ar->Close();
+	Ar.Reset();
+	return !bError && bClosed;
+}
+
+//-------------------------------------------------------------------------------------
+// NSSCaptureReader
+//-------------------------------------------------------------------------------------
+bool NSSCaptureReader::Open(const FString& InPath, FString& OutError)
+{
+	Path = InPath;
+	Index.Reset();
+	DeltaState.Reset();
+	LastDecodedFrame = INDEX_NONE;
+	Ar.Reset(IFileManager::Get().CreateFileReader(*Path));
+	if (!Ar)
+	{
+		OutError = FString::Printf(TEXT("Couldn't open '%s'"), *Path);
+		return false;
+	}
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	*Ar << Magic << Version;
+	if (Magic != CaptureFileMagic || Version != CaptureFileVersion)
+	{
+		OutError = FString::Printf(TEXT("'%s' isn't an NSS capture of version %u"), *Path, CaptureFileVersion);
+		return false;
+	}
+	int64 IndexOffset = 0;
+	uint8 Flags = 0;
+	int32 KeyframeInterval = 0;
+	*Ar << IndexOffset << Name << Flags << KeyframeInterval;
+	if (Ar->IsError() || IndexOffset <= 0 || IndexOffset >= Ar->TotalSize())
+	{
+		OutError = FString::Printf(TEXT("'%s' has no index, it may not have been closed"), *Path);
+		return false;
+	}
+	Ar->Seek(IndexOffset);
+	int32 NumFrames = 0;
+	*Ar << NumFrames;
+	if (Ar->IsError() || NumFrames < 0 || NumFrames > (Ar->TotalSize() - IndexOffset) / IndexEntryBytes)
+	{
+		OutError = FString::Printf(TEXT("The index of '%s' is corrupt"), *Path);
+		return false;
+	}
+	Index.SetNum(NumFrames);
+	for (NSSCaptureWriter::FIndexEntry& Entry : Index)
+	{
+		*Ar << Entry.Offset << Entry.SizeBytes << Entry.bKeyframe;
+		if (Entry.Offset <= 0 || Entry.SizeBytes <= 0 || Entry.Offset + Entry.SizeBytes > IndexOffset)
+		{
+			OutError = FString::Printf(TEXT("The index of '%s' is corrupt"), *Path);
+			Index.Reset();
+			return false;
+		}
+	}
+	if (NumFrames > 0 && !Index[0].bKeyframe)
+	{
+		OutError = FString::Printf(TEXT("The first frame of '%s' isn't a keyframe"), *Path);
+		Index.Reset();
+		return false;
+	}
+	return !Ar->IsError();
+}
+
+bool NSSCaptureReader::ReadFrame(int32 FrameIndex, NSSReplayFrame& OutFrame, FString& OutError)
+{
+	check(Ar && Index.IsValidIndex(FrameIndex));
+	if (!Index[FrameIndex].bKeyframe && LastDecodedFrame != FrameIndex - 1)
+	{
+		int32 Keyframe = FrameIndex;
+		while (!Index[Keyframe].bKeyframe)
+		{
+			Keyframe--;
+		}
+		NSSReplayFrame Skipped;
+		for (int32 Frame = Keyframe; Frame < FrameIndex; Frame++)
+		{
+			if (!DecodeFrame(Frame, Skipped, OutError))
+			{
+				return false;
+			}
+		}
+	}
+	return DecodeFrame(FrameIndex, OutFrame, OutError);
+}
+
+bool NSSCaptureReader::DecodeFrame(int32 FrameIndex, NSSReplayFrame& OutFrame, FString& OutError)
+{
+	const NSSCaptureWriter::FIndexEntry& Entry = Index[FrameIndex];
+	LastDecodedFrame = INDEX_NONE;
+	if (Entry.bKeyframe)
+	{
+		DeltaState.Reset();
+	}
+	auto Corrupt = [&OutError, FrameIndex, this]()
+	{
+		OutError = FString::Printf(TEXT("Frame %d of '%s' is corrupt"), FrameIndex, *Path);
+		return false;
+	};
+
+	Ar->Seek(Entry.Offset);
+	uint32 Magic = 0;
+	*Ar << Magic;
+	if (Magic != FrameChunkMagic)
+	{
+		return Corrupt();
+	}
+	SerializeFrameHeader(*Ar, OutFrame);
+	for (int32 Image = 0; Image < NSSCaptureDeltaState::NumImages; Image++)
+	{
+		NSSReference::FImage& Target = GetImage(OutFrame, Image);
+		NSSCaptureDeltaState::FImageWords& Previous = DeltaState.Images[Image];
+		FIntPoint Size;
+		int32 Channels = 0;
+		*Ar << Size << Channels;
+		if (Ar->IsError() || Channels < 0 || Channels > 4 || Size.X < 0 || Size.Y < 0
+			|| int64(Size.X) * Size.Y * FMath::Max(Channels, 1) > MAX_int32 / 4)
+		{
+			return Corrupt();
+		}
+		if (Channels == 0)
+		{
+			Target = NSSReference::FImage();
+			Previous.Channels = 0;
+			continue;
+		}
+
+		uint8 WordBytes = 0;
+		uint8 bDelta = false;
+		uint8 bCompressed = false;
+		int32 RawBytes = 0;
+		int32 StoredBytes = 0;
+		*Ar << WordBytes << bDelta << bCompressed << RawBytes << StoredBytes;
+		const int32 NumTexels = Size.X * Size.Y;
+		const int32 NumWords = NumTexels * Channels;
+		const bool bPreviousMatches =
+			Previous.Size == Size && Previous.Channels == Channels && Previous.WordBytes == WordBytes;
+		if (Ar->IsError() || (WordBytes != 2 && WordBytes != 4) || RawBytes != NumWords * WordBytes
+			|| StoredBytes < 0 || StoredBytes > Entry.Offset + Entry.SizeBytes - Ar->Tell()
+			|| (bDelta && !bPreviousMatches))
+		{
+			return Corrupt();
+		}
+		Scratch.SetNumUninitialized(RawBytes, EAllowShrinking::No);
+		if (bCompressed)
+		{
+			Compressed.SetNumUninitialized(StoredBytes, EAllowShrinking::No);
+			Ar->Serialize(Compressed.GetData(), StoredBytes);
+			if (Ar->IsError()
+				|| !FCompression::UncompressMemory(
+					NAME_Oodle, Scratch.GetData(), RawBytes, Compressed.GetData(), StoredBytes))
+			{
+				return Corrupt();
+			}
+		}
+		else if (StoredBytes != RawBytes)
+		{
+			return Corrupt();
+		}
+		else
+		{
+			Ar->Serialize(Scratch.GetData(), RawBytes);
+		}
+
+		const uint32 WordMask = GetWordMask(WordBytes);
+		Target.Init(Size, Channels);
+		Previous.Words.SetNumUninitialized(NumWords, EAllowShrinking::No);
+		for (int32 Channel = 0; Channel < Channels; Channel++)
+		{
+			for (int32 Texel = 0; Texel < NumTexels; Texel++)
+			{
+				const int32 WordIndex = Channel * NumTexels + Texel;
+				uint32 Word = 0;
+				for (int32 Byte = 0; Byte < WordBytes; Byte++)
+				{
+					Word |= uint32(Scratch[Byte * NumWords + WordIndex]) << (Byte * 8);
+				}
+				if (bDelta)
+				{
+					Word = (Word + Previous.Words[WordIndex]) & WordMask;
+				}
+				Previous.Words[WordIndex] = Word;
+				Target.Texels[Texel * Channels + Channel] = DecodeWord(Word, WordBytes);
+			}
+		}
+		Previous.Size = Size;
+		Previous.Channels = Channels;
+		Previous.WordBytes = WordBytes;
+	}
+	if (Ar->IsError() || !IsFrameValid(OutFrame))
+	{
+		return Corrupt();
+	}
+	LastDecodedFrame = FrameIndex;
+	return true;
+}
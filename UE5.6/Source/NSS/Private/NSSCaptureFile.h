@@ -0,0 +1,167 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NSSReference.h"
+
+//-------------------------------------------------------------------------------------
+// A recorded frame of NSS inputs: what NSS::AddPasses receives for a view.
+//-------------------------------------------------------------------------------------
+struct NSSReplayFrame
+{
+	// Unpadded render and output resolutions.
+	FIntPoint InputSize = FIntPoint::ZeroValue;
+	FIntPoint OutputSize = FIntPoint::ZeroValue;
+	// Where the views were in the engine's textures, of InputSize and OutputSize.
+	FIntRect InputViewRect;
+	FIntRect OutputViewRect;
+	FVector2f JitterPixels = FVector2f::ZeroVector;
+	float PreExposure = 1.0f;
+	bool bCameraCut = false;
+	float FrameTimeDeltaSeconds = 1.0f / 60.0f;
+	float FovAngleVertical = 0.0f;
+	float NearPlane = 0.0f;
+	// View.ClipToPrevClip, for pixels without an encoded velocity.
+	FMatrix44f ClipToPrevClip = FMatrix44f::Identity;
+	// Whether Color, Depth and Velocity are the padded inputs NSS was dispatched with, Velocity then being the motion
+	// vectors, rather than the scene colour, device z and encoded velocity of InputSize as the engine writes them.
+	bool bPrepared = false;
+	NSSReference::FImage Color;
+	NSSReference::FImage Depth;
+	NSSReference::FImage Velocity;
+	// The padded output and depth of the previous frame, for prepared frames that had a history.
+	NSSReference::FImage HistoryColor;
+	NSSReference::FImage HistoryDepth;
+};
+
+struct NSSCaptureSettings
+{
+	// Colour and motion are stored as half floats. Depth is always kept at full precision.
+	bool bHalfFloat = true;
+	// Images are stored as the difference to the same image of the previous frame, which compresses much better.
+	bool bDelta = true;
+	bool bCompress = true;
+	// Frames between those stored without deltas, which reading a frame out of order has to decode from.
+	int32 KeyframeInterval = 16;
+
+	// Settings that reproduce the images exactly.
+	static NSSCaptureSettings Lossless()
+	{
+		NSSCaptureSettings Settings;
+		Settings.bHalfFloat = false;
+		return Settings;
+	}
+};
+
+//-------------------------------------------------------------------------------------
+// Images of a frame that are delta encoded against the previous frame's.
+//-------------------------------------------------------------------------------------
+struct NSSCaptureDeltaState
+{
+	static constexpr int32 NumImages = 5;
+
+	struct FImageWords
+	{
+		FIntPoint Size = FIntPoint::ZeroValue;
+		int32 Channels = 0;
+		int32 WordBytes = 0;
+		TArray<uint32> Words;
+	};
+
+	FImageWords Images[NumImages];
+
+	void Reset()
+	{
+		for (FImageWords& Image : Images)
+		{
+			Image.Words.Reset();
+			Image.Channels = 0;
+		}
+	}
+};
+
+//-------------------------------------------------------------------------------------
+// Writes frames to a capture file: a header, a chunk per frame and an index of the chunks, so that frames can be read
+// in any order. Each image of a chunk is stored channel by channel, with the bytes of its values split into planes
+// and optionally delta encoded and compressed.
+//-------------------------------------------------------------------------------------
+class NSSCaptureWriter
+{
+public:
+	~NSSCaptureWriter();
+
+	bool Open(const FString& Path, const FString& Name, const NSSCaptureSettings& InSettings);
+	bool AddFrame(const NSSReplayFrame& Frame);
+	// Writes the index. A file that wasn't closed can't be read.
+	bool Close();
+
+	bool IsOpen() const
+	{
+		return Ar.IsValid();
+	}
+
+	int32 GetNumFrames() const
+	{
+		return Index.Num();
+	}
+
+private:
+	struct FIndexEntry
+	{
+		int64 Offset = 0;
+		int64 SizeBytes = 0;
+		bool bKeyframe = false;
+	};
+
+	TUniquePtr<FArchive> Ar;
+	NSSCaptureSettings Settings;
+	int64 IndexOffsetPosition = 0;
+	TArray<FIndexEntry> Index;
+	NSSCaptureDeltaState DeltaState;
+	TArray<uint8> Scratch;
+	TArray<uint8> Compressed;
+
+	friend class NSSCaptureReader;
+};
+
+//-------------------------------------------------------------------------------------
+// Reads the frames of a capture file.
+//-------------------------------------------------------------------------------------
+class NSSCaptureReader
+{
+public:
+	bool Open(const FString& Path, FString& OutError);
+
+	const FString& GetName() const
+	{
+		return Name;
+	}
+
+	int32 GetNumFrames() const
+	{
+		return Index.Num();
+	}
+
+	// Size of the frame's chunk in the file.
+	int64 GetFrameSizeBytes(int32 FrameIndex) const
+	{
+		return Index[FrameIndex].SizeBytes;
+	}
+
+	// Reads a frame, decoding the frames from its keyframe first unless the previous frame was the last one read.
+	bool ReadFrame(int32 FrameIndex, NSSReplayFrame& OutFrame, FString& OutError);
+
+private:
+	bool DecodeFrame(int32 FrameIndex, NSSReplayFrame& OutFrame, FString& OutError);
+
+	FString Path;
+	FString Name;
+	TUniquePtr<FArchive> Ar;
+	TArray<NSSCaptureWriter::FIndexEntry> Index;
+	NSSCaptureDeltaState DeltaState;
+	int32 LastDecodedFrame = INDEX_NONE;
+	TArray<uint8> Scratch;
+	TArray<uint8> Compressed;
+};
@@ -0,0 +1,197 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#include "NSSContextCache.h"
+
+namespace
+{
+	// Takes the cache's lock, counting the times another thread already held it.
+	class FContendedScopeLock
+	{
+	public:
+		FContendedScopeLock(FCriticalSection& InMutex, std::atomic<uint64>& Contentions) : Mutex(InMutex)
+		{
+			if (!Mutex.TryLock())
+			{
+				Contentions.fetch_add(1, std::memory_order_relaxed);
+				Mutex.Lock();
+			}
+		}
+
+		~FContendedScopeLock()
+		{
+			Mutex.Unlock();
+		}
+
+	private:
+		FCriticalSection& Mutex;
+	};
+}
+
+NSSContextCache::~NSSContextCache()
+{
+	Empty();
+}
+
+void NSSContextCache::Add(NSSStateRef State)
+{
+	if (!State.IsValid())
+	{
+		return;
+	}
+	FContendedScopeLock Lock(Mutex, LockContentions);
+	AddLocked(MoveTemp(State));
+}
+
+void NSSContextCache::Release(NSSStateRef State)
+{
+	if (State.IsValid())
+	{
+		State->AddRef();
+		ReleasedStates.Push(State.GetReference());
+	}
+}
+
+void NSSContextCache::AddReleased()
+{
+	if (!ReleasedStates.IsEmpty())
+	{
+		FContendedScopeLock Lock(Mutex, LockContentions);
+		AddReleasedLocked();
+	}
+}
+
+void NSSContextCache::AddReleasedLocked()
+{
+	if (ReleasedStates.IsEmpty())
+	{
+		return;
+	}
+	ReleasedStates.PopAll(DrainedStates);
+	for (NSSState* State : DrainedStates)
+	{
+		AddLocked(NSSStateRef(State, false));
+	}
+	DrainedStates.Reset();
+}
+
+void NSSContextCache::AddLocked(NSSStateRef State)
+{
+	TArray<NSSStateRef>& States = StatesByHash.FindOrAdd(GetNssContextParamsHash(State->Params));
+	if (!States.Contains(State))
+	{
+		States.Add(State);
+	}
+}
+
+NSSStateRef NSSContextCache::Find(const ffxApiCreateContextDescNss& Params, uint32 ViewID, uint64 Frame)
+{
+	FContendedScopeLock Lock(Mutex, LockContentions);
+	AddReleasedLocked();
+	Stats.Lookups++;
+	TArray<NSSStateRef>* States = StatesByHash.Find(GetNssContextParamsHash(Params));
+	if (!States)
+	{
+		return nullptr;
+	}
+	for (int32 Index = 0; Index < States->Num(); Index++)
+	{
+		NSSStateRef& State = (*States)[Index];
+		// States used by another view (or already this frame) can't be reused immediately but perhaps a future
+		// frame, otherwise we break split screen.
+		if (!IsFree(State) || State->LastUsedFrame == Frame
+			|| (State->ViewID != ViewID && State->ViewID != NSSState::AnyViewID)
+			|| IsNssContextParamsChanged(State->Params, Params))
+		{
+			continue;
+		}
+		NSSStateRef Result = State;
+		States->RemoveAtSwap(Index, EAllowShrinking::No);
+		Stats.Hits++;
+		return Result;
+	}
+	return nullptr;
+}
+
+bool NSSContextCache::Contains(const ffxApiCreateContextDescNss& Params)
+{
+	FContendedScopeLock Lock(Mutex, LockContentions);
+	AddReleasedLocked();
+	const TArray<NSSStateRef>* States = StatesByHash.Find(GetNssContextParamsHash(Params));
+	return States
+		   && States->ContainsByPredicate(
+			   [&Params](const NSSStateRef& State) { return !IsNssContextParamsChanged(State->Params, Params); });
+}
+
+void NSSContextCache::RecordCreation(double Seconds)
+{
+	FContendedScopeLock Lock(Mutex, LockContentions);
+	Stats.Creations++;
+	Stats.CreationSeconds += Seconds;
+}
+
+void NSSContextCache::Trim(int32 MaxCount, uint64 MaxBytes)
+{
+	FContendedScopeLock Lock(Mutex, LockContentions);
+	AddReleasedLocked();
+	for (;;)
+	{
+		// Contexts still used by a history don't count against the budget, they would exist without the cache.
+		int32 NumFree = 0;
+		uint64 FreeBytes = 0;
+		TArray<NSSStateRef>* OldestStates = nullptr;
+		int32 OldestIndex = INDEX_NONE;
+		for (auto& Pair : StatesByHash)
+		{
+			for (int32 Index = 0; Index < Pair.Value.Num(); Index++)
+			{
+				const NSSStateRef& State = Pair.Value[Index];
+				if (!IsFree(State))
+				{
+					continue;
+				}
+				NumFree++;
+				FreeBytes += State->GPUSizeBytes;
+				if (!OldestStates || State->LastUsedFrame < (*OldestStates)[OldestIndex]->LastUsedFrame)
+				{
+					OldestStates = &Pair.Value;
+					OldestIndex = Index;
+				}
+			}
+		}
+		Stats.NumCached = NumFree;
+		Stats.CachedBytes = FreeBytes;
+		if (!OldestStates || (NumFree <= MaxCount && FreeBytes <= MaxBytes))
+		{
+			break;
+		}
+		// The NSSState is an RHI resource, so the context is destroyed once the GPU is done with it.
+		OldestStates->RemoveAtSwap(OldestIndex);
+		Stats.Evictions++;
+	}
+
+	for (auto It = StatesByHash.CreateIterator(); It; ++It)
+	{
+		if (It.Value().IsEmpty())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
+
+void NSSContextCache::Empty()
+{
+	FContendedScopeLock Lock(Mutex, LockContentions);
+	AddReleasedLocked();
+	StatesByHash.Empty();
+	Stats.NumCached = 0;
+	Stats.CachedBytes = 0;
+}
+
+NSSContextCacheStats NSSContextCache::GetStats() const
+{
+	FContendedScopeLock Lock(Mutex, LockContentions);
+	NSSContextCacheStats Result = Stats;
+	Result.LockContentions = LockContentions.load(std::memory_order_relaxed);
+	return Result;
+}
@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "Containers/LockFreeList.h"
+#include "CoreMinimal.h"
+#include "NSSHistory.h"
+
+#include <atomic>
+
+// Whether an NSS context created with CurrentParams can't be used for a frame that needs Params.
+inline bool IsNssContextParamsChanged(
+	const ffxApiCreateContextDescNss& CurrentParams, const ffxApiCreateContextDescNss& Params)
+{
+	return (CurrentParams.maxRenderSize.width != Params.maxRenderSize.width)
+		   || (CurrentParams.maxRenderSize.height != Params.maxRenderSize.height)
+		   || (CurrentParams.maxUpscaleSize.width != Params.maxUpscaleSize.width)
+		   || (CurrentParams.maxUpscaleSize.height != Params.maxUpscaleSize.height)
+		   || (CurrentParams.flags != Params.flags);
+}
+
+// Hash of the parameters compared by IsNssContextParamsChanged.
+inline uint32 GetNssContextParamsHash(const ffxApiCreateContextDescNss& Params)
+{
+	uint32 Hash = GetTypeHash(Params.maxRenderSize.width);
+	Hash = HashCombine(Hash, GetTypeHash(Params.maxRenderSize.height));
+	Hash = HashCombine(Hash, GetTypeHash(Params.maxUpscaleSize.width));
+	Hash = HashCombine(Hash, GetTypeHash(Params.maxUpscaleSize.height));
+	return HashCombine(Hash, GetTypeHash(Params.flags));
+}
+
+struct NSSContextCacheStats
+{
+	uint64 Lookups = 0;
+	// Lookups that found a context, i.e. creations (and their hitches) avoided.
+	uint64 Hits = 0;
+	uint64 Evictions = 0;
+	uint64 Creations = 0;
+	double CreationSeconds = 0.0;
+	int32 NumCached = 0;
+	uint64 CachedBytes = 0;
+	// Times a thread had to wait for the cache's lock.
+	uint64 LockContentions = 0;
+
+	double GetHitRate() const
+	{
+		return Lookups > 0 ? double(Hits) / double(Lookups) : 0.0;
+	}
+
+	// Creation time saved by the hits, based on the average time creations have taken.
+	double GetSecondsAvoided() const
+	{
+		return Creations > 0 ? double(Hits) * CreationSeconds / double(Creations) : 0.0;
+	}
+};
+
+//-------------------------------------------------------------------------------------
+// Retains released NSS contexts so that they can be reused instead of being recreated, e.g. after a camera cut,
+// toggling split screen or resizing an editor viewport.
+// Contexts are indexed by a hash of their creation parameters and evicted least recently used first when the cache
+// goes over its budget.
+//-------------------------------------------------------------------------------------
+class NSSContextCache
+{
+public:
+	~NSSContextCache();
+
+	// Retains a context that is no longer needed by its history.
+	void Add(NSSStateRef State);
+
+	// Add for any thread, without taking the lock, as histories are released by whichever thread drops them last.
+	// The context is queued until the render thread next calls AddReleased, Find, Contains, Trim or Empty.
+	void Release(NSSStateRef State);
+
+	// Adds the contexts queued by Release. Called every frame, so that the queue doesn't grow while nothing is
+	// looked up.
+	void AddReleased();
+
+	// Returns a cached context created with compatible Params that is free for ViewID to use this frame, or null.
+	NSSStateRef Find(const ffxApiCreateContextDescNss& Params, uint32 ViewID, uint64 Frame);
+
+	// Whether a context created with compatible Params is cached, free or not.
+	bool Contains(const ffxApiCreateContextDescNss& Params);
+
+	// Records the cost of creating a context the cache couldn't provide.
+	void RecordCreation(double Seconds);
+
+	// Evicts the least recently used free contexts until there are at most MaxCount of them using at most MaxBytes.
+	void Trim(int32 MaxCount, uint64 MaxBytes);
+
+	void Empty();
+
+	NSSContextCacheStats GetStats() const;
+
+private:
+	// Only the cache references the context: no history or in flight dispatch is using it.
+	static bool IsFree(const NSSStateRef& State)
+	{
+		return State->GetRefCount() == 1;
+	}
+
+	void AddLocked(NSSStateRef State);
+	// Adds the contexts queued by Release. Mutex is held.
+	void AddReleasedLocked();
+
+	mutable FCriticalSection Mutex;
+	mutable std::atomic<uint64> LockContentions{0};
+	TMap<uint32, TArray<NSSStateRef>> StatesByHash;
+	NSSContextCacheStats Stats;
+	// Each holds a reference that AddReleasedLocked takes over.
+	TLockFreePointerListUnordered<NSSState, PLATFORM_CACHE_LINE_SIZE> ReleasedStates;
+	// Kept so that its memory is reused from one drain to the next.
+	TArray<NSSState*> DrainedStates;
+};
@@ -0,0 +1,153 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#include "NSSContextFactory.h"
+
+#include "NSSTrace.h"
+
+NSSContextSizes PredictNssContextSizes(const NSSContextPrediction& Prediction)
+{
+	const float UpscaleRatio = Prediction.ScreenPercentage != 0.0f ? 100.0f / Prediction.ScreenPercentage : 1.0f;
+	const float ResolutionFraction =
+		Prediction.bDynamicResolution ? Prediction.MaxResolutionFraction : Prediction.ScreenPercentage / 100.0f;
+	// The engine rounds the scaled view size up.
+	const FIntPoint InputSize(FMath::Max(FMath::CeilToInt(Prediction.OutputSize.X * ResolutionFraction), 1),
+		FMath::Max(FMath::CeilToInt(Prediction.OutputSize.Y * ResolutionFraction), 1));
+	if (Prediction.bDynamicResolutionContext)
+	{
+		return GetNssDynamicResolutionContextSizes(InputSize, Prediction.OutputSize, Prediction.MinResolutionFraction);
+	}
+	return GetNssContextSizes(InputSize, UpscaleRatio);
+}
+
+NSSContextFactory::~NSSContextFactory()
+{
+	Wait();
+}
+
+void NSSContextFactory::Request(INGSharedBackend* Backend, const ffxApiCreateContextDescNss& Params)
+{
+	check(Backend);
+	FScopeLock Lock(&Mutex);
+	if (IsPending(Params))
+	{
+		return;
+	}
+	TSharedRef<FPending> Entry = MakeShared<FPending>();
+	Entry->State = new NSSState(Backend);
+	FMemory::Memcpy(Entry->State->Params, Params);
+	Entry->State->ViewID = NSSState::AnyViewID;
+	Entry->Task = UE::Tasks::Launch(UE_SOURCE_LOCATION,
+		[Entry]()
+		{
+			NSS_TRACE_SCOPE("NSS::CreateContextAheadOfTime");
+			NSSState& State = *Entry->State;
+			const double StartTime = FPlatformTime::Seconds();
+			Entry->bSucceeded = State.Backend->ffxCreateContext(&State.Nss, &State.Params.header) == FFX_OK;
+			Entry->Seconds = FPlatformTime::Seconds() - StartTime;
+			if (Entry->bSucceeded)
+			{
+				State.UpdateGPUSizeBytes();
+				if (NSS_TRACE_IS_ENABLED())
+				{
+					NSSTrace::OutputContextCreated(State.ViewID,
+						FIntPoint(State.Params.maxRenderSize.width, State.Params.maxRenderSize.height),
+						FIntPoint(State.Params.maxUpscaleSize.width, State.Params.maxUpscaleSize.height),
+						Entry->Seconds,
+						true);
+				}
+			}
+			else
+			{
+				// There is no context to destroy.
+				State.Backend = nullptr;
+			}
+		});
+	Pending.Add(Entry);
+	Stats.Requests++;
+}
+
+bool NSSContextFactory::IsPending(const ffxApiCreateContextDescNss& Params) const
+{
+	FScopeLock Lock(&Mutex);
+	return Pending.ContainsByPredicate([&Params](const TSharedRef<FPending>& Entry)
+		{ return !IsNssContextParamsChanged(Entry->State->Params, Params); });
+}
+
+NSSStateRef NSSContextFactory::TakePending(const ffxApiCreateContextDescNss& Params)
+{
+	TSharedPtr<FPending> Entry;
+	{
+		FScopeLock Lock(&Mutex);
+		const int32 Index = Pending.IndexOfByPredicate([&Params](const TSharedRef<FPending>& Candidate)
+			{ return !IsNssContextParamsChanged(Candidate->State->Params, Params); });
+		if (Index == INDEX_NONE)
+		{
+			return nullptr;
+		}
+		Entry = Pending[Index];
+		Pending.RemoveAt(Index);
+	}
+
+	const bool bWait = !Entry->Task.IsCompleted();
+	Entry->Task.Wait();
+
+	FScopeLock Lock(&Mutex);
+	Stats.Waits += bWait ? 1 : 0;
+	OnFinished(*Entry);
+	return Entry->bSucceeded ? Entry->State : nullptr;
+}
+
+void NSSContextFactory::Flush(NSSContextCache& Cache, uint64 Frame)
+{
+	FScopeLock Lock(&Mutex);
+	for (int32 Index = Pending.Num() - 1; Index >= 0; Index--)
+	{
+		const TSharedRef<FPending> Entry = Pending[Index];
+		if (!Entry->Task.IsCompleted())
+		{
+			continue;
+		}
+		Pending.RemoveAt(Index);
+		OnFinished(*Entry);
+		if (Entry->bSucceeded)
+		{
+			Entry->State->LastUsedFrame = Frame;
+			Cache.Add(Entry->State);
+		}
+	}
+}
+
+void NSSContextFactory::Wait()
+{
+	TArray<UE::Tasks::FTask> Tasks;
+	{
+		FScopeLock Lock(&Mutex);
+		for (const TSharedRef<FPending>& Entry : Pending)
+		{
+			Tasks.Add(Entry->Task);
+		}
+	}
+	UE::Tasks::Wait(Tasks);
+}
+
+NSSContextFactoryStats NSSContextFactory::GetStats() const
+{
+	FScopeLock Lock(&Mutex);
+	NSSContextFactoryStats Result = Stats;
+	Result.NumPending = Pending.Num();
+	return Result;
+}
+
+void NSSContextFactory::OnFinished(const FPending& Entry)
+{
+	if (Entry.bSucceeded)
+	{
+		Stats.Created++;
+		Stats.CreationSeconds += Entry.Seconds;
+	}
+	else
+	{
+		Stats.Failed++;
+	}
+}
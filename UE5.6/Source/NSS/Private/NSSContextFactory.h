@@ -0,0 +1,95 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NSSContextCache.h"
+#include "NSSContextSizes.h"
+#include "Tasks/Task.h"
+
+// What the context a view will need is predicted from.
+struct NSSContextPrediction
+{
+	// Size of the view after upscaling.
+	FIntPoint OutputSize = FIntPoint::ZeroValue;
+	// r.ScreenPercentage, which NSS also upscales by when dynamic resolution is on.
+	float ScreenPercentage = 100.0f;
+	bool bDynamicResolution = false;
+	// Upper bound of the primary resolution fraction when dynamic resolution is on.
+	float MaxResolutionFraction = 1.0f;
+	// Whether contexts are created for the largest render size (r.NSS.DynamicResolution), down to
+	// MinResolutionFraction.
+	bool bDynamicResolutionContext = false;
+	float MinResolutionFraction = 0.25f;
+
+	bool operator==(const NSSContextPrediction& Other) const
+	{
+		return OutputSize == Other.OutputSize && ScreenPercentage == Other.ScreenPercentage
+			   && bDynamicResolution == Other.bDynamicResolution
+			   && MaxResolutionFraction == Other.MaxResolutionFraction
+			   && bDynamicResolutionContext == Other.bDynamicResolutionContext
+			   && MinResolutionFraction == Other.MinResolutionFraction;
+	}
+};
+
+// The sizes a view will most likely need: the screen percentage, or the largest resolution dynamic resolution can pick
+// as it is the one a hitch is most visible at (and the one a single context is created for with
+// bDynamicResolutionContext).
+NSSContextSizes PredictNssContextSizes(const NSSContextPrediction& Prediction);
+
+struct NSSContextFactoryStats
+{
+	uint64 Requests = 0;
+	uint64 Created = 0;
+	uint64 Failed = 0;
+	// Contexts that were needed before they were finished, so the render thread waited for them.
+	uint64 Waits = 0;
+	double CreationSeconds = 0.0;
+	int32 NumPending = 0;
+};
+
+//-------------------------------------------------------------------------------------
+// Creates NSS contexts on background tasks so that the render thread doesn't stall on ffxCreateContext when a view
+// first needs them. Finished contexts are handed to the context cache, from which AddPasses picks them up as if they
+// had been released by another view.
+//-------------------------------------------------------------------------------------
+class NSSContextFactory
+{
+public:
+	~NSSContextFactory();
+
+	// Starts creating a context for Params with Backend, unless one is already being created.
+	void Request(INGSharedBackend* Backend, const ffxApiCreateContextDescNss& Params);
+
+	// Whether a context compatible with Params has been requested and not flushed yet.
+	bool IsPending(const ffxApiCreateContextDescNss& Params) const;
+
+	// Returns the requested context compatible with Params, waiting for it to be created if needed, or null if there is
+	// none or its creation failed.
+	NSSStateRef TakePending(const ffxApiCreateContextDescNss& Params);
+
+	// Moves the contexts that have been created to Cache, marked as last used at Frame.
+	void Flush(NSSContextCache& Cache, uint64 Frame);
+
+	// Waits for every requested context to be created.
+	void Wait();
+
+	NSSContextFactoryStats GetStats() const;
+
+private:
+	struct FPending
+	{
+		NSSStateRef State;
+		UE::Tasks::FTask Task;
+		bool bSucceeded = false;
+		double Seconds = 0.0;
+	};
+
+	// Records the outcome of a finished request, which has been removed from Pending. Mutex must be held.
+	void OnFinished(const FPending& Entry);
+
+	mutable FCriticalSection Mutex;
+	TArray<TSharedRef<FPending>> Pending;
+	NSSContextFactoryStats Stats;
+};
@@ -0,0 +1,108 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#include "NSSContextSizes.h"
+
+namespace
+{
+	FIntPoint PadInputSize(FIntPoint InputSize)
+	{
+		return FIntPoint(Align(InputSize.X, 8), Align(InputSize.Y, 8));
+	}
+
+	NSSContextSizes ComponentMax(const NSSContextSizes& A, const NSSContextSizes& B)
+	{
+		NSSContextSizes Result;
+		Result.PaddedInputSize = A.PaddedInputSize.ComponentMax(B.PaddedInputSize);
+		Result.PaddedOutputSize = A.PaddedOutputSize.ComponentMax(B.PaddedOutputSize);
+		return Result;
+	}
+
+	NSSContextSizes AddHeadroom(const NSSContextSizes& Sizes, float Headroom)
+	{
+		NSSContextSizes Result = Sizes;
+		const float Scale = 1.0f + FMath::Max(Headroom, 0.0f);
+		Result.PaddedInputSize = PadInputSize(FIntPoint(FMath::CeilToInt(Sizes.PaddedInputSize.X * Scale),
+			FMath::CeilToInt(Sizes.PaddedInputSize.Y * Scale)));
+		return Result;
+	}
+}
+
+NSSContextSizes GetNssContextSizes(FIntPoint InputSize, float UpscaleRatio)
+{
+	// The network requires the inputs to be a multiple of 8 in both width and height and produces an output upscaled
+	// from the padded input, so the output is padded too (see NSS::AddPasses).
+	NSSContextSizes Sizes;
+	Sizes.PaddedInputSize = PadInputSize(InputSize);
+	const FVector2d ScaledPaddedInputSize = FVector2d(Sizes.PaddedInputSize) * UpscaleRatio;
+	Sizes.PaddedOutputSize =
+		FIntPoint(FMath::RoundToInt(ScaledPaddedInputSize.X), FMath::RoundToInt(ScaledPaddedInputSize.Y));
+	return Sizes;
+}
+
+NSSContextSizes GetNssContextSizes(const ffxApiCreateContextDescNss& Params)
+{
+	NSSContextSizes Sizes;
+	Sizes.PaddedInputSize = FIntPoint(Params.maxRenderSize.width, Params.maxRenderSize.height);
+	Sizes.PaddedOutputSize = FIntPoint(Params.maxUpscaleSize.width, Params.maxUpscaleSize.height);
+	return Sizes;
+}
+
+NSSContextSizes GetNssDynamicResolutionFrameSizes(FIntPoint InputSize, FIntPoint OutputSize)
+{
+	// The ratio changes every frame, so it comes from the view rather than r.ScreenPercentage.
+	NSSContextSizes Sizes;
+	Sizes.PaddedInputSize = PadInputSize(InputSize);
+	Sizes.PaddedOutputSize = FIntPoint(
+		FMath::RoundToInt(double(Sizes.PaddedInputSize.X) * OutputSize.X / FMath::Max(InputSize.X, 1)),
+		FMath::RoundToInt(double(Sizes.PaddedInputSize.Y) * OutputSize.Y / FMath::Max(InputSize.Y, 1)));
+	return Sizes;
+}
+
+NSSContextSizes GetNssDynamicResolutionContextSizes(
+	FIntPoint MaxInputSize, FIntPoint OutputSize, float MinResolutionFraction)
+{
+	// Up to 7 texels of input padding are upscaled with the frame, which is by at most 1 / MinResolutionFraction.
+	const int32 MaxOutputPadding = FMath::CeilToInt(7.0f / FMath::Max(MinResolutionFraction, UE_KINDA_SMALL_NUMBER));
+	NSSContextSizes Sizes;
+	Sizes.PaddedInputSize = PadInputSize(MaxInputSize);
+	Sizes.PaddedOutputSize = OutputSize + FIntPoint(MaxOutputPadding, MaxOutputPadding);
+	return Sizes;
+}
+
+NSSContextSizes UpdateNssDynamicResolutionContextSizes(const NSSContextSizes& Current,
+	const NSSContextSizes& Frame,
+	const NSSContextSizes& Target,
+	const NSSDynamicResolutionSettings& Settings,
+	int32& FramesOutOfBounds)
+{
+	if (Current.PaddedInputSize == FIntPoint::ZeroValue)
+	{
+		FramesOutOfBounds = 0;
+		return ComponentMax(Target, Frame);
+	}
+	if (!Current.Contains(Frame))
+	{
+		// The frame can't run in the current context. Leave room for the render size to keep growing.
+		FramesOutOfBounds = 0;
+		return AddHeadroom(ComponentMax(Target, Frame), Settings.Headroom);
+	}
+
+	// The bounds changed, e.g. a different screen percentage or a resized window. Only follow them once they have
+	// settled, the context still runs every frame in the meantime.
+	const bool bTooSmall = !Current.Contains(Target);
+	const NSSContextSizes Largest = AddHeadroom(AddHeadroom(Target, Settings.Headroom), Settings.Headroom);
+	const bool bTooLarge = !Largest.Contains(Current) || Current.PaddedOutputSize != Target.PaddedOutputSize;
+	if (!bTooSmall && !bTooLarge)
+	{
+		FramesOutOfBounds = 0;
+		return Current;
+	}
+	if (++FramesOutOfBounds < Settings.ResizeDelayFrames)
+	{
+		return Current;
+	}
+	FramesOutOfBounds = 0;
+	const NSSContextSizes Resized = ComponentMax(Target, Frame);
+	return bTooSmall ? AddHeadroom(Resized, Settings.Headroom) : Resized;
+}
@@ -0,0 +1,67 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NSSInclude.h"
+
+// The resolutions an NSS context is created for, or a frame runs at.
+struct NSSContextSizes
+{
+	// Render resolution padded to a multiple of 8, as the network requires.
+	FIntPoint PaddedInputSize = FIntPoint::ZeroValue;
+	// The padded render resolution upscaled, which the network outputs.
+	FIntPoint PaddedOutputSize = FIntPoint::ZeroValue;
+
+	bool operator==(const NSSContextSizes& Other) const
+	{
+		return PaddedInputSize == Other.PaddedInputSize && PaddedOutputSize == Other.PaddedOutputSize;
+	}
+
+	// Whether a context created for these sizes can run a frame at Other.
+	bool Contains(const NSSContextSizes& Other) const
+	{
+		return Other.PaddedInputSize.X <= PaddedInputSize.X && Other.PaddedInputSize.Y <= PaddedInputSize.Y
+			   && Other.PaddedOutputSize.X <= PaddedOutputSize.X && Other.PaddedOutputSize.Y <= PaddedOutputSize.Y;
+	}
+};
+
+// The sizes NSS runs at for a view rendered at InputSize and upscaled by UpscaleRatio.
+NSSContextSizes GetNssContextSizes(FIntPoint InputSize, float UpscaleRatio);
+
+// The sizes a context was created with.
+NSSContextSizes GetNssContextSizes(const ffxApiCreateContextDescNss& Params);
+
+//-------------------------------------------------------------------------------------
+// Dynamic resolution
+//   A single context is created for the largest render size the view can use and each frame passes its own render
+//   size, so that changes of the render size don't recreate the context.
+//-------------------------------------------------------------------------------------
+
+// The sizes a frame rendered at InputSize and upscaled to OutputSize runs at.
+NSSContextSizes GetNssDynamicResolutionFrameSizes(FIntPoint InputSize, FIntPoint OutputSize);
+
+// The sizes of a context that can run any frame upscaled to OutputSize from a render size between
+// OutputSize * MinResolutionFraction and MaxInputSize.
+NSSContextSizes GetNssDynamicResolutionContextSizes(
+	FIntPoint MaxInputSize, FIntPoint OutputSize, float MinResolutionFraction);
+
+struct NSSDynamicResolutionSettings
+{
+	// Extra render size, as a fraction, given to a context that has to grow so that a render size creeping upwards
+	// doesn't recreate it every few frames.
+	float Headroom = 0.1f;
+	// Number of consecutive frames the context has to be too small or too large for the view's bounds before it is
+	// recreated. A frame that doesn't fit in the context always recreates it.
+	int32 ResizeDelayFrames = 60;
+};
+
+// Returns the sizes the context of a view should have this frame: Current to keep the context, otherwise the sizes of
+// the context to create. Frame are the sizes this frame runs at, Target the sizes for the view's dynamic resolution
+// bounds and FramesOutOfBounds the hysteresis counter kept with the context.
+NSSContextSizes UpdateNssDynamicResolutionContextSizes(const NSSContextSizes& Current,
+	const NSSContextSizes& Frame,
+	const NSSContextSizes& Target,
+	const NSSDynamicResolutionSettings& Settings,
+	int32& FramesOutOfBounds);
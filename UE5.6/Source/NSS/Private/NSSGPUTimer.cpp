@@ -0,0 +1,194 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#include "NSSGPUTimer.h"
+
+#include "DynamicRHI.h"
+#include "RHICommandList.h"
+
+//-------------------------------------------------------------------------------------
+// NSSRHITimestampSource
+//-------------------------------------------------------------------------------------
+uint32 NSSRHITimestampSource::AllocateTimestamp()
+{
+	FScopeLock Lock(&Mutex);
+	if (!QueryPool.IsValid())
+	{
+		QueryPool = RHICreateRenderQueryPool(RQT_AbsoluteTime);
+	}
+	const uint32 Timestamp = ++NextTimestamp;
+	FQuery& Query = Queries.Add(Timestamp);
+	Query.Query = QueryPool->AllocateQuery();
+	return Timestamp;
+}
+
+void NSSRHITimestampSource::WriteTimestamp(FRHICommandListImmediate& RHICmdList, uint32 Timestamp)
+{
+	FScopeLock Lock(&Mutex);
+	if (FQuery* Query = Queries.Find(Timestamp))
+	{
+		RHICmdList.EndRenderQuery(Query->Query.GetQuery());
+		Query->bWritten = true;
+	}
+}
+
+bool NSSRHITimestampSource::ReadTimestamp(uint32 Timestamp, uint64& OutMicroseconds)
+{
+	FScopeLock Lock(&Mutex);
+	// Queries that were never ended have no result to wait for.
+	FQuery* Query = Queries.Find(Timestamp);
+	return Query && Query->bWritten && RHIGetRenderQueryResult(Query->Query.GetQuery(), OutMicroseconds, false);
+}
+
+void NSSRHITimestampSource::ReleaseTimestamp(uint32 Timestamp)
+{
+	FScopeLock Lock(&Mutex);
+	// Returns the query to the pool.
+	Queries.Remove(Timestamp);
+}
+
+//-------------------------------------------------------------------------------------
+// NSSGPUTimer
+//-------------------------------------------------------------------------------------
+NSSGPUTimer::NSSGPUTimer(TUniquePtr<INSSGPUTimestampSource> InSource) : Source(MoveTemp(InSource))
+{
+	check(Source.IsValid());
+}
+
+NSSGPUTimer::~NSSGPUTimer()
+{
+	for (const FPendingStage& Pending : PendingStages)
+	{
+		ReleaseTimestamps(Pending.Timestamps);
+	}
+}
+
+NSSGPUTimer::FStageTimestamps NSSGPUTimer::AddStage(uint64 Frame, ENSSGPUStage Stage)
+{
+	FScopeLock Lock(&Mutex);
+	FPendingStage& Pending = PendingStages.AddDefaulted_GetRef();
+	Pending.Frame = Frame;
+	Pending.Stage = Stage;
+	Pending.Timestamps.Begin = Source->AllocateTimestamp();
+	Pending.Timestamps.End = Source->AllocateTimestamp();
+	FindOrAddPendingFrame(Frame);
+	return Pending.Timestamps;
+}
+
+void NSSGPUTimer::AddDispatchTimings(uint64 Frame, const NGSharedDispatchTimings& Timings)
+{
+	FScopeLock Lock(&Mutex);
+	if (NSSGPUTimings* FrameTimings = FindOrAddPendingFrame(Frame))
+	{
+		FrameTimings->StageMilliseconds[uint8(ENSSGPUStage::DispatchInputPreparation)] +=
+			double(Timings.InputPreparationMicroseconds) / 1000.0;
+		FrameTimings->StageMilliseconds[uint8(ENSSGPUStage::DispatchInference)] +=
+			double(Timings.InferenceMicroseconds) / 1000.0;
+		FrameTimings->StageMilliseconds[uint8(ENSSGPUStage::DispatchOutputResolve)] +=
+			double(Timings.OutputResolveMicroseconds) / 1000.0;
+	}
+}
+
+void NSSGPUTimer::AddView(uint64 Frame)
+{
+	FScopeLock Lock(&Mutex);
+	if (NSSGPUTimings* FrameTimings = FindOrAddPendingFrame(Frame))
+	{
+		FrameTimings->NumViews++;
+	}
+}
+
+void NSSGPUTimer::Update(uint64 Frame)
+{
+	FScopeLock Lock(&Mutex);
+	for (int32 Index = 0; Index < PendingStages.Num();)
+	{
+		const FPendingStage Pending = PendingStages[Index];
+		if (Frame < Pending.Frame + MinReadbackFrames)
+		{
+			Index++;
+			continue;
+		}
+
+		uint64 BeginMicroseconds = 0;
+		uint64 EndMicroseconds = 0;
+		const bool bRead = Source->ReadTimestamp(Pending.Timestamps.Begin, BeginMicroseconds)
+						   && Source->ReadTimestamp(Pending.Timestamps.End, EndMicroseconds);
+		const int32 FrameIndex =
+			PendingFrames.IndexOfByPredicate([&Pending](const NSSGPUTimings& Timings)
+				{ return Timings.Frame == Pending.Frame; });
+		if (bRead)
+		{
+			if (FrameIndex != INDEX_NONE)
+			{
+				PendingFrames[FrameIndex].StageMilliseconds[uint8(Pending.Stage)] +=
+					double(EndMicroseconds - FMath::Min(BeginMicroseconds, EndMicroseconds)) / 1000.0;
+			}
+		}
+		else if (Frame >= Pending.Frame + MaxPendingFrames)
+		{
+			// An incomplete frame would look faster than it was.
+			if (FrameIndex != INDEX_NONE)
+			{
+				PendingFrames.RemoveAt(FrameIndex);
+			}
+			LastFinishedFrame = FMath::Max(LastFinishedFrame, Pending.Frame);
+		}
+		else
+		{
+			Index++;
+			continue;
+		}
+		ReleaseTimestamps(Pending.Timestamps);
+		PendingStages.RemoveAt(Index);
+	}
+
+	// Frames are published in order, once all of their stages have been read back.
+	while (PendingFrames.Num() > 0)
+	{
+		const uint64 OldestFrame = PendingFrames[0].Frame;
+		if (OldestFrame + MinReadbackFrames > Frame
+			|| PendingStages.ContainsByPredicate(
+				[OldestFrame](const FPendingStage& Pending) { return Pending.Frame == OldestFrame; }))
+		{
+			break;
+		}
+		if (OldestFrame > LatestTimings.Frame)
+		{
+			LatestTimings = PendingFrames[0];
+		}
+		LastFinishedFrame = FMath::Max(LastFinishedFrame, OldestFrame);
+		PendingFrames.RemoveAt(0);
+	}
+}
+
+NSSGPUTimings NSSGPUTimer::GetLatestTimings() const
+{
+	FScopeLock Lock(&Mutex);
+	return LatestTimings;
+}
+
+NSSGPUTimings* NSSGPUTimer::FindOrAddPendingFrame(uint64 Frame)
+{
+	if (Frame <= LastFinishedFrame)
+	{
+		return nullptr;
+	}
+	int32 Index = 0;
+	for (; Index < PendingFrames.Num() && PendingFrames[Index].Frame <= Frame; Index++)
+	{
+		if (PendingFrames[Index].Frame == Frame)
+		{
+			return &PendingFrames[Index];
+		}
+	}
+	NSSGPUTimings& Timings = PendingFrames.InsertDefaulted_GetRef(Index);
+	Timings.Frame = Frame;
+	return &Timings;
+}
+
+void NSSGPUTimer::ReleaseTimestamps(const FStageTimestamps& Timestamps)
+{
+	Source->ReleaseTimestamp(Timestamps.Begin);
+	Source->ReleaseTimestamp(Timestamps.End);
+}
@@ -0,0 +1,153 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "NGSharedBackend.h"
+#include "RHIResources.h"
+
+// The stages of an NSS upscale timed on the GPU.
+enum class ENSSGPUStage : uint8
+{
+	// Padding the inputs and converting the motion vectors.
+	InputPreparation,
+	// The whole SDK dispatch.
+	Dispatch,
+	// The stages of the dispatch, when the backend reports them.
+	DispatchInputPreparation,
+	DispatchInference,
+	DispatchOutputResolve,
+	// Copying the output without its padding.
+	OutputCrop,
+	Num
+};
+
+// GPU time of each stage of a frame, summed over its views.
+struct NSSGPUTimings
+{
+	uint64 Frame = 0;
+	int32 NumViews = 0;
+	double StageMilliseconds[uint8(ENSSGPUStage::Num)] = {};
+
+	double GetMilliseconds(ENSSGPUStage Stage) const
+	{
+		return StageMilliseconds[uint8(Stage)];
+	}
+
+	// Time of the plugin's passes and the dispatch, whose stages are already included in Dispatch.
+	double GetTotalMilliseconds() const
+	{
+		return GetMilliseconds(ENSSGPUStage::InputPreparation) + GetMilliseconds(ENSSGPUStage::Dispatch)
+			   + GetMilliseconds(ENSSGPUStage::OutputCrop);
+	}
+};
+
+//-------------------------------------------------------------------------------------
+// Where GPU timestamps come from, so that timings can be tested without a GPU.
+//-------------------------------------------------------------------------------------
+class INSSGPUTimestampSource
+{
+public:
+	virtual ~INSSGPUTimestampSource() = default;
+
+	// Returns a handle to a timestamp that hasn't been written yet.
+	virtual uint32 AllocateTimestamp() = 0;
+
+	// Writes the timestamp once the GPU gets to this point of RHICmdList.
+	virtual void WriteTimestamp(FRHICommandListImmediate& RHICmdList, uint32 Timestamp) = 0;
+
+	// Reads a timestamp in microseconds without waiting, returning false while the GPU hasn't written it.
+	virtual bool ReadTimestamp(uint32 Timestamp, uint64& OutMicroseconds) = 0;
+
+	virtual void ReleaseTimestamp(uint32 Timestamp) = 0;
+};
+
+//-------------------------------------------------------------------------------------
+// Timestamps from RHI render queries.
+//-------------------------------------------------------------------------------------
+class NSSRHITimestampSource final : public INSSGPUTimestampSource
+{
+public:
+	uint32 AllocateTimestamp() override;
+	void WriteTimestamp(FRHICommandListImmediate& RHICmdList, uint32 Timestamp) override;
+	bool ReadTimestamp(uint32 Timestamp, uint64& OutMicroseconds) override;
+	void ReleaseTimestamp(uint32 Timestamp) override;
+
+private:
+	struct FQuery
+	{
+		FRHIPooledRenderQuery Query;
+		bool bWritten = false;
+	};
+
+	FCriticalSection Mutex;
+	FRenderQueryPoolRHIRef QueryPool;
+	TMap<uint32, FQuery> Queries;
+	uint32 NextTimestamp = 0;
+};
+
+//-------------------------------------------------------------------------------------
+// Times the stages of each view with a pair of GPU timestamps, and reads them back once the GPU has written them
+// a few frames later. The timings of a frame are published once every one of its stages has been read back.
+//-------------------------------------------------------------------------------------
+class NSSGPUTimer
+{
+public:
+	struct FStageTimestamps
+	{
+		uint32 Begin = 0;
+		uint32 End = 0;
+	};
+
+	explicit NSSGPUTimer(TUniquePtr<INSSGPUTimestampSource> InSource);
+	~NSSGPUTimer();
+
+	// Returns the timestamps to write before and after Stage of a view in Frame. A view's stage can be timed in
+	// several parts, which are summed.
+	FStageTimestamps AddStage(uint64 Frame, ENSSGPUStage Stage);
+
+	// Records the stages of a dispatch reported by the backend. They are from an earlier dispatch than Frame's, as
+	// backends only report dispatches the GPU has finished.
+	void AddDispatchTimings(uint64 Frame, const NGSharedDispatchTimings& Timings);
+
+	// Counts a view in Frame.
+	void AddView(uint64 Frame);
+
+	// Reads back the timestamps of the stages started at least MinReadbackFrames before Frame. A frame with a stage
+	// that still can't be read back after MaxPendingFrames (e.g. a timestamp that was never written) is dropped.
+	void Update(uint64 Frame);
+
+	// Timings of the most recent frame that has been read back completely.
+	NSSGPUTimings GetLatestTimings() const;
+
+	INSSGPUTimestampSource& GetSource()
+	{
+		return *Source;
+	}
+
+	static constexpr uint64 MinReadbackFrames = 2;
+	static constexpr uint64 MaxPendingFrames = 8;
+
+private:
+	struct FPendingStage
+	{
+		uint64 Frame = 0;
+		ENSSGPUStage Stage = ENSSGPUStage::Num;
+		FStageTimestamps Timestamps;
+	};
+
+	// Returns the timings of Frame, or null if they have already been published or dropped. Mutex must be held.
+	NSSGPUTimings* FindOrAddPendingFrame(uint64 Frame);
+	void ReleaseTimestamps(const FStageTimestamps& Timestamps);
+
+	mutable FCriticalSection Mutex;
+	TUniquePtr<INSSGPUTimestampSource> Source;
+	TArray<FPendingStage> PendingStages;
+	// Frames with stages still pending, oldest first.
+	TArray<NSSGPUTimings> PendingFrames;
+	NSSGPUTimings LatestTimings;
+	// Frames up to this one have been published or dropped.
+	uint64 LastFinishedFrame = 0;
+};
@@ -27,6 +27,34 @@
 #include "NSS.h"
 #include "NSSModule.h"
 
+uint64 EstimateNssContextSizeBytes(const ffxApiCreateContextDescNss& Params)
+{
+	// The network's feature tensors and feedback are at the render resolution and dominate. This errs on the large
+	// side.
+	const uint64 RenderPixels = uint64(Params.maxRenderSize.width) * Params.maxRenderSize.height;
+	const uint64 UpscalePixels = uint64(Params.maxUpscaleSize.width) * Params.maxUpscaleSize.height;
+	return RenderPixels * 64 + UpscalePixels * 8;
+}
+
+void NSSState::UpdateGPUSizeBytes()
+{
+	ffxQueryDescNssGetGPUMemoryUsage Query;
+	FMemory::Memzero(Query);
+	Query.header.type = FFX_API_QUERY_DESC_TYPE_NSS_GPU_MEMORY_USAGE;
+	if (Backend != nullptr && Backend->ffxQuery(&Nss, &Query.header) == FFX_OK)
+	{
+		GPUSizeBytes = Query.totalUsageInBytes;
+		GPUScratchSizeBytes = Query.scratchUsageInBytes;
+		bGPUSizeEstimated = false;
+	}
+	else
+	{
+		GPUSizeBytes = EstimateNssContextSizeBytes(Params);
+		GPUScratchSizeBytes = 0;
+		bGPUSizeEstimated = true;
+	}
+}
+
 const TCHAR* NSSHistory::FfxNssDebugName = TEXT("NSS");
 
 TCHAR const* NSSHistory::GetUpscalerName()
@@ -38,16 +66,50 @@ NSSHistory::NSSHistory(NSSStateRef NewState, NSS* _Upscaler)
 {
 	Upscaler = _Upscaler;
 	SetState(NewState);
+	if (Upscaler)
+	{
+		Upscaler->AddHistory(this);
+	}
 }
 
 NSSHistory::~NSSHistory()
 {
 	if (NSSModule::IsInitialized() && Upscaler)
 	{
+		Upscaler->RemoveHistory(this);
 		Upscaler->ReleaseState(Nss);
 	}
 }
 
+namespace
+{
+	// Enough for the histories of a few views, kept alive by the frames in flight.
+	constexpr int32 NumPooledHistories = 32;
+
+	// Never destroyed, as the engine can release its histories during static destruction.
+	TNSSObjectPool<NSSHistory>& GetHistoryPool()
+	{
+		static TNSSObjectPool<NSSHistory>* Pool = new TNSSObjectPool<NSSHistory>(NumPooledHistories);
+		return *Pool;
+	}
+}
+
+void* NSSHistory::operator new(size_t Size)
+{
+	check(Size == sizeof(NSSHistory));
+	return GetHistoryPool().Allocate();
+}
+
+void NSSHistory::operator delete(void* Ptr)
+{
+	GetHistoryPool().Free(Ptr);
+}
+
+NSSObjectPoolStats NSSHistory::GetPoolStats()
+{
+	return GetHistoryPool().GetStats();
+}
+
 const TCHAR* NSSHistory::GetDebugName() const
 {
 	// this has to match NSSHistory::GetDebugName()
@@ -56,8 +118,17 @@ const TCHAR* NSSHistory::GetDebugName() const
 
 uint64 NSSHistory::GetGPUSizeBytes() const
 {
-	// 5.3 not done
-	return 0;
+	// The context is shared with the view's previous and next histories, so it is counted by each of them.
+	return GetTextureSizeBytes() + (Nss.IsValid() ? Nss->GPUSizeBytes : 0);
+}
+
+uint64 NSSHistory::GetTextureSizeBytes() const
+{
+	uint64 SizeBytes = 0;
+	SizeBytes += PaddedUpscaledColour.IsValid() ? PaddedUpscaledColour->ComputeMemorySize() : 0;
+	SizeBytes += PaddedDepth.IsValid() ? PaddedDepth->ComputeMemorySize() : 0;
+	SizeBytes += TileFeatures.IsValid() ? TileFeatures->ComputeMemorySize() : 0;
+	return SizeBytes;
 }
 
 void NSSHistory::SetState(NSSStateRef NewState)
@@ -27,6 +27,9 @@
 #include "CoreMinimal.h"
 #include "INSSHistory.h"
 #include "NSSInclude.h"
+#include "NSSObjectPool.h"
+#include "NSSStaticFrameDetector.h"
+#include "RHIGPUReadback.h"
 #include "SceneRendering.h"
 
 class NSS;
@@ -64,14 +67,40 @@ struct NSSState : public FRHIResource
 		return FRHIResource::GetRefCount();
 	}
 
+	// ViewID of a context created ahead of time that no view has used yet.
+	static constexpr uint32 AnyViewID = ~0u;
+
+	// Queries the memory used by the context from the backend, falling back to an estimate based on Params for
+	// backends that can't report it.
+	void UpdateGPUSizeBytes();
+
 	INGSharedBackend* Backend;
 	ffxApiCreateContextDescNss Params;
 	ffxContext Nss;
 	uint64 LastUsedFrame;
-	uint32 ViewID;
+	uint32 ViewID = 0;
+	// Memory used by the context's internal resources, including GPUScratchSizeBytes.
+	uint64 GPUSizeBytes = 0;
+	uint64 GPUScratchSizeBytes = 0;
+	// Whether GPUSizeBytes is an estimate rather than what the backend reported.
+	bool bGPUSizeEstimated = true;
+	// Consecutive frames the dynamic resolution bounds have been outside of the context's sizes.
+	int32 FramesOutOfBounds = 0;
+	// Consecutive frames a secondary eye has been reprojected from the primary eye rather than dispatched.
+	int32 FramesReprojected = 0;
+	// Whether the view's frames can reuse the history instead of being dispatched (r.NSS.StaticFrameSkip).
+	NSSStaticFrameDetector StaticFrameDetector;
+	// Readbacks of the longest motion vector of the view's recent frames, oldest first, and the last one read.
+	TArray<TUniquePtr<FRHIGPUBufferReadback>> MotionReadbacks;
+	TOptional<float> MaxMotionPixels;
+	// Readbacks of the changed, active and total tiles of the view's recent frames (r.NSS.SparseTiles), oldest first.
+	TArray<TUniquePtr<FRHIGPUBufferReadback>> TileReadbacks;
 };
 typedef TRefCountPtr<NSSState> NSSStateRef;
 
+// Rough size of the internal resources of an NSS context created with Params.
+uint64 EstimateNssContextSizeBytes(const ffxApiCreateContextDescNss& Params);
+
 //-------------------------------------------------------------------------------------
 // The ICustomTemporalAAHistory for NSS, this retains the NSS state object.
 //-------------------------------------------------------------------------------------
@@ -82,9 +111,17 @@ public:
 
 	virtual ~NSSHistory();
 
+	// Each view's history is replaced every frame, so they come from a pool.
+	static void* operator new(size_t Size);
+	static void operator delete(void* Ptr);
+	static NSSObjectPoolStats GetPoolStats();
+
 	virtual const TCHAR* GetDebugName() const override;
 	virtual uint64 GetGPUSizeBytes() const override;
 
+	// Memory of the textures kept for the next frame, excluding the context.
+	uint64 GetTextureSizeBytes() const;
+
 	ffxContext* GetNSSContext() const final;
 	ffxApiCreateContextDescNss* GetNSSContextDesc() const final;
 
@@ -114,9 +151,12 @@ public:
 
 	// We need to keep these around on the application side instead of FFX side as otherwise we'd have to blit
 	// each of these into an internal resource. Instead, we can simply keep them alive here on the app side through RDG.
-	TRefCountPtr<IPooledRenderTarget> PaddedUpscaledColour; // No view rect associated here - always the full thing
+	TRefCountPtr<IPooledRenderTarget> PaddedUpscaledColour; // Sized for the context, see PaddedUpscaledColourSize
+	// The padded output at the origin of PaddedUpscaledColour, smaller than it with a dynamic resolution context.
+	FIntPoint PaddedUpscaledColourSize = FIntPoint::ZeroValue;
 	TRefCountPtr<IPooledRenderTarget> PaddedDepth; // View rect is specified by PaddedDepthViewRect
 	FIntRect PaddedDepthViewRect; // Might be smaller than the texture extent (e.g. tiling quantisation)
+	TRefCountPtr<IPooledRenderTarget> TileFeatures; // The features of each tile with r.NSS.SparseTiles
 
 private:
 	static TCHAR const* FfxNssDebugName;
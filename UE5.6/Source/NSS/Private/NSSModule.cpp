@@ -32,6 +32,7 @@
 #include "Misc/ConfigUtilities.h"
 #include "Misc/MessageDialog.h"
 #include "NSS.h"
+#include "NSSCalibration.h"
 #include "NSSViewExtension.h"
 
 IMPLEMENT_MODULE(NSSModule, NSS)
@@ -49,6 +50,7 @@ void NSSModule::StartupModule()
 	AddShaderSourceDirectoryMapping(TEXT("/Plugin/NSS"), PluginShaderDir);
 
 	FModuleManager::Get().LoadModuleChecked("NGVulkanBackend");
+	FModuleManager::Get().LoadModuleChecked("NGCPUBackend");
 
 	if (IsRunningCookCommandlet()) // Note this check needs to come after the shader source mapping, otherwise crashy
 	{
@@ -60,12 +62,15 @@ void NSSModule::StartupModule()
 	}
 
 	FCoreDelegates::OnPostEngineInit.AddRaw(this, &NSSModule::OnPostEngineInit);
+	// The calibration waits for the rendering thread, which stops before the module is shut down.
+	FCoreDelegates::OnEnginePreExit.AddStatic(&CancelNSSCalibration);
 	GNSSModuleInit = true;
 	UE_LOG(LogNSS, Log, TEXT("NSS Temporal Upscaling Module Started"));
 }
 
 void NSSModule::ShutdownModule()
 {
+	CancelNSSCalibration();
 	GNSSModuleInit = false;
 	UE_LOG(LogNSS, Log, TEXT("NSS Temporal Upscaling Module Shutdown"));
 }
@@ -86,7 +91,12 @@ void NSSModule::OnPostEngineInit()
 	{
 		FString RHIName = GDynamicRHI->GetName();
 
-		if (RHIName == TEXT("Vulkan"))
+		if (NSS::UseCPUBackend())
+		{
+			UE_LOG(LogNSS, Log, TEXT("Using the CPU reference backend with the '%s' RHI"), *RHIName);
+			ViewExtension = FSceneViewExtensions::NewExtension<NSSViewExtension>();
+		}
+		else if (RHIName == TEXT("Vulkan"))
 		{
 			INGSharedBackendModule* VkBackend =
 				FModuleManager::GetModulePtr<INGSharedBackendModule>(TEXT("NGVulkanBackend"));
@@ -155,4 +165,20 @@ void NSSModule::SetEnabledInEditor(bool bEnabled)
 #endif
 }
 
+void NSSModule::SetRegionOfInterest(uint32 ViewKey, const NSSRegionOfInterest& Region)
+{
+	if (TemporalUpscaler.IsValid())
+	{
+		TemporalUpscaler->SetRegionOfInterest(ViewKey, Region);
+	}
+}
+
+void NSSModule::ClearRegionOfInterest(uint32 ViewKey)
+{
+	if (TemporalUpscaler.IsValid())
+	{
+		TemporalUpscaler->ClearRegionOfInterest(ViewKey);
+	}
+}
+
 #undef LOCTEXT_NAMESPACE
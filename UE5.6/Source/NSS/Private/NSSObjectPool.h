@@ -0,0 +1,88 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/ScopeLock.h"
+
+struct NSSObjectPoolStats
+{
+	// Allocations that had to go to the heap as every block was in use.
+	uint64 Misses = 0;
+	int32 NumBlocks = 0;
+	int32 NumFree = 0;
+};
+
+//-------------------------------------------------------------------------------------
+// Fixed size blocks for objects the upscaler creates and destroys every frame, used from their class' operator new
+// and delete so that steady state frames don't go to the heap. Freed blocks are kept for the next allocation: the
+// pool only grows while the number of live objects exceeds every previous frame's, and never shrinks.
+//-------------------------------------------------------------------------------------
+template <typename ObjectType>
+class TNSSObjectPool
+{
+public:
+	explicit TNSSObjectPool(int32 NumPreallocated)
+	{
+		FreeBlocks.Reserve(NumPreallocated);
+		for (int32 Index = 0; Index < NumPreallocated; Index++)
+		{
+			FreeBlocks.Add(AllocateBlock());
+		}
+		Stats.NumBlocks = NumPreallocated;
+	}
+
+	~TNSSObjectPool()
+	{
+		// Blocks still in use are leaked rather than freed from under their objects.
+		for (void* Block : FreeBlocks)
+		{
+			FMemory::Free(Block);
+		}
+	}
+
+	void* Allocate()
+	{
+		{
+			FScopeLock Lock(&Mutex);
+			if (FreeBlocks.Num() > 0)
+			{
+				return FreeBlocks.Pop(EAllowShrinking::No);
+			}
+			Stats.Misses++;
+			Stats.NumBlocks++;
+			// So that the block can be freed back without growing the free list.
+			FreeBlocks.Reserve(Stats.NumBlocks);
+		}
+		return AllocateBlock();
+	}
+
+	void Free(void* Block)
+	{
+		if (Block)
+		{
+			FScopeLock Lock(&Mutex);
+			FreeBlocks.Add(Block);
+		}
+	}
+
+	NSSObjectPoolStats GetStats() const
+	{
+		FScopeLock Lock(&Mutex);
+		NSSObjectPoolStats Result = Stats;
+		Result.NumFree = FreeBlocks.Num();
+		return Result;
+	}
+
+private:
+	static void* AllocateBlock()
+	{
+		return FMemory::Malloc(sizeof(ObjectType), alignof(ObjectType));
+	}
+
+	mutable FCriticalSection Mutex;
+	TArray<void*> FreeBlocks;
+	NSSObjectPoolStats Stats;
+};
@@ -30,6 +30,7 @@
 #include "NSS.h"
 #include "NSSHistory.h"
 #include "NSSInclude.h"
+#include "NSSTrace.h"
 #include "PlanarReflectionSceneProxy.h"
 #include "PostProcess/SceneRenderTargets.h"
 #include "ScenePrivate.h"
@@ -49,6 +50,35 @@ NSSProxy::NSSProxy(NSS* TemporalUpscaler) : TemporalUpscaler(TemporalUpscaler)
 
 NSSProxy::~NSSProxy() {}
 
+namespace
+{
+	// Enough for the view families of the frames in flight.
+	constexpr int32 NumPooledProxies = 16;
+
+	// Never destroyed, as the engine can delete its proxies during static destruction.
+	TNSSObjectPool<NSSProxy>& GetProxyPool()
+	{
+		static TNSSObjectPool<NSSProxy>* Pool = new TNSSObjectPool<NSSProxy>(NumPooledProxies);
+		return *Pool;
+	}
+}
+
+void* NSSProxy::operator new(size_t Size)
+{
+	check(Size == sizeof(NSSProxy));
+	return GetProxyPool().Allocate();
+}
+
+void NSSProxy::operator delete(void* Ptr)
+{
+	GetProxyPool().Free(Ptr);
+}
+
+NSSObjectPoolStats NSSProxy::GetPoolStats()
+{
+	return GetProxyPool().GetStats();
+}
+
 const TCHAR* NSSProxy::GetDebugName() const
 {
 	return TemporalUpscaler->GetDebugName();
@@ -61,6 +91,7 @@ INSS::FOutputs NSSProxy::AddPasses(FRDGBuilder& GraphBuilder, const NSSView& Vie
 
 INSS* NSSProxy::Fork_GameThread(const class FSceneViewFamily& InViewFamily) const
 {
+	NSS_TRACE_SCOPE("NSS::Fork");
 	return new NSSProxy(TemporalUpscaler);
 }
 
@@ -71,7 +102,7 @@ float NSSProxy::GetMinUpsampleResolutionFraction() const
 
 float NSSProxy::GetMaxUpsampleResolutionFraction() const
 {
-	return TemporalUpscaler->GetMinUpsampleResolutionFraction();
+	return TemporalUpscaler->GetMaxUpsampleResolutionFraction();
 }
 
 IScreenSpaceDenoiser::FReflectionsOutputs NSSProxy::DenoiseReflections(FRDGBuilder& GraphBuilder,
@@ -29,6 +29,7 @@
 #include "NGSharedBackend.h"
 #include "NSS.h"
 #include "NSSHistory.h"
+#include "NSSObjectPool.h"
 #include "PostProcess/PostProcessUpscale.h"
 #include "PostProcess/PostProcessing.h"
 #include "PostProcess/TemporalAA.h"
@@ -43,6 +44,11 @@ public:
 	NSSProxy(NSS* TemporalUpscaler);
 	virtual ~NSSProxy();
 
+	// Proxies are created for every view family and fork each frame, so they come from a pool.
+	static void* operator new(size_t Size);
+	static void operator delete(void* Ptr);
+	static NSSObjectPoolStats GetPoolStats();
+
 	const TCHAR* GetDebugName() const override;
 
 	INSS::FOutputs AddPasses(
@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#include "NSSQualityGovernor.h"
+
+void NSSQualityGovernor::Reset(float InFraction)
+{
+	Fraction = InFraction;
+	SmoothedMilliseconds = 0.0;
+	NumSamples = 0;
+	FramesOutOfBand = 0;
+	FramesToIgnore = 0;
+	NumAdjustments = 0;
+}
+
+float NSSQualityGovernor::Update(double GPUMilliseconds, const NSSQualityGovernorSettings& Settings)
+{
+	// The bounds can change from one frame to the next, e.g. with the quality mode.
+	const float MinFraction = FMath::Clamp(Settings.MinFraction, 0.01f, 1.0f);
+	const float MaxFraction = FMath::Clamp(Settings.MaxFraction, MinFraction, 1.0f);
+	Fraction = FMath::Clamp(Fraction, MinFraction, MaxFraction);
+	if (GPUMilliseconds <= 0.0 || Settings.BudgetMilliseconds <= 0.0)
+	{
+		return Fraction;
+	}
+	if (FramesToIgnore > 0)
+	{
+		// Still the cost of the frames rendered before the last change.
+		FramesToIgnore--;
+		return Fraction;
+	}
+
+	const double Smoothing = FMath::Clamp(Settings.Smoothing, 0.01f, 1.0f);
+	SmoothedMilliseconds =
+		NumSamples == 0 ? GPUMilliseconds : FMath::Lerp(SmoothedMilliseconds, GPUMilliseconds, Smoothing);
+	NumSamples++;
+
+	const double Budget = Settings.BudgetMilliseconds;
+	const double Band = Budget * FMath::Clamp(Settings.Hysteresis, 0.0f, 0.9f);
+	if (SmoothedMilliseconds > Budget + Band)
+	{
+		FramesOutOfBand = FMath::Max(FramesOutOfBand, 0) + 1;
+	}
+	else if (SmoothedMilliseconds < Budget - Band)
+	{
+		FramesOutOfBand = FMath::Min(FramesOutOfBand, 0) - 1;
+	}
+	else
+	{
+		FramesOutOfBand = 0;
+	}
+	// Raising the fraction waits twice as long, so that noise around the budget doesn't flip it back and forth.
+	const bool bOverBudget = FramesOutOfBand > 0;
+	const int32 SettleFrames = FMath::Max(Settings.SettleFrames, 1) * (bOverBudget ? 1 : 2);
+	if (FMath::Abs(FramesOutOfBand) < SettleFrames)
+	{
+		return Fraction;
+	}
+
+	// Lowering aims for the budget and raising for the bottom of the band, in whole percentages rounded down. Costs
+	// that don't scale with the render size make the prediction optimistic when the fraction goes down and
+	// pessimistic when it goes up, so the frame time approaches the band from above and below respectively rather
+	// than overshooting it, and a raise can't take it over the budget.
+	const double TargetMilliseconds = bOverBudget ? Budget : Budget - Band;
+	const float MaxStep = FMath::Max(Settings.MaxStep, 0.01f);
+	const float Scale = float(FMath::Sqrt(TargetMilliseconds / SmoothedMilliseconds));
+	float NewFraction = FMath::Clamp(Fraction * Scale, Fraction - MaxStep, Fraction + MaxStep);
+	NewFraction = FMath::Clamp(FMath::FloorToFloat(NewFraction * 100.0f + UE_KINDA_SMALL_NUMBER) / 100.0f,
+		MinFraction,
+		MaxFraction);
+	FramesOutOfBand = 0;
+	if (FMath::IsNearlyEqual(NewFraction, Fraction))
+	{
+		// Already at a bound, or less than a percent away from the target.
+		return Fraction;
+	}
+
+	Fraction = NewFraction;
+	NumSamples = 0;
+	FramesToIgnore = FMath::Max(Settings.LatencyFrames, 0);
+	NumAdjustments++;
+	return Fraction;
+}
@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct NSSQualityGovernorSettings
+{
+	// The GPU frame time to aim for.
+	double BudgetMilliseconds = 16.6;
+	// Bounds of the render fraction, the render resolution as a fraction of the output's.
+	float MinFraction = 0.33f;
+	float MaxFraction = 0.67f;
+	// Half the width of the band around the budget, as a fraction of it, inside which the fraction is left alone.
+	float Hysteresis = 0.1f;
+	// Number of consecutive frames the smoothed frame time has to stay over the band before the fraction is lowered,
+	// twice as many under it before it is raised.
+	int32 SettleFrames = 10;
+	// Number of frames a change takes to show in the measured frame time, which are ignored after it.
+	int32 LatencyFrames = 3;
+	// Weight of each new frame time in the smoothed frame time.
+	float Smoothing = 0.25f;
+	// Largest change of the fraction in one adjustment.
+	float MaxStep = 0.1f;
+};
+
+//-------------------------------------------------------------------------------------
+// Picks the render fraction of each frame from the measured GPU frame time and a budget. The frame time is taken to
+// scale with the number of pixels rendered, so the fraction moves by the square root of the target frame time over
+// the smoothed one, once the frame time has been out of the band around the budget for SettleFrames frames (twice
+// that to raise it). The fraction is only raised as far as the bottom of the band, so that it settles rather than
+// oscillating between two fractions either side of the budget.
+//-------------------------------------------------------------------------------------
+class NSSQualityGovernor
+{
+public:
+	explicit NSSQualityGovernor(float InitialFraction = 1.0f)
+	{
+		Reset(InitialFraction);
+	}
+
+	// Starts again from Fraction, forgetting the frame times seen so far.
+	void Reset(float InFraction);
+
+	// Adds a frame's GPU time and returns the fraction to render the next frame at. Frames without a time (0 or less)
+	// leave everything as it is.
+	float Update(double GPUMilliseconds, const NSSQualityGovernorSettings& Settings);
+
+	float GetFraction() const
+	{
+		return Fraction;
+	}
+
+	double GetSmoothedMilliseconds() const
+	{
+		return SmoothedMilliseconds;
+	}
+
+	// The number of times the fraction changed since the governor was reset.
+	int32 GetNumAdjustments() const
+	{
+		return NumAdjustments;
+	}
+
+private:
+	float Fraction = 1.0f;
+	double SmoothedMilliseconds = 0.0;
+	int32 NumSamples = 0;
+	// Positive while the smoothed frame time is over the band, negative while it is under.
+	int32 FramesOutOfBand = 0;
+	int32 FramesToIgnore = 0;
+	int32 NumAdjustments = 0;
+};
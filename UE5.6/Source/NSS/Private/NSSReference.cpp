@@ -0,0 +1,486 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#include "NSSReference.h"
+
+namespace NSSReference
+{
+	void FImage::Init(FIntPoint InSize, int32 InChannels, float Value)
+	{
+		check(InSize.X >= 0 && InSize.Y >= 0 && InChannels > 0 && InChannels <= 4);
+		Size = InSize;
+		Channels = InChannels;
+		Texels.Init(Value, Size.X * Size.Y * Channels);
+	}
+
+	FVector4f FImage::Load(FIntPoint Pos) const
+	{
+		const float* Texel = At(Pos.X, Pos.Y);
+		FVector4f Result(0.0f, 0.0f, 0.0f, 0.0f);
+		for (int32 Channel = 0; Channel < Channels; Channel++)
+		{
+			Result[Channel] = Texel[Channel];
+		}
+		return Result;
+	}
+
+	void FImage::Store(FIntPoint Pos, const FVector4f& Value)
+	{
+		float* Texel = At(Pos.X, Pos.Y);
+		for (int32 Channel = 0; Channel < Channels; Channel++)
+		{
+			Texel[Channel] = Value[Channel];
+		}
+	}
+
+	int32 MirrorCoordinate(int32 X, int32 Size)
+	{
+		return X < Size ? X : FMath::Max(2 * Size - 2 - X, 0);
+	}
+
+	FIntPoint BorderStripPosition(FIntPoint Pos, FIntPoint ViewSize, FIntPoint PaddedSize, int32 StripWidth)
+	{
+		const int32 PaddingX = PaddedSize.X - ViewSize.X;
+		const int32 Index = Pos.Y < ViewSize.Y ? Pos.Y * PaddingX + (Pos.X - ViewSize.X)
+											   : PaddingX * ViewSize.Y + (Pos.Y - ViewSize.Y) * PaddedSize.X + Pos.X;
+		return FIntPoint(Index % StripWidth, Index / StripWidth);
+	}
+
+	FVector2f DecodeVelocity(const FVector4f& EncodedVelocity)
+	{
+		// Inverse of EncodeVelocityToTexture(): 0.499 keeps (0, 0) free as the "no velocity written" clear value and
+		// the extra 0.5 allows a range of -2..2.
+		const float InvDiv = 1.0f / (0.499f * 0.5f);
+		return FVector2f(EncodedVelocity.X * InvDiv - 32767.0f / 65535.0f * InvDiv,
+			EncodedVelocity.Y * InvDiv - 32767.0f / 65535.0f * InvDiv);
+	}
+
+	FVector2f ComputeStaticVelocity(const FVector2f& ScreenPos, float DeviceZ, const FMatrix44f& ClipToPrevClip)
+	{
+		const FVector4f ThisClip(ScreenPos.X, ScreenPos.Y, DeviceZ, 1.0f);
+		const FVector4f PrevClip = ClipToPrevClip.TransformFVector4(ThisClip);
+		return FVector2f(ScreenPos.X - PrevClip.X / PrevClip.W, ScreenPos.Y - PrevClip.Y / PrevClip.W);
+	}
+
+	namespace
+	{
+		FIntPoint MirrorPosition(FIntPoint Pos, const FIntRect& ViewRect)
+		{
+			return ViewRect.Min
+				   + FIntPoint(MirrorCoordinate(Pos.X, ViewRect.Width()), MirrorCoordinate(Pos.Y, ViewRect.Height()));
+		}
+
+		FVector2f MotionVector(
+			FIntPoint Pos, const FVector4f& EncodedVelocity, float DeviceZ, const FPrepareInputsParams& Params)
+		{
+			FVector2f Velocity;
+			if (EncodedVelocity.X > 0.0f)
+			{
+				Velocity = DecodeVelocity(EncodedVelocity);
+			}
+			else
+			{
+				const FVector2f ViewportUV((Pos.X + 0.5f) / Params.PaddedSize.X, (Pos.Y + 0.5f) / Params.PaddedSize.Y);
+				const FVector2f ScreenPos(ViewportUV.X * 2.0f - 1.0f, 1.0f - ViewportUV.Y * 2.0f);
+				Velocity = ComputeStaticVelocity(ScreenPos, DeviceZ, Params.ClipToPrevClip);
+			}
+			return Velocity * FVector2f(0.5f, -0.5f);
+		}
+	}
+
+	void MirrorPad(const FImage& Color,
+		const FImage& Depth,
+		const FImage& Velocity,
+		const FPrepareInputsParams& Params,
+		FImage& OutColor,
+		FImage& OutDepth,
+		FImage& OutVelocity)
+	{
+		OutColor.Init(Params.PaddedSize, Color.Channels);
+		OutDepth.Init(Params.PaddedSize, Depth.Channels);
+		OutVelocity.Init(Params.PaddedSize, Velocity.Channels);
+		for (int32 Y = 0; Y < Params.PaddedSize.Y; Y++)
+		{
+			for (int32 X = 0; X < Params.PaddedSize.X; X++)
+			{
+				const FIntPoint Pos(X, Y);
+				const FIntPoint SourcePos = MirrorPosition(Pos, Params.InputViewRect);
+				OutColor.Store(Pos, Color.Load(SourcePos));
+				OutDepth.Store(Pos, Depth.Load(SourcePos));
+				OutVelocity.Store(Pos, Velocity.Load(SourcePos));
+			}
+		}
+	}
+
+	void ConvertVelocity(
+		const FImage& Depth, const FImage& Velocity, const FPrepareInputsParams& Params, FImage& OutMotionVectors)
+	{
+		check(Depth.Size == Params.PaddedSize && Velocity.Size == Params.PaddedSize);
+		OutMotionVectors.Init(Params.PaddedSize, 2);
+		for (int32 Y = 0; Y < Params.PaddedSize.Y; Y++)
+		{
+			for (int32 X = 0; X < Params.PaddedSize.X; X++)
+			{
+				const FIntPoint Pos(X, Y);
+				const FVector2f Motion = MotionVector(Pos, Velocity.Load(Pos), Depth.Load(Pos).X, Params);
+				OutMotionVectors.Store(Pos, FVector4f(Motion.X, Motion.Y, 0.0f, 0.0f));
+			}
+		}
+	}
+
+	void PrepareInputs(const FImage& Color,
+		const FImage& Depth,
+		const FImage& Velocity,
+		const FPrepareInputsParams& Params,
+		FImage& OutColor,
+		FImage& OutDepth,
+		FImage& OutMotionVectors)
+	{
+		OutColor.Init(Params.PaddedSize, Color.Channels);
+		OutDepth.Init(Params.PaddedSize, 1);
+		OutMotionVectors.Init(Params.PaddedSize, 2);
+		for (int32 Y = 0; Y < Params.PaddedSize.Y; Y++)
+		{
+			for (int32 X = 0; X < Params.PaddedSize.X; X++)
+			{
+				const FIntPoint Pos(X, Y);
+				const FIntPoint SourcePos = MirrorPosition(Pos, Params.InputViewRect);
+				const float DeviceZ = Depth.Load(SourcePos).X;
+				OutColor.Store(Pos, Color.Load(SourcePos));
+				OutDepth.Store(Pos, FVector4f(DeviceZ, 0.0f, 0.0f, 0.0f));
+				const FVector2f Motion = MotionVector(Pos, Velocity.Load(SourcePos), DeviceZ, Params);
+				OutMotionVectors.Store(Pos, FVector4f(Motion.X, Motion.Y, 0.0f, 0.0f));
+			}
+		}
+	}
+
+	void PrepareInputsInPlace(FImage& Color,
+		FImage& Depth,
+		const FImage& Velocity,
+		const FPrepareInputsParams& Params,
+		int32 StripWidth,
+		FImage& OutMotionVectors)
+	{
+		const FIntPoint ViewSize = Params.InputViewRect.Size();
+		check(Params.InputViewRect.Min == FIntPoint::ZeroValue);
+		check(Color.Size.X >= Params.PaddedSize.X && Color.Size.Y >= Params.PaddedSize.Y);
+		check(Depth.Size.X >= Params.PaddedSize.X && Depth.Size.Y >= Params.PaddedSize.Y);
+		const int32 NumBorderTexels = (Params.PaddedSize.X - ViewSize.X) * ViewSize.Y
+									  + Params.PaddedSize.X * (Params.PaddedSize.Y - ViewSize.Y);
+		const FIntPoint StripSize(StripWidth, FMath::DivideAndRoundUp(NumBorderTexels, StripWidth));
+
+		// Compute pass: motion vectors everywhere, border texels into the strips.
+		FImage BorderColor, BorderDepth;
+		BorderColor.Init(StripSize, Color.Channels);
+		BorderDepth.Init(StripSize, 1);
+		OutMotionVectors.Init(Params.PaddedSize, 2);
+		for (int32 Y = 0; Y < Params.PaddedSize.Y; Y++)
+		{
+			for (int32 X = 0; X < Params.PaddedSize.X; X++)
+			{
+				const FIntPoint Pos(X, Y);
+				const FIntPoint SourcePos = MirrorPosition(Pos, Params.InputViewRect);
+				const float DeviceZ = Depth.Load(SourcePos).X;
+				if (X >= ViewSize.X || Y >= ViewSize.Y)
+				{
+					const FIntPoint StripPos = BorderStripPosition(Pos, ViewSize, Params.PaddedSize, StripWidth);
+					BorderColor.Store(StripPos, Color.Load(SourcePos));
+					BorderDepth.Store(StripPos, FVector4f(DeviceZ, 0.0f, 0.0f, 0.0f));
+				}
+				const FVector2f Motion = MotionVector(Pos, Velocity.Load(SourcePos), DeviceZ, Params);
+				OutMotionVectors.Store(Pos, FVector4f(Motion.X, Motion.Y, 0.0f, 0.0f));
+			}
+		}
+
+		// Raster passes over the right and bottom borders.
+		const FIntRect BorderRects[] = {
+			FIntRect(ViewSize.X, 0, Params.PaddedSize.X, ViewSize.Y),
+			FIntRect(0, ViewSize.Y, Params.PaddedSize.X, Params.PaddedSize.Y),
+		};
+		for (const FIntRect& BorderRect : BorderRects)
+		{
+			for (int32 Y = BorderRect.Min.Y; Y < BorderRect.Max.Y; Y++)
+			{
+				for (int32 X = BorderRect.Min.X; X < BorderRect.Max.X; X++)
+				{
+					const FIntPoint Pos(X, Y);
+					const FIntPoint StripPos = BorderStripPosition(Pos, ViewSize, Params.PaddedSize, StripWidth);
+					Color.Store(Pos, BorderColor.Load(StripPos));
+					Depth.Store(Pos, BorderDepth.Load(StripPos));
+				}
+			}
+		}
+	}
+
+	namespace
+	{
+		// A clamped bilinear sample at Pos in texels of a view at the origin of Image, as a linear clamp sampler
+		// returns with the UV kept within the view's outer texel centres.
+		FVector4f SampleBilinear(const FImage& Image, FVector2f Pos, FIntPoint ViewSize)
+		{
+			const FVector2f Clamped(FMath::Clamp(Pos.X, 0.5f, ViewSize.X - 0.5f) - 0.5f,
+				FMath::Clamp(Pos.Y, 0.5f, ViewSize.Y - 0.5f) - 0.5f);
+			const FIntPoint Min(FMath::FloorToInt32(Clamped.X), FMath::FloorToInt32(Clamped.Y));
+			const FIntPoint Max(FMath::Min(Min.X + 1, ViewSize.X - 1), FMath::Min(Min.Y + 1, ViewSize.Y - 1));
+			const float FracX = Clamped.X - float(Min.X);
+			const float FracY = Clamped.Y - float(Min.Y);
+			const FVector4f Top = FMath::Lerp(Image.Load(Min), Image.Load(FIntPoint(Max.X, Min.Y)), FracX);
+			const FVector4f Bottom = FMath::Lerp(Image.Load(FIntPoint(Min.X, Max.Y)), Image.Load(Max), FracX);
+			return FMath::Lerp(Top, Bottom, FracY);
+		}
+
+		FIntPoint InputTexel(FVector2f UV, FIntPoint InputSize)
+		{
+			return FIntPoint(FMath::Clamp(FMath::FloorToInt32(UV.X * InputSize.X), 0, InputSize.X - 1),
+				FMath::Clamp(FMath::FloorToInt32(UV.Y * InputSize.Y), 0, InputSize.Y - 1));
+		}
+	}
+
+	int32 ReprojectStereo(const FImage& PrimaryOutput,
+		const FImage& PrimaryDepth,
+		const FImage& SecondaryColor,
+		const FImage& SecondaryDepth,
+		const FStereoReprojectParams& Params,
+		FImage& OutColor)
+	{
+		if (OutColor.Size.X < Params.OutputSize.X || OutColor.Size.Y < Params.OutputSize.Y)
+		{
+			OutColor.Init(Params.OutputSize, 4);
+		}
+		int32 NumDisoccluded = 0;
+		for (int32 Y = 0; Y < OutColor.Size.Y; Y++)
+		{
+			for (int32 X = 0; X < OutColor.Size.X; X++)
+			{
+				// The padding repeats the edge of the view.
+				const FVector2f UV((FMath::Min(X, Params.OutputSize.X - 1) + 0.5f) / Params.OutputSize.X,
+					(FMath::Min(Y, Params.OutputSize.Y - 1) + 0.5f) / Params.OutputSize.Y);
+				const float DeviceZ = SecondaryDepth.Load(InputTexel(UV, Params.InputSize)).X;
+				const FVector4f PrimaryClip = Params.SecondaryClipToPrimaryClip.TransformFVector4(
+					FVector4f(UV.X * 2.0f - 1.0f, 1.0f - UV.Y * 2.0f, DeviceZ, 1.0f));
+				bool bVisible = PrimaryClip.W > 0.0f;
+				FVector2f PrimaryUV = FVector2f::ZeroVector;
+				if (bVisible)
+				{
+					PrimaryUV = FVector2f(PrimaryClip.X / PrimaryClip.W * 0.5f + 0.5f,
+						0.5f - PrimaryClip.Y / PrimaryClip.W * 0.5f);
+					bVisible = PrimaryUV.X >= 0.0f && PrimaryUV.X < 1.0f && PrimaryUV.Y >= 0.0f && PrimaryUV.Y < 1.0f;
+				}
+				if (bVisible)
+				{
+					const float ExpectedZ = PrimaryClip.Z / PrimaryClip.W;
+					const float PrimaryZ = PrimaryDepth.Load(InputTexel(PrimaryUV, Params.InputSize)).X;
+					bVisible = FMath::Abs(PrimaryZ - ExpectedZ)
+							   <= Params.DisocclusionThreshold * FMath::Max(PrimaryZ, ExpectedZ);
+				}
+				FVector4f Color;
+				if (bVisible)
+				{
+					Color = SampleBilinear(PrimaryOutput, PrimaryUV * FVector2f(Params.OutputSize), Params.OutputSize);
+				}
+				else
+				{
+					Color = SampleBilinear(SecondaryColor, UV * FVector2f(Params.InputSize), Params.InputSize);
+					NumDisoccluded++;
+				}
+				OutColor.Store(FIntPoint(X, Y), Color);
+			}
+		}
+		return NumDisoccluded;
+	}
+
+	namespace
+	{
+		// The relative difference of a tile feature, against a floor for features near 0 such as dark tiles.
+		bool FeatureChanged(float Value, float PrevValue, float Threshold)
+		{
+			const float Scale = FMath::Max(FMath::Max(FMath::Abs(Value), FMath::Abs(PrevValue)), 1e-3f);
+			return FMath::Abs(Value - PrevValue) > Threshold * Scale;
+		}
+	}
+
+	void ClassifyTiles(const FImage& Color,
+		const FImage& Depth,
+		const FImage& MotionVectors,
+		const FImage* PrevFeatures,
+		const FTileClassifyParams& Params,
+		FTileClassification& OutClassification)
+	{
+		const FIntPoint Size = Color.Size;
+		check(Depth.Size == Size && MotionVectors.Size == Size);
+		const int32 TileSize = FMath::Max(Params.TileSize, 8);
+		const FIntPoint NumTiles(FMath::DivideAndRoundUp(Size.X, TileSize), FMath::DivideAndRoundUp(Size.Y, TileSize));
+		const bool bHasPrevious = PrevFeatures && PrevFeatures->Size == NumTiles;
+		FTileClassification& Out = OutClassification;
+		Out.NumTiles = NumTiles;
+		Out.Features.Init(NumTiles, 3);
+		Out.Changed.SetNumZeroed(NumTiles.X * NumTiles.Y);
+		Out.Active.SetNumZeroed(NumTiles.X * NumTiles.Y);
+		Out.NumChanged = 0;
+		Out.NumActive = 0;
+		for (int32 TileY = 0; TileY < NumTiles.Y; TileY++)
+		{
+			for (int32 TileX = 0; TileX < NumTiles.X; TileX++)
+			{
+				const FIntPoint Tile(TileX, TileY);
+				const FIntPoint Min = Tile * TileSize;
+				const FIntPoint Max(FMath::Min(Min.X + TileSize, Size.X), FMath::Min(Min.Y + TileSize, Size.Y));
+				float SumLuma = 0.0f;
+				float SumDepth = 0.0f;
+				float MaxMotion = 0.0f;
+				for (int32 Y = Min.Y; Y < Max.Y; Y++)
+				{
+					for (int32 X = Min.X; X < Max.X; X++)
+					{
+						const FIntPoint Pos(X, Y);
+						const FVector4f Texel = Color.Load(Pos);
+						SumLuma += Texel.X * 0.3f + Texel.Y * 0.59f + Texel.Z * 0.11f;
+						SumDepth += Depth.Load(Pos).X;
+						const FVector4f Motion = MotionVectors.Load(Pos);
+						MaxMotion = FMath::Max(MaxMotion, FVector2f(Motion.X * Size.X, Motion.Y * Size.Y).Size());
+					}
+				}
+				const float NumTexels = float((Max.X - Min.X) * (Max.Y - Min.Y));
+				const FVector4f Features(SumLuma / NumTexels, SumDepth / NumTexels, MaxMotion, 0.0f);
+				Out.Features.Store(Tile, Features);
+				bool bChanged = !bHasPrevious || MaxMotion > Params.MotionThresholdPixels;
+				if (!bChanged)
+				{
+					const FVector4f PrevTileFeatures = PrevFeatures->Load(Tile);
+					bChanged = FeatureChanged(Features.X, PrevTileFeatures.X, Params.LumaThreshold)
+							   || FeatureChanged(Features.Y, PrevTileFeatures.Y, Params.DepthThreshold);
+				}
+				Out.Changed[TileY * NumTiles.X + TileX] = bChanged ? 1 : 0;
+				Out.NumChanged += bChanged ? 1 : 0;
+			}
+		}
+
+		const int32 Halo = FMath::Max(Params.HaloTiles, 0);
+		for (int32 TileY = 0; TileY < NumTiles.Y; TileY++)
+		{
+			for (int32 TileX = 0; TileX < NumTiles.X; TileX++)
+			{
+				bool bActive = false;
+				for (int32 Y = FMath::Max(TileY - Halo, 0); Y <= FMath::Min(TileY + Halo, NumTiles.Y - 1); Y++)
+				{
+					for (int32 X = FMath::Max(TileX - Halo, 0); X <= FMath::Min(TileX + Halo, NumTiles.X - 1); X++)
+					{
+						bActive |= Out.Changed[Y * NumTiles.X + X] != 0;
+					}
+				}
+				Out.Active[TileY * NumTiles.X + TileX] = bActive ? 1 : 0;
+				Out.NumActive += bActive ? 1 : 0;
+			}
+		}
+	}
+
+	int32 ComposeTiles(const FTileClassification& Classification,
+		int32 TileSize,
+		FIntPoint PaddedInputSize,
+		const FImage& History,
+		FImage& Output)
+	{
+		check(History.Size == Output.Size);
+		TileSize = FMath::Max(TileSize, 8);
+		const FVector2f InputPerOutput(
+			float(PaddedInputSize.X) / float(Output.Size.X), float(PaddedInputSize.Y) / float(Output.Size.Y));
+		int32 NumCarried = 0;
+		for (int32 Y = 0; Y < Output.Size.Y; Y++)
+		{
+			for (int32 X = 0; X < Output.Size.X; X++)
+			{
+				// The input texel the output texel's centre falls in.
+				const FIntPoint InputPos(
+					FMath::Min(FMath::FloorToInt32((X + 0.5f) * InputPerOutput.X), PaddedInputSize.X - 1),
+					FMath::Min(FMath::FloorToInt32((Y + 0.5f) * InputPerOutput.Y), PaddedInputSize.Y - 1));
+				if (!Classification.IsActive(InputPos / TileSize))
+				{
+					Output.Store(FIntPoint(X, Y), History.Load(FIntPoint(X, Y)));
+					NumCarried++;
+				}
+			}
+		}
+		return NumCarried;
+	}
+
+	float GetRegionOfInterestWeight(const NSSRegionOfInterest& Region, FVector2f Pos, FIntPoint OutputSize)
+	{
+		const FVector2f Center = Region.Center * FVector2f(OutputSize);
+		const float Distance = FVector2f::Distance(Pos, Center) / float(FMath::Max(OutputSize.Y, 1));
+		// A hard edge without a feather.
+		const float Feather = FMath::Max(Region.Feather, 0.0f);
+		const float T = FMath::Clamp((Region.Radius + Feather - Distance) / FMath::Max(Feather, 1e-6f), 0.0f, 1.0f);
+		return T * T * (3.0f - 2.0f * T);
+	}
+
+	int32 CountRegionOfInterestTexels(const NSSRegionOfInterest& Region, FIntPoint OutputSize)
+	{
+		const FVector2f Center = Region.Center * FVector2f(OutputSize);
+		const float OuterRadius = (Region.Radius + FMath::Max(Region.Feather, 0.0f)) * float(OutputSize.Y);
+		int32 NumTexels = 0;
+		for (int32 Y = 0; Y < OutputSize.Y; Y++)
+		{
+			auto IsNetworkTexel = [&Region, OutputSize, Y](int32 X)
+			{
+				return GetRegionOfInterestWeight(Region, FVector2f(X + 0.5f, Y + 0.5f), OutputSize) > 0.0f;
+			};
+			// The span of the row within the region, settled on the texels either side of it by the weight itself
+			// so that the count agrees with the blend whatever the rounding.
+			const float OffsetY = Y + 0.5f - Center.Y;
+			const float HalfWidth = FMath::Sqrt(FMath::Max(OuterRadius * OuterRadius - OffsetY * OffsetY, 0.0f));
+			int32 MinX = FMath::Clamp(FMath::CeilToInt32(Center.X - HalfWidth - 0.5f), 0, OutputSize.X);
+			int32 MaxX = FMath::Clamp(FMath::FloorToInt32(Center.X + HalfWidth - 0.5f), -1, OutputSize.X - 1);
+			while (MinX > 0 && IsNetworkTexel(MinX - 1))
+			{
+				MinX--;
+			}
+			while (MinX <= MaxX && !IsNetworkTexel(MinX))
+			{
+				MinX++;
+			}
+			while (MaxX < OutputSize.X - 1 && IsNetworkTexel(MaxX + 1))
+			{
+				MaxX++;
+			}
+			while (MaxX >= MinX && !IsNetworkTexel(MaxX))
+			{
+				MaxX--;
+			}
+			NumTexels += FMath::Max(MaxX - MinX + 1, 0);
+		}
+		return NumTexels;
+	}
+
+	int32 BlendRegionOfInterest(const FImage& NetworkOutput,
+		const FImage& InputColor,
+		FIntPoint InputSize,
+		FIntPoint OutputSize,
+		const NSSRegionOfInterest& Region,
+		FImage& OutColor)
+	{
+		check(NetworkOutput.Size.X >= OutputSize.X && NetworkOutput.Size.Y >= OutputSize.Y);
+		OutColor.Init(NetworkOutput.Size, 4);
+		const FVector2f InputPerOutput(
+			float(InputSize.X) / float(OutputSize.X), float(InputSize.Y) / float(OutputSize.Y));
+		int32 NumNetworkTexels = 0;
+		for (int32 Y = 0; Y < OutColor.Size.Y; Y++)
+		{
+			for (int32 X = 0; X < OutColor.Size.X; X++)
+			{
+				const FVector2f Pos(FMath::Min(X, OutputSize.X - 1) + 0.5f, FMath::Min(Y, OutputSize.Y - 1) + 0.5f);
+				const float Weight = GetRegionOfInterestWeight(Region, Pos, OutputSize);
+				FVector4f Color = NetworkOutput.Load(FIntPoint(X, Y));
+				if (Weight < 1.0f)
+				{
+					Color = FMath::Lerp(SampleBilinear(InputColor, Pos * InputPerOutput, InputSize), Color, Weight);
+				}
+				OutColor.Store(FIntPoint(X, Y), Color);
+				if (Weight > 0.0f && X < OutputSize.X && Y < OutputSize.Y)
+				{
+					NumNetworkTexels++;
+				}
+			}
+		}
+		return NumNetworkTexels;
+	}
+}
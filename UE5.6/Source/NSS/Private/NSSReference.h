@@ -0,0 +1,176 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NGCPUBackend.h"
+#include "NSSRegionOfInterest.h"
+
+//-------------------------------------------------------------------------------------
+// CPU reference implementations of the NSS input preparation shaders.
+// These don't need an RHI so that they can be exercised on a headless machine (e.g. -nullrhi) and compared against
+// each other and against GPU captures.
+//-------------------------------------------------------------------------------------
+namespace NSSReference
+{
+	// A tightly packed image with Channels floats per texel, which the CPU backend can read and write directly.
+	struct FImage : public NGCPUImage
+	{
+		void Init(FIntPoint InSize, int32 InChannels, float Value = 0.0f);
+
+		FVector4f Load(FIntPoint Pos) const;
+		void Store(FIntPoint Pos, const FVector4f& Value);
+	};
+
+	struct FPrepareInputsParams
+	{
+		// The region of the input images holding the rendered view.
+		FIntRect InputViewRect;
+		// Padded (network) resolution.
+		FIntPoint PaddedSize = FIntPoint::ZeroValue;
+		// View.ClipToPrevClip, used to derive motion for pixels without an encoded velocity.
+		FMatrix44f ClipToPrevClip = FMatrix44f::Identity;
+	};
+
+	struct FStereoReprojectParams
+	{
+		// Rendered and upscaled size of each eye, at the origin of the images.
+		FIntPoint InputSize = FIntPoint::ZeroValue;
+		FIntPoint OutputSize = FIntPoint::ZeroValue;
+		// Takes a clip space position of the secondary eye (with a w of 1) to the primary eye's, without jitter.
+		FMatrix44f SecondaryClipToPrimaryClip = FMatrix44f::Identity;
+		// Relative difference in device z past which the primary eye is taken to see a different surface.
+		float DisocclusionThreshold = 0.01f;
+	};
+
+	struct FTileClassifyParams
+	{
+		// Size of the square tiles in texels of the padded inputs, at least 8.
+		int32 TileSize = 8;
+		// Tiles around each changed tile that are active as well.
+		int32 HaloTiles = 1;
+		// Longest motion vector of a tile, in texels, past which it changed.
+		float MotionThresholdPixels = 0.05f;
+		// Relative differences of the mean device z and luma of a tile past which it changed.
+		float DepthThreshold = 0.001f;
+		float LumaThreshold = 0.02f;
+	};
+
+	struct FTileClassification
+	{
+		FIntPoint NumTiles = FIntPoint::ZeroValue;
+		// Mean luma, mean device z and longest motion vector in texels of each tile, compared with the next frame's.
+		FImage Features;
+		// Per tile, row by row: whether it changed, and whether it or a tile within the halo changed.
+		TArray<uint8> Changed;
+		TArray<uint8> Active;
+		int32 NumChanged = 0;
+		int32 NumActive = 0;
+
+		bool IsActive(FIntPoint Tile) const
+		{
+			return Active[Tile.Y * NumTiles.X + Tile.X] != 0;
+		}
+
+		float GetActiveFraction() const
+		{
+			const int32 NumTotal = NumTiles.X * NumTiles.Y;
+			return NumTotal > 0 ? float(NumActive) / float(NumTotal) : 0.0f;
+		}
+	};
+
+	// Mirrors a coordinate past the end of the view without duplicating the last texel (NssMirrorPad.usf).
+	int32 MirrorCoordinate(int32 X, int32 Size);
+
+	// The xy part of DecodeVelocityFromTexture().
+	FVector2f DecodeVelocity(const FVector4f& EncodedVelocity);
+
+	// Position of a border texel in the strips written when padding in place (BorderStripPosition in
+	// NssPrepareInputs.usf).
+	FIntPoint BorderStripPosition(FIntPoint Pos, FIntPoint ViewSize, FIntPoint PaddedSize, int32 StripWidth);
+
+	// Camera motion of a pixel for the given screen position and device z (NssConvertVelocityPS.usf).
+	FVector2f ComputeStaticVelocity(const FVector2f& ScreenPos, float DeviceZ, const FMatrix44f& ClipToPrevClip);
+
+	// NssMirrorPad.usf: copies the view into padded colour/depth/velocity images.
+	void MirrorPad(const FImage& Color,
+		const FImage& Depth,
+		const FImage& Velocity,
+		const FPrepareInputsParams& Params,
+		FImage& OutColor,
+		FImage& OutDepth,
+		FImage& OutVelocity);
+
+	// NssConvertVelocityPS.usf: produces the motion vectors NSS consumes from already padded depth/velocity.
+	void ConvertVelocity(
+		const FImage& Depth, const FImage& Velocity, const FPrepareInputsParams& Params, FImage& OutMotionVectors);
+
+	// NssPrepareInputs.usf: the fused equivalent of MirrorPad followed by ConvertVelocity.
+	void PrepareInputs(const FImage& Color,
+		const FImage& Depth,
+		const FImage& Velocity,
+		const FPrepareInputsParams& Params,
+		FImage& OutColor,
+		FImage& OutDepth,
+		FImage& OutMotionVectors);
+
+	// NssPrepareInputs.usf with PAD_MODE 2 followed by PadBorderPS: writes the mirrored border into Color and Depth
+	// past the end of the view, which must start at the origin of images at least Params.PaddedSize.
+	void PrepareInputsInPlace(FImage& Color,
+		FImage& Depth,
+		const FImage& Velocity,
+		const FPrepareInputsParams& Params,
+		int32 StripWidth,
+		FImage& OutMotionVectors);
+
+	// NssStereoReproject.usf: the secondary eye's upscaled output taken from the primary eye's, with a bilinear
+	// upscale of the secondary eye's own render where the primary eye can't see the surface. OutColor is initialised
+	// to Params.OutputSize unless it is already at least that size (e.g. a padded output), in which case the padding
+	// is filled from the edge of the view. Returns the number of disoccluded texels.
+	int32 ReprojectStereo(const FImage& PrimaryOutput,
+		const FImage& PrimaryDepth,
+		const FImage& SecondaryColor,
+		const FImage& SecondaryDepth,
+		const FStereoReprojectParams& Params,
+		FImage& OutColor);
+
+	// NssSparseTiles.usf ClassifyCS and DilateCS: splits the padded inputs of the network into tiles and finds the ones
+	// whose motion, depth or luma changed since the frame PrevFeatures were classified from, and the active tiles the
+	// network would have to run on for them. Every tile changed without PrevFeatures, or if they were classified at
+	// another size.
+	void ClassifyTiles(const FImage& Color,
+		const FImage& Depth,
+		const FImage& MotionVectors,
+		const FImage* PrevFeatures,
+		const FTileClassifyParams& Params,
+		FTileClassification& OutClassification);
+
+	// Carries History forward into the texels of the padded Output that upscale the inactive tiles of the
+	// classification of padded inputs of PaddedInputSize, which previews the quality of running the network on the
+	// active tiles only. Returns the number of texels carried forward.
+	int32 ComposeTiles(const FTileClassification& Classification,
+		int32 TileSize,
+		FIntPoint PaddedInputSize,
+		const FImage& History,
+		FImage& Output);
+
+	// NssRegionOfInterest.usf: the weight of the network's output at Pos, in pixels of an output view of OutputSize.
+	// It is 1 within Region, falls smoothly to 0 across the feathered edge and is 0 past it.
+	float GetRegionOfInterestWeight(const NSSRegionOfInterest& Region, FVector2f Pos, FIntPoint OutputSize);
+
+	// The texels of an output view of OutputSize whose centres have a weight above 0, which are the ones the network
+	// would have to run on. Counted a row at a time, so that it is cheap enough to report every frame.
+	int32 CountRegionOfInterestTexels(const NSSRegionOfInterest& Region, FIntPoint OutputSize);
+
+	// NssRegionOfInterest.usf: the network's output within Region, a bilinear upscale of InputColor, rendered at
+	// InputSize, past it, and a blend of the two across the feathered edge. OutColor is initialised to the size of
+	// NetworkOutput, which may be padded past OutputSize, and the padding takes its weight from the edge of the view.
+	// Returns the number of texels of the view that keep some of the network's output.
+	int32 BlendRegionOfInterest(const FImage& NetworkOutput,
+		const FImage& InputColor,
+		FIntPoint InputSize,
+		FIntPoint OutputSize,
+		const NSSRegionOfInterest& Region,
+		FImage& OutColor);
+}
@@ -0,0 +1,1052 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#include "NSSReplay.h"
+
+#include "Async/ParallelFor.h"
+#include "HAL/Event.h"
+#include "LogNSS.h"
+#include "NGSettings.h"
+#include "NSS.h"
+#include "NSSContextSizes.h"
+#include "RHICommandList.h"
+#include "RenderingThread.h"
+
+namespace
+{
+	// Inverse of NSSReference::DecodeVelocity for one component.
+	float EncodeVelocity(float Velocity)
+	{
+		return Velocity * (0.499f * 0.5f) + 32767.0f / 65535.0f;
+	}
+
+	const TCHAR* GetBackendName(EFFXBackendAPI Api)
+	{
+		switch (Api)
+		{
+		case EFFXBackendAPI::Vulkan:
+			return TEXT("Vulkan");
+		case EFFXBackendAPI::CPU:
+			return TEXT("CPU");
+		default:
+			return TEXT("Unsupported");
+		}
+	}
+
+	double ElapsedMilliseconds(double StartSeconds)
+	{
+		return (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+	}
+
+	// How long the timestamps of a dispatch are polled for before the frame is left untimed.
+	constexpr double MaxTimestampWaitMilliseconds = 1000.0;
+
+	// Waits for the commands enqueued so far to run. FlushRenderingCommands is only for the game thread, while
+	// replays also run on worker threads, e.g. to calibrate NSS.
+	void WaitForRenderingThread()
+	{
+		if (IsInGameThread())
+		{
+			FlushRenderingCommands();
+			return;
+		}
+		FEvent* Done = FPlatformProcess::GetSynchEventFromPool();
+		ENQUEUE_RENDER_COMMAND(NSSReplayWait)([Done](FRHICommandListImmediate&) { Done->Trigger(); });
+		Done->Wait();
+		FPlatformProcess::ReturnSynchEventToPool(Done);
+	}
+
+	// Creates Texture again if it doesn't match the image it has to hold.
+	void EnsureTexture(FRHICommandListImmediate& RHICmdList,
+		FTextureRHIRef& Texture,
+		FIntPoint Size,
+		int32 Channels,
+		const TCHAR* Name,
+		ETextureCreateFlags Flags)
+	{
+		const EPixelFormat Format = Channels == 1 ? PF_R32_FLOAT : Channels == 2 ? PF_G32R32F : PF_A32B32G32R32F;
+		if (!Texture.IsValid() || Texture->GetSizeXY() != Size || Texture->GetFormat() != Format)
+		{
+			const FRHITextureCreateDesc Desc = FRHITextureCreateDesc::Create2D(Name, Size.X, Size.Y, Format)
+												   .SetFlags(ETextureCreateFlags::ShaderResource | Flags)
+												   .SetInitialState(ERHIAccess::SRVCompute);
+			Texture = RHICmdList.CreateTexture(Desc);
+		}
+	}
+
+	void UploadImage(
+		FRHICommandListImmediate& RHICmdList, FTextureRHIRef& Texture, const NGCPUImage& Image, const TCHAR* Name)
+	{
+		EnsureTexture(RHICmdList, Texture, Image.Size, Image.Channels, Name, ETextureCreateFlags::None);
+		RHICmdList.Transition(FRHITransitionInfo(Texture, ERHIAccess::Unknown, ERHIAccess::CopyDest));
+		RHICmdList.UpdateTexture2D(Texture,
+			0,
+			FUpdateTextureRegion2D(0, 0, 0, 0, Image.Size.X, Image.Size.Y),
+			Image.Size.X * Image.Channels * sizeof(float),
+			reinterpret_cast<const uint8*>(Image.Texels.GetData()));
+		RHICmdList.Transition(FRHITransitionInfo(Texture, ERHIAccess::CopyDest, ERHIAccess::SRVCompute));
+	}
+
+	struct FSummary
+	{
+		double Mean = 0.0;
+		double Median = 0.0;
+		double P95 = 0.0;
+		double Max = 0.0;
+	};
+
+	FSummary Summarise(TArray<double> Values)
+	{
+		FSummary Summary;
+		if (Values.Num() == 0)
+		{
+			return Summary;
+		}
+		Values.Sort();
+		double Total = 0.0;
+		for (double Value : Values)
+		{
+			Total += Value;
+		}
+		Summary.Mean = Total / double(Values.Num());
+		Summary.Median = Values[Values.Num() / 2];
+		Summary.P95 = Values[FMath::Min(FMath::CeilToInt32(double(Values.Num()) * 0.95) - 1, Values.Num() - 1)];
+		Summary.Max = Values.Last();
+		return Summary;
+	}
+
+	FString SummaryToJson(const FSummary& Summary)
+	{
+		return FString::Printf(TEXT("{\"mean\": %.4f, \"median\": %.4f, \"p95\": %.4f, \"max\": %.4f}"),
+			Summary.Mean,
+			Summary.Median,
+			Summary.P95,
+			Summary.Max);
+	}
+
+	FString OptionalToString(const TOptional<double>& Value, const TCHAR* Unset)
+	{
+		return Value.IsSet() ? FString::Printf(TEXT("%.4f"), Value.GetValue()) : FString(Unset);
+	}
+}
+
+//-------------------------------------------------------------------------------------
+// Sequences
+//-------------------------------------------------------------------------------------
+FIntPoint NSSReplaySequence::GetMaxInputSize() const
+{
+	FIntPoint MaxInputSize = FIntPoint::ZeroValue;
+	for (const NSSReplayFrame& Frame : Frames)
+	{
+		MaxInputSize = MaxInputSize.ComponentMax(Frame.InputSize);
+	}
+	return MaxInputSize;
+}
+
+bool LoadNSSReplaySequence(const FString& Path, NSSReplaySequence& OutSequence, FString& OutError)
+{
+	NSSCaptureReader Reader;
+	if (!Reader.Open(Path, OutError))
+	{
+		return false;
+	}
+	OutSequence.Name = Reader.GetName();
+	OutSequence.Frames.SetNum(Reader.GetNumFrames());
+	for (int32 Index = 0; Index < OutSequence.Frames.Num(); Index++)
+	{
+		if (!Reader.ReadFrame(Index, OutSequence.Frames[Index], OutError))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool SaveNSSReplaySequence(const FString& Path, const NSSReplaySequence& Sequence, const NSSCaptureSettings& Settings)
+{
+	NSSCaptureWriter Writer;
+	if (!Writer.Open(Path, Sequence.Name, Settings))
+	{
+		return false;
+	}
+	for (const NSSReplayFrame& Frame : Sequence.Frames)
+	{
+		if (!Writer.AddFrame(Frame))
+		{
+			Writer.Close();
+			return false;
+		}
+	}
+	return Writer.Close();
+}
+
+NSSReplaySequence MakeSyntheticNSSReplaySequence(
+	FIntPoint InputSize, FIntPoint OutputSize, int32 NumFrames, int32 CameraCutInterval, float EyeOffsetPixels)
+{
+	// Render pixels the pattern moves right each frame.
+	constexpr float PanPixels = 2.0f;
+	NSSReplaySequence Sequence;
+	Sequence.Name = FString::Printf(
+		TEXT("Synthetic_%dx%d_to_%dx%d"), InputSize.X, InputSize.Y, OutputSize.X, OutputSize.Y);
+	if (EyeOffsetPixels != 0.0f)
+	{
+		Sequence.Name += TEXT("_SecondaryEye");
+	}
+	Sequence.Frames.SetNum(NumFrames);
+	for (int32 Index = 0; Index < NumFrames; Index++)
+	{
+		NSSReplayFrame& Frame = Sequence.Frames[Index];
+		Frame.InputSize = InputSize;
+		Frame.OutputSize = OutputSize;
+		Frame.InputViewRect = FIntRect(FIntPoint::ZeroValue, InputSize);
+		Frame.OutputViewRect = FIntRect(FIntPoint::ZeroValue, OutputSize);
+		// Halton(2, 3) jitter, as the engine uses.
+		const int32 JitterIndex = Index % 8 + 1;
+		Frame.JitterPixels = FVector2f(FMath::Halton(JitterIndex, 2) - 0.5f, FMath::Halton(JitterIndex, 3) - 0.5f);
+		Frame.bCameraCut = CameraCutInterval > 0 && Index > 0 && Index % CameraCutInterval == 0;
+		Frame.FovAngleVertical = FMath::DegreesToRadians(60.0f);
+		Frame.NearPlane = 10.0f;
+
+		// A different pattern after each cut.
+		const int32 Shot = CameraCutInterval > 0 ? Index / CameraCutInterval : 0;
+		const float Offset = PanPixels * float(Index) + float(Shot) * 37.0f + EyeOffsetPixels;
+		const float EncodedVelocityX = EncodeVelocity(2.0f * PanPixels / float(InputSize.X));
+		Frame.Color.Init(InputSize, 4);
+		Frame.Depth.Init(InputSize, 1, 0.1f);
+		Frame.Velocity.Init(InputSize, 2);
+		for (int32 Y = 0; Y < InputSize.Y; Y++)
+		{
+			for (int32 X = 0; X < InputSize.X; X++)
+			{
+				const float U = float(X) + 0.5f + Frame.JitterPixels.X - Offset;
+				const float V = float(Y) + 0.5f + Frame.JitterPixels.Y;
+				const bool bChecker = ((FMath::FloorToInt32(U / 8.0f) + FMath::FloorToInt32(V / 8.0f)) & 1) != 0;
+				const float Value = (bChecker ? 0.8f : 0.1f) + 0.1f * V / float(InputSize.Y);
+				Frame.Color.Store(FIntPoint(X, Y), FVector4f(Value, Value * 0.5f, 1.0f - Value, 1.0f));
+				Frame.Velocity.Store(FIntPoint(X, Y), FVector4f(EncodedVelocityX, EncodeVelocity(0.0f), 0.0f, 0.0f));
+			}
+		}
+	}
+	return Sequence;
+}
+
+FMatrix44f MakeSyntheticNSSStereoClipToPrimaryClip(FIntPoint InputSize, float EyeOffsetPixels)
+{
+	// The pattern is flat, so the eyes only differ by a horizontal shift.
+	FMatrix44f SecondaryClipToPrimaryClip = FMatrix44f::Identity;
+	SecondaryClipToPrimaryClip.M[3][0] = -2.0f * EyeOffsetPixels / float(FMath::Max(InputSize.X, 1));
+	return SecondaryClipToPrimaryClip;
+}
+
+//-------------------------------------------------------------------------------------
+// Results
+//-------------------------------------------------------------------------------------
+FString NSSReplayResults::ToJson() const
+{
+	TArray<double> CPUMilliseconds;
+	TArray<double> GPUMilliseconds;
+	uint64 Allocations = 0;
+	uint64 AllocatedBytes = 0;
+	int32 ContextCreations = 0;
+	int32 HistoryResets = 0;
+	TArray<double> ActiveTilePercentages;
+	for (const NSSReplayFrameResult& Frame : Frames)
+	{
+		CPUMilliseconds.Add(Frame.CPUMilliseconds);
+		if (Frame.Tiles > 0)
+		{
+			ActiveTilePercentages.Add(double(Frame.ActiveTiles) * 100.0 / double(Frame.Tiles));
+		}
+		if (Frame.GPUMilliseconds.IsSet())
+		{
+			GPUMilliseconds.Add(Frame.GPUMilliseconds.GetValue());
+		}
+		Allocations += Frame.Allocations.GetTotal();
+		AllocatedBytes += Frame.Allocations.AllocatedBytes;
+		ContextCreations += Frame.ContextCreations;
+		HistoryResets += Frame.bHistoryReset ? 1 : 0;
+	}
+
+	FString Json = TEXT("{\n");
+	Json += FString::Printf(TEXT("\t\"sequence\": \"%s\",\n"), *SequenceName.ReplaceCharWithEscapedChar());
+	Json += FString::Printf(TEXT("\t\"backend\": \"%s\",\n"), *BackendName);
+	Json += FString::Printf(TEXT("\t\"frames\": %d,\n"), Frames.Num());
+	Json += TEXT("\t\"summary\": {\n");
+	Json += FString::Printf(TEXT("\t\t\"cpuMs\": %s,\n"), *SummaryToJson(Summarise(CPUMilliseconds)));
+	Json += FString::Printf(TEXT("\t\t\"gpuMs\": %s,\n"),
+		GPUMilliseconds.Num() > 0 ? *SummaryToJson(Summarise(GPUMilliseconds)) : TEXT("null"));
+	Json += FString::Printf(TEXT("\t\t\"allocations\": %llu,\n"), Allocations);
+	Json += FString::Printf(TEXT("\t\t\"allocatedBytes\": %llu,\n"), AllocatedBytes);
+	Json += FString::Printf(TEXT("\t\t\"contextCreations\": %d,\n"), ContextCreations);
+	Json += FString::Printf(TEXT("\t\t\"historyResets\": %d,\n"), HistoryResets);
+	Json += FString::Printf(TEXT("\t\t\"activeTilesPercent\": %s\n"),
+		ActiveTilePercentages.Num() > 0 ? *SummaryToJson(Summarise(ActiveTilePercentages)) : TEXT("null"));
+	Json += TEXT("\t},\n");
+	Json += TEXT("\t\"perFrame\": [\n");
+	for (int32 Index = 0; Index < Frames.Num(); Index++)
+	{
+		const NSSReplayFrameResult& Frame = Frames[Index];
+		Json += FString::Printf(TEXT("\t\t{\"frame\": %d, \"cpuMs\": %.4f, \"inputPreparationMs\": %.4f, "
+									 "\"dispatchMs\": %.4f, \"allocations\": %llu, \"allocatedBytes\": %llu, "
+									 "\"contextCreations\": %d, \"historyReset\": %s, \"reprojected\": %s, "
+									 "\"reprojectionMs\": %.4f, \"tiles\": %d, \"changedTiles\": %d, "
+									 "\"activeTiles\": %d, \"tileClassificationMs\": %.4f, \"gpuMs\": %s}%s\n"),
+			Frame.Frame,
+			Frame.CPUMilliseconds,
+			Frame.InputPreparationMilliseconds,
+			Frame.DispatchMilliseconds,
+			Frame.Allocations.GetTotal(),
+			Frame.Allocations.AllocatedBytes,
+			Frame.ContextCreations,
+			Frame.bHistoryReset ? TEXT("true") : TEXT("false"),
+			Frame.bReprojected ? TEXT("true") : TEXT("false"),
+			Frame.ReprojectionMilliseconds,
+			Frame.Tiles,
+			Frame.ChangedTiles,
+			Frame.ActiveTiles,
+			Frame.TileClassificationMilliseconds,
+			*OptionalToString(Frame.GPUMilliseconds, TEXT("null")),
+			Index + 1 < Frames.Num() ? TEXT(",") : TEXT(""));
+	}
+	Json += TEXT("\t]\n");
+	Json += TEXT("}\n");
+	return Json;
+}
+
+FString NSSReplayResults::ToCsv() const
+{
+	FString Csv = TEXT("Frame,CPUMs,InputPreparationMs,DispatchMs,Allocations,AllocatedBytes,ContextCreations,"
+					   "HistoryReset,GPUMs\n");
+	for (const NSSReplayFrameResult& Frame : Frames)
+	{
+		Csv += FString::Printf(TEXT("%d,%.4f,%.4f,%.4f,%llu,%llu,%d,%d,%s\n"),
+			Frame.Frame,
+			Frame.CPUMilliseconds,
+			Frame.InputPreparationMilliseconds,
+			Frame.DispatchMilliseconds,
+			Frame.Allocations.GetTotal(),
+			Frame.Allocations.AllocatedBytes,
+			Frame.ContextCreations,
+			Frame.bHistoryReset ? 1 : 0,
+			*OptionalToString(Frame.GPUMilliseconds, TEXT("")));
+	}
+	return Csv;
+}
+
+FString NSSMultiViewReplayResults::ToJson() const
+{
+	uint64 Allocations = 0;
+	int32 ContextCreations = 0;
+	FString ViewsJson;
+	for (int32 Index = 0; Index < Views.Num(); Index++)
+	{
+		const NSSReplayResults& View = Views[Index];
+		TArray<double> CPUMilliseconds;
+		TArray<double> GPUMilliseconds;
+		uint64 ViewAllocations = 0;
+		int32 ViewContextCreations = 0;
+		int32 ReprojectedFrames = 0;
+		for (const NSSReplayFrameResult& Frame : View.Frames)
+		{
+			CPUMilliseconds.Add(Frame.CPUMilliseconds);
+			if (Frame.GPUMilliseconds.IsSet())
+			{
+				GPUMilliseconds.Add(Frame.GPUMilliseconds.GetValue());
+			}
+			ViewAllocations += Frame.Allocations.GetTotal();
+			ViewContextCreations += Frame.ContextCreations;
+			ReprojectedFrames += Frame.bReprojected ? 1 : 0;
+		}
+		Allocations += ViewAllocations;
+		ContextCreations += ViewContextCreations;
+		ViewsJson += FString::Printf(TEXT("\t\t{\"sequence\": \"%s\", \"cpuMs\": %s, \"gpuMs\": %s, "
+										  "\"allocations\": %llu, \"contextCreations\": %d, "
+										  "\"reprojectedFrames\": %d}%s\n"),
+			*View.SequenceName.ReplaceCharWithEscapedChar(),
+			*SummaryToJson(Summarise(CPUMilliseconds)),
+			GPUMilliseconds.Num() > 0 ? *SummaryToJson(Summarise(GPUMilliseconds)) : TEXT("null"),
+			ViewAllocations,
+			ViewContextCreations,
+			ReprojectedFrames,
+			Index + 1 < Views.Num() ? TEXT(",") : TEXT(""));
+	}
+
+	FString Json = TEXT("{\n");
+	Json += FString::Printf(
+		TEXT("\t\"backend\": \"%s\",\n"), Views.Num() > 0 ? *Views[0].BackendName : TEXT("Unsupported"));
+	Json += FString::Printf(TEXT("\t\"views\": %d,\n"), Views.Num());
+	Json += FString::Printf(TEXT("\t\"parallel\": %s,\n"), bParallel ? TEXT("true") : TEXT("false"));
+	Json += FString::Printf(TEXT("\t\"batched\": %s,\n"), bBatched ? TEXT("true") : TEXT("false"));
+	Json += FString::Printf(TEXT("\t\"crossEyeReuse\": %s,\n"), bCrossEyeReuse ? TEXT("true") : TEXT("false"));
+	Json += FString::Printf(TEXT("\t\"frames\": %d,\n"), FrameMilliseconds.Num());
+	Json += FString::Printf(TEXT("\t\"frameMs\": %s,\n"), *SummaryToJson(Summarise(FrameMilliseconds)));
+	Json += FString::Printf(TEXT("\t\"allocations\": %llu,\n"), Allocations);
+	Json += FString::Printf(TEXT("\t\"contextCreations\": %d,\n"), ContextCreations);
+	Json += TEXT("\t\"perView\": [\n");
+	Json += ViewsJson;
+	Json += TEXT("\t]\n");
+	Json += TEXT("}\n");
+	return Json;
+}
+
+//-------------------------------------------------------------------------------------
+// NSSReplayer
+//-------------------------------------------------------------------------------------
+NSSReplayer::NSSReplayer(const NSS& InUpscaler, INGSharedBackend& InBackend, EFFXBackendAPI InApi, uint32 InViewID)
+	: Upscaler(InUpscaler), Backend(InBackend), Api(InApi), ViewID(InViewID)
+{
+	FMemory::Memzero(PendingParams);
+}
+
+NSSReplayer::~NSSReplayer()
+{
+	// Returns the state to the context cache.
+	History.SafeRelease();
+}
+
+NSSReplayResults NSSReplayer::Replay(const NSSReplaySequence& Sequence, int32 WarmupFrames, int32 Loops)
+{
+	NSSReplayResults Results;
+	Results.SequenceName = Sequence.Name;
+	Results.BackendName = GetBackendName(Api);
+	Results.Frames.Reserve(Sequence.Frames.Num() * Loops);
+	const FIntPoint MaxInputSize = Sequence.GetMaxInputSize();
+	for (int32 Index = 0; Index < FMath::Min(WarmupFrames, Sequence.Frames.Num()); Index++)
+	{
+		ReplayFrame(Sequence.Frames[Index], MaxInputSize);
+	}
+	for (int32 Loop = 0; Loop < Loops; Loop++)
+	{
+		for (const NSSReplayFrame& Frame : Sequence.Frames)
+		{
+			NSSReplayFrameResult Result = ReplayFrame(Frame, MaxInputSize);
+			Result.Frame = Results.Frames.Num();
+			Results.Frames.Add(Result);
+		}
+	}
+	return Results;
+}
+
+NSSReplayFrameResult NSSReplayer::ReplayFrame(const NSSReplayFrame& InFrame, FIntPoint MaxInputSize)
+{
+	NSSReplayFrameResult Result;
+	const double StartSeconds = FPlatformTime::Seconds();
+	TOptional<NSSScopedAllocationCounter> AllocationCounter;
+	if (bCountAllocations)
+	{
+		AllocationCounter.Emplace();
+	}
+	if (!BeginFrame(InFrame, MaxInputSize, Result))
+	{
+		return Result;
+	}
+	Dispatch(Result);
+	if (AllocationCounter.IsSet())
+	{
+		Result.Allocations = AllocationCounter->GetCounts();
+	}
+	Result.CPUMilliseconds = ElapsedMilliseconds(StartSeconds);
+	return Result;
+}
+
+NSSReplayFrameResult NSSReplayer::ReplaySecondaryEyeFrame(const NSSReplayFrame& InFrame,
+	FIntPoint MaxInputSize,
+	const NSSReplayer& Primary,
+	const NSSStereoReplaySettings& Settings)
+{
+	NSSReplayFrameResult Result;
+	const double StartSeconds = FPlatformTime::Seconds();
+	TOptional<NSSScopedAllocationCounter> AllocationCounter;
+	if (bCountAllocations)
+	{
+		AllocationCounter.Emplace();
+	}
+	if (!BeginFrame(InFrame, MaxInputSize, Result))
+	{
+		return Result;
+	}
+
+	// The same choice as NSS::AddPasses, given that the primary eye was upscaled to the same size.
+	const FIntPoint OutputSize(PendingParams.upscaleSize.width, PendingParams.upscaleSize.height);
+	const NSSReference::FImage& PrimaryOutput = Primary.Outputs[Primary.Current];
+	const NSSReference::FImage& PrimaryDepth = Primary.PaddedDepth[Primary.Current];
+	const bool bReproject = Settings.bCrossEyeReuse && Api == EFFXBackendAPI::CPU && !Result.bHistoryReset
+							&& PendingState->FramesReprojected + 1 < Settings.SecondaryEyeInterval
+							&& PrimaryOutput.Size == OutputSize && PrimaryDepth.Size == PaddedDepth[Current].Size;
+	// As in NSS::AddPasses, the first dispatch after reprojected frames resets the context's history.
+	if (!bReproject && PendingState->FramesReprojected > 0)
+	{
+		PendingParams.reset = true;
+		Result.bHistoryReset = true;
+	}
+	PendingState->FramesReprojected = bReproject ? PendingState->FramesReprojected + 1 : 0;
+	if (bReproject)
+	{
+		const double ReprojectStartSeconds = FPlatformTime::Seconds();
+		NSSReference::FStereoReprojectParams ReprojectParams;
+		ReprojectParams.InputSize = InFrame.InputSize;
+		ReprojectParams.OutputSize = InFrame.OutputSize;
+		ReprojectParams.SecondaryClipToPrimaryClip = Settings.SecondaryClipToPrimaryClip;
+		ReprojectParams.DisocclusionThreshold = Settings.DisocclusionThreshold;
+		if (Outputs[Current].Size != OutputSize)
+		{
+			Outputs[Current].Init(OutputSize, 4);
+		}
+		NSSReference::ReprojectStereo(
+			PrimaryOutput, PrimaryDepth, PaddedColor, PaddedDepth[Current], ReprojectParams, Outputs[Current]);
+		Result.bReprojected = true;
+		Result.ReprojectionMilliseconds = ElapsedMilliseconds(ReprojectStartSeconds);
+		PendingState.SafeRelease();
+	}
+	else
+	{
+		Dispatch(Result);
+	}
+	if (AllocationCounter.IsSet())
+	{
+		Result.Allocations = AllocationCounter->GetCounts();
+	}
+	Result.CPUMilliseconds = ElapsedMilliseconds(StartSeconds);
+	return Result;
+}
+
+void NSSReplayer::Dispatch(NSSReplayFrameResult& Result)
+{
+	const double DispatchStartSeconds = FPlatformTime::Seconds();
+	if (Api == EFFXBackendAPI::CPU)
+	{
+		SetCPUImages(PendingParams);
+		const ffxReturnCode_t Code = Backend.ffxDispatch(&PendingState->Nss, &PendingParams.header);
+		check(Code == FFX_OK);
+	}
+	else
+	{
+		ENQUEUE_RENDER_COMMAND(NSSReplayDispatch)(
+			[this, DispatchParams = PendingParams, StateRef = PendingState](
+				FRHICommandListImmediate& RHICmdList) mutable
+			{
+				SetTextures(RHICmdList, DispatchParams);
+				NSSGPUTimer::FStageTimestamps Timestamps;
+				if (TimestampSource)
+				{
+					Timestamps = {TimestampSource->AllocateTimestamp(), TimestampSource->AllocateTimestamp()};
+					TimestampSource->WriteTimestamp(RHICmdList, Timestamps.Begin);
+				}
+				Backend.EnqueueNativeCommands(RHICmdList,
+					[this, DispatchParams, StateRef](FfxCommandList CommandList) mutable
+					{
+						DispatchParams.commandList = CommandList;
+						const ffxReturnCode_t Code = Backend.ffxDispatch(&StateRef->Nss, &DispatchParams.header);
+						check(Code == FFX_OK);
+					});
+				if (TimestampSource)
+				{
+					TimestampSource->WriteTimestamp(RHICmdList, Timestamps.End);
+					// Submitted now, so that the timestamps don't wait for the end of the game's frame.
+					RHICmdList.ImmediateFlush(EImmediateFlushType::DispatchToRHIThread);
+					DispatchTimestamps = Timestamps;
+				}
+			});
+		// Each frame is dispatched before the next one is prepared, as the images are reused.
+		WaitForRenderingThread();
+	}
+	Result.DispatchMilliseconds = ElapsedMilliseconds(DispatchStartSeconds);
+	EndFrame(Result);
+	if (TimestampSource && Api != EFFXBackendAPI::CPU)
+	{
+		const TOptional<double> GPUMilliseconds = ReadTimestamps(DispatchTimestamps);
+		if (GPUMilliseconds.IsSet())
+		{
+			Result.GPUMilliseconds = GPUMilliseconds;
+		}
+	}
+}
+
+TOptional<double> NSSReplayer::ReadTimestamps(const NSSGPUTimer::FStageTimestamps& Timestamps)
+{
+	// Polled from this thread as the GPU gets to the dispatch, like NSSGPUTimer does, so that neither the rendering
+	// thread nor the GPU waits for it. The next frame isn't dispatched meanwhile, so that replayed frames don't pile
+	// up on the GPU in front of the game's.
+	TOptional<double> Milliseconds;
+	const double StartSeconds = FPlatformTime::Seconds();
+	while (true)
+	{
+		ENQUEUE_RENDER_COMMAND(NSSReplayReadTimestamps)(
+			[this, Timestamps, &Milliseconds](FRHICommandListImmediate&)
+			{
+				uint64 BeginMicroseconds = 0;
+				uint64 EndMicroseconds = 0;
+				if (TimestampSource->ReadTimestamp(Timestamps.Begin, BeginMicroseconds)
+					&& TimestampSource->ReadTimestamp(Timestamps.End, EndMicroseconds))
+				{
+					Milliseconds =
+						double(EndMicroseconds - FMath::Min(BeginMicroseconds, EndMicroseconds)) / 1000.0;
+				}
+			});
+		WaitForRenderingThread();
+		if (Milliseconds.IsSet() || ElapsedMilliseconds(StartSeconds) > MaxTimestampWaitMilliseconds)
+		{
+			break;
+		}
+		FPlatformProcess::Sleep(0.001f);
+	}
+	ENQUEUE_RENDER_COMMAND(NSSReplayReleaseTimestamps)(
+		[this, Timestamps](FRHICommandListImmediate&)
+		{
+			TimestampSource->ReleaseTimestamp(Timestamps.Begin);
+			TimestampSource->ReleaseTimestamp(Timestamps.End);
+		});
+	WaitForRenderingThread();
+	return Milliseconds;
+}
+
+bool NSSReplayer::BeginFrame(const NSSReplayFrame& InFrame, FIntPoint MaxInputSize, NSSReplayFrameResult& OutResult)
+{
+	FrameNumber++;
+	PendingState.SafeRelease();
+
+	// The sizes and state are chosen as NSS::AddPasses does.
+	const bool bDynamicResolutionContext = CVarNSSDynamicResolution.GetValueOnAnyThread() != 0;
+	const float UpscaleRatio = float(InFrame.OutputSize.X) / float(FMath::Max(InFrame.InputSize.X, 1));
+	const NSSContextSizes FrameSizes = bDynamicResolutionContext
+										   ? GetNssDynamicResolutionFrameSizes(InFrame.InputSize, InFrame.OutputSize)
+										   : GetNssContextSizes(InFrame.InputSize, UpscaleRatio);
+	NSSHistory* PrevHistory = History.IsValid() && History->GetState().IsValid() ? History.GetReference() : nullptr;
+	NSSContextSizes ContextSizes = FrameSizes;
+	if (bDynamicResolutionContext)
+	{
+		const NSSContextSizes TargetSizes = GetNssDynamicResolutionContextSizes(
+			MaxInputSize, InFrame.OutputSize, Upscaler.GetMinUpsampleResolutionFraction());
+		NSSDynamicResolutionSettings Settings;
+		Settings.Headroom = CVarNSSDynamicResolutionHeadroom.GetValueOnAnyThread();
+		Settings.ResizeDelayFrames = CVarNSSDynamicResolutionResizeDelayFrames.GetValueOnAnyThread();
+		NSSState* HistoryState = PrevHistory ? PrevHistory->GetState().GetReference() : nullptr;
+		int32 FramesOutOfBounds = HistoryState ? HistoryState->FramesOutOfBounds : 0;
+		ContextSizes = UpdateNssDynamicResolutionContextSizes(
+			HistoryState ? GetNssContextSizes(HistoryState->Params) : NSSContextSizes(),
+			FrameSizes,
+			TargetSizes,
+			Settings,
+			FramesOutOfBounds);
+		if (HistoryState)
+		{
+			HistoryState->FramesOutOfBounds = FramesOutOfBounds;
+		}
+	}
+	if (InFrame.bPrepared && InFrame.Color.Size != FrameSizes.PaddedInputSize)
+	{
+		UE_LOG(LogNSS,
+			Error,
+			TEXT("Replay frame %llu was prepared at %dx%d rather than %dx%d"),
+			FrameNumber,
+			InFrame.Color.Size.X,
+			InFrame.Color.Size.Y,
+			FrameSizes.PaddedInputSize.X,
+			FrameSizes.PaddedInputSize.Y);
+		return false;
+	}
+	bool bHistoryValid = PrevHistory && !InFrame.bCameraCut;
+	bool bCreated = false;
+	NSSStateRef State =
+		Upscaler.AcquireState(ContextSizes, PrevHistory, ViewID, FrameNumber, bHistoryValid, &bCreated);
+	if (!State)
+	{
+		UE_LOG(LogNSS, Error, TEXT("Replay frame %llu couldn't create a context"), FrameNumber);
+		return false;
+	}
+	History = new NSSHistory(State, const_cast<NSS*>(&Upscaler));
+	OutResult.ContextCreations = bCreated ? 1 : 0;
+	OutResult.bHistoryReset = !bHistoryValid;
+
+	// The fused input preparation pass, on the CPU, unless the frame was captured after it.
+	const double PrepareStartSeconds = FPlatformTime::Seconds();
+	Current = 1 - Current;
+	if (InFrame.bPrepared)
+	{
+		PaddedColor = InFrame.Color;
+		MotionVectors = InFrame.Velocity;
+		if (InFrame.Depth.Channels > 0)
+		{
+			PaddedDepth[Current] = InFrame.Depth;
+		}
+		else if (PaddedDepth[Current].Size != InFrame.Color.Size)
+		{
+			// The scene depth handed to NSS directly isn't captured.
+			PaddedDepth[Current].Init(InFrame.Color.Size, 1);
+		}
+	}
+	else
+	{
+		NSSReference::FPrepareInputsParams PrepareParams;
+		PrepareParams.InputViewRect = FIntRect(FIntPoint::ZeroValue, InFrame.InputSize);
+		PrepareParams.PaddedSize = FrameSizes.PaddedInputSize;
+		PrepareParams.ClipToPrevClip = InFrame.ClipToPrevClip;
+		NSSReference::PrepareInputs(InFrame.Color,
+			InFrame.Depth,
+			InFrame.Velocity,
+			PrepareParams,
+			PaddedColor,
+			PaddedDepth[Current],
+			MotionVectors);
+	}
+	OutResult.InputPreparationMilliseconds = ElapsedMilliseconds(PrepareStartSeconds);
+
+	if (TileSettings.IsSet())
+	{
+		// As r.NSS.SparseTiles, against the previous frame's tiles unless the history was reset.
+		const double ClassifyStartSeconds = FPlatformTime::Seconds();
+		NSSReference::FTileClassification& Tiles = TileClassifications[Current];
+		NSSReference::ClassifyTiles(PaddedColor,
+			PaddedDepth[Current],
+			MotionVectors,
+			bHistoryValid ? &TileClassifications[1 - Current].Features : nullptr,
+			TileSettings->Params,
+			Tiles);
+		OutResult.Tiles = Tiles.NumTiles.X * Tiles.NumTiles.Y;
+		OutResult.ChangedTiles = Tiles.NumChanged;
+		OutResult.ActiveTiles = Tiles.NumActive;
+		OutResult.TileClassificationMilliseconds = ElapsedMilliseconds(ClassifyStartSeconds);
+	}
+
+	NSSDispatchFrameParams DispatchFrame;
+	DispatchFrame.PaddedInputSize = FrameSizes.PaddedInputSize;
+	DispatchFrame.PaddedOutputSize = FrameSizes.PaddedOutputSize;
+	DispatchFrame.JitterPixels = InFrame.JitterPixels;
+	DispatchFrame.bReset = !bHistoryValid;
+	DispatchFrame.FrameTimeDeltaSeconds = InFrame.FrameTimeDeltaSeconds;
+	DispatchFrame.FovAngleVertical = InFrame.FovAngleVertical;
+	DispatchFrame.NearPlane = InFrame.NearPlane;
+	PendingParams = NSS::MakeDispatchParams(DispatchFrame);
+	PendingParams.exposure = InFrame.PreExposure;
+	PendingState = MoveTemp(State);
+	return true;
+}
+
+void NSSReplayer::EndFrame(NSSReplayFrameResult& Result)
+{
+	if (TileSettings.IsSet() && TileSettings->bCompose && Api == EFFXBackendAPI::CPU && !Result.bHistoryReset
+		&& Outputs[1 - Current].Size == Outputs[Current].Size)
+	{
+		NSSReference::ComposeTiles(TileClassifications[Current],
+			TileSettings->Params.TileSize,
+			PaddedColor.Size,
+			Outputs[1 - Current],
+			Outputs[Current]);
+	}
+	NGSharedDispatchTimings DispatchTimings;
+	if (Backend.GetDispatchTimings(&PendingState->Nss, DispatchTimings))
+	{
+		Result.GPUMilliseconds = double(DispatchTimings.InputPreparationMicroseconds
+										+ DispatchTimings.InferenceMicroseconds
+										+ DispatchTimings.OutputResolveMicroseconds)
+								 / 1000.0;
+	}
+	PendingState.SafeRelease();
+}
+
+void NSSReplayer::SetTileSettings(const NSSReplayTileSettings& Settings)
+{
+	TileSettings = Settings;
+}
+
+void NSSReplayer::SetCountAllocations(bool bInCountAllocations)
+{
+	bCountAllocations = bInCountAllocations;
+}
+
+void NSSReplayer::SetGPUTimestampSource(INSSGPUTimestampSource* Source)
+{
+	TimestampSource = Source;
+}
+
+void NSSReplayer::DispatchBatch(TConstArrayView<NSSReplayer*> Replayers, TArrayView<NSSReplayFrameResult> Results)
+{
+	check(Replayers.Num() == Results.Num());
+	if (Replayers.Num() == 0)
+	{
+		return;
+	}
+	INGSharedBackend& BatchBackend = Replayers[0]->Backend;
+	const double DispatchStartSeconds = FPlatformTime::Seconds();
+	if (Replayers[0]->Api == EFFXBackendAPI::CPU)
+	{
+		TArray<NGSharedBatchedDispatch, TInlineAllocator<8>> Dispatches;
+		for (NSSReplayer* Replayer : Replayers)
+		{
+			check(&Replayer->Backend == &BatchBackend);
+			Replayer->SetCPUImages(Replayer->PendingParams);
+			Dispatches.Add({&Replayer->PendingState->Nss, &Replayer->PendingParams.header});
+		}
+		const ffxReturnCode_t Code = BatchBackend.ffxDispatchBatch(Dispatches);
+		check(Code == FFX_OK);
+	}
+	else
+	{
+		TArray<NSSReplayer*> BatchReplayers(Replayers);
+		ENQUEUE_RENDER_COMMAND(NSSReplayDispatchBatch)(
+			[&BatchBackend, BatchReplayers = MoveTemp(BatchReplayers)](FRHICommandListImmediate& RHICmdList)
+			{
+				// The views' inputs are uploaded and transitioned first, so that one native command records them all.
+				for (NSSReplayer* Replayer : BatchReplayers)
+				{
+					Replayer->SetTextures(RHICmdList, Replayer->PendingParams);
+				}
+				BatchBackend.EnqueueNativeCommands(RHICmdList,
+					[&BatchBackend, BatchReplayers](FfxCommandList CommandList)
+					{
+						TArray<NGSharedBatchedDispatch, TInlineAllocator<8>> Dispatches;
+						for (NSSReplayer* Replayer : BatchReplayers)
+						{
+							Replayer->PendingParams.commandList = CommandList;
+							Dispatches.Add({&Replayer->PendingState->Nss, &Replayer->PendingParams.header});
+						}
+						const ffxReturnCode_t Code = BatchBackend.ffxDispatchBatch(Dispatches);
+						check(Code == FFX_OK);
+					});
+			});
+		WaitForRenderingThread();
+	}
+	// The batch is timed as a whole, and reported as the dispatch time of each of its views.
+	const double DispatchMilliseconds = ElapsedMilliseconds(DispatchStartSeconds);
+	for (int32 Index = 0; Index < Replayers.Num(); Index++)
+	{
+		Results[Index].DispatchMilliseconds = DispatchMilliseconds;
+		Results[Index].CPUMilliseconds += DispatchMilliseconds;
+		Replayers[Index]->EndFrame(Results[Index]);
+	}
+}
+
+void NSSReplayer::SetCPUImages(ffxApiDispatchDescNss& DispatchParams)
+{
+	const FIntPoint OutputSize(DispatchParams.upscaleSize.width, DispatchParams.upscaleSize.height);
+	if (Outputs[Current].Size != OutputSize)
+	{
+		Outputs[Current].Init(OutputSize, 4);
+	}
+	DispatchParams.color = NGCPUBackendModule::GetImageResource(PaddedColor, FFX_API_RESOURCE_STATE_COMPUTE_READ);
+	DispatchParams.depth =
+		NGCPUBackendModule::GetImageResource(PaddedDepth[Current], FFX_API_RESOURCE_STATE_COMPUTE_READ);
+	DispatchParams.depthTm1 =
+		NGCPUBackendModule::GetImageResource(PaddedDepth[1 - Current], FFX_API_RESOURCE_STATE_COMPUTE_READ);
+	DispatchParams.motionVectors =
+		NGCPUBackendModule::GetImageResource(MotionVectors, FFX_API_RESOURCE_STATE_COMPUTE_READ);
+	DispatchParams.outputTm1 =
+		NGCPUBackendModule::GetImageResource(Outputs[1 - Current], FFX_API_RESOURCE_STATE_COMPUTE_READ);
+	DispatchParams.output =
+		NGCPUBackendModule::GetImageResource(Outputs[Current], FFX_API_RESOURCE_STATE_UNORDERED_ACCESS);
+}
+
+void NSSReplayer::SetTextures(FRHICommandListImmediate& RHICmdList, ffxApiDispatchDescNss& DispatchParams)
+{
+	const FIntPoint OutputSize(DispatchParams.upscaleSize.width, DispatchParams.upscaleSize.height);
+	UploadImage(RHICmdList, ColorTexture, PaddedColor, TEXT("NSSReplayColor"));
+	UploadImage(RHICmdList, DepthTextures[Current], PaddedDepth[Current], TEXT("NSSReplayDepth"));
+	UploadImage(RHICmdList, MotionVectorTexture, MotionVectors, TEXT("NSSReplayMotionVectors"));
+	// Sized for the context like NSS::AddPasses's output, with the frame's at its origin.
+	const FIntPoint OutputExtent = GetNssContextSizes(PendingState->Params).PaddedOutputSize.ComponentMax(OutputSize);
+	for (FTextureRHIRef& Texture : OutputTextures)
+	{
+		EnsureTexture(RHICmdList, Texture, OutputExtent, 4, TEXT("NSSReplayOutput"), ETextureCreateFlags::UAV);
+	}
+	// The previous depth doesn't exist yet on the first frame, which is a reset anyway.
+	FRHITexture* DepthTm1 = DepthTextures[1 - Current].IsValid() ? DepthTextures[1 - Current].GetReference()
+																  : DepthTextures[Current].GetReference();
+	DispatchParams.color = Backend.GetNativeResource(ColorTexture, FFX_API_RESOURCE_STATE_COMPUTE_READ);
+	DispatchParams.depth = Backend.GetNativeResource(DepthTextures[Current], FFX_API_RESOURCE_STATE_COMPUTE_READ);
+	DispatchParams.depthTm1 = Backend.GetNativeResource(DepthTm1, FFX_API_RESOURCE_STATE_COMPUTE_READ);
+	DispatchParams.motionVectors = Backend.GetNativeResource(MotionVectorTexture, FFX_API_RESOURCE_STATE_COMPUTE_READ);
+	DispatchParams.outputTm1 =
+		Backend.GetNativeResource(OutputTextures[1 - Current], FFX_API_RESOURCE_STATE_COMPUTE_READ);
+	DispatchParams.output =
+		Backend.GetNativeResource(OutputTextures[Current], FFX_API_RESOURCE_STATE_UNORDERED_ACCESS);
+	Backend.ForceUAVTransition(RHICmdList, OutputTextures[Current], ERHIAccess::UAVMask);
+}
+
+//-------------------------------------------------------------------------------------
+// Several views
+//-------------------------------------------------------------------------------------
+NSSMultiViewReplayResults ReplayNSSViews(const NSS& Upscaler,
+	INGSharedBackend& Backend,
+	EFFXBackendAPI Api,
+	TConstArrayView<NSSReplaySequence> Sequences,
+	int32 WarmupFrames,
+	int32 Loops,
+	bool bParallel,
+	bool bBatched)
+{
+	NSSMultiViewReplayResults Results;
+	// A GPU backend's dispatches are flushed through the rendering thread one at a time.
+	Results.bParallel = bParallel && Api == EFFXBackendAPI::CPU;
+	Results.bBatched = bBatched;
+	if (bParallel && !Results.bParallel)
+	{
+		UE_LOG(LogNSS, Warning, TEXT("Only the CPU backend replays views in parallel"));
+	}
+
+	TArray<TUniquePtr<NSSReplayer>> Replayers;
+	TArray<FIntPoint> MaxInputSizes;
+	int32 NumFrames = 0;
+	for (int32 Index = 0; Index < Sequences.Num(); Index++)
+	{
+		Replayers.Add(MakeUnique<NSSReplayer>(Upscaler, Backend, Api, NSSReplayer::ReplayViewID + uint32(Index)));
+		Replayers.Last()->SetCountAllocations(true);
+		MaxInputSizes.Add(Sequences[Index].GetMaxInputSize());
+		NumFrames = FMath::Max(NumFrames, Sequences[Index].Frames.Num());
+		NSSReplayResults& View = Results.Views.AddDefaulted_GetRef();
+		View.SequenceName = Sequences[Index].Name;
+		View.BackendName = GetBackendName(Api);
+	}
+	for (NSSReplayResults& View : Results.Views)
+	{
+		View.Frames.Reserve(NumFrames * Loops);
+	}
+	Results.FrameMilliseconds.Reserve(NumFrames * Loops);
+
+	// The result of each view in the current frame, and whether its frame is waiting for the batch.
+	TArray<NSSReplayFrameResult> FrameResults;
+	FrameResults.SetNum(Sequences.Num());
+	TArray<bool> Begun;
+	Begun.SetNum(Sequences.Num());
+	TArray<NSSReplayer*> BatchReplayers;
+	TArray<NSSReplayFrameResult> BatchResults;
+
+	// Shorter sequences loop until the longest one is done.
+	auto ReplayViewsFrame = [&](int32 Frame, bool bRecord)
+	{
+		const double StartSeconds = FPlatformTime::Seconds();
+		ParallelFor(
+			Sequences.Num(),
+			[&](int32 Index)
+			{
+				const NSSReplaySequence& Sequence = Sequences[Index];
+				FrameResults[Index] = NSSReplayFrameResult();
+				Begun[Index] = false;
+				if (Sequence.Frames.Num() == 0)
+				{
+					return;
+				}
+				const NSSReplayFrame& ViewFrame = Sequence.Frames[Frame % Sequence.Frames.Num()];
+				if (!bBatched)
+				{
+					FrameResults[Index] = Replayers[Index]->ReplayFrame(ViewFrame, MaxInputSizes[Index]);
+					return;
+				}
+				// Only the preparation is counted for each view of a batch.
+				const double BeginStartSeconds = FPlatformTime::Seconds();
+				NSSScopedAllocationCounter AllocationCounter;
+				Begun[Index] = Replayers[Index]->BeginFrame(ViewFrame, MaxInputSizes[Index], FrameResults[Index]);
+				FrameResults[Index].Allocations = AllocationCounter.GetCounts();
+				FrameResults[Index].CPUMilliseconds = ElapsedMilliseconds(BeginStartSeconds);
+			},
+			Results.bParallel ? EParallelForFlags::Unbalanced : EParallelForFlags::ForceSingleThread);
+
+		if (bBatched)
+		{
+			BatchReplayers.Reset();
+			BatchResults.Reset();
+			for (int32 Index = 0; Index < Sequences.Num(); Index++)
+			{
+				if (Begun[Index])
+				{
+					BatchReplayers.Add(Replayers[Index].Get());
+					BatchResults.Add(FrameResults[Index]);
+				}
+			}
+			NSSReplayer::DispatchBatch(BatchReplayers, BatchResults);
+			for (int32 Index = 0, BatchIndex = 0; Index < Sequences.Num(); Index++)
+			{
+				if (Begun[Index])
+				{
+					FrameResults[Index] = BatchResults[BatchIndex++];
+				}
+			}
+		}
+
+		if (bRecord)
+		{
+			Results.FrameMilliseconds.Add(ElapsedMilliseconds(StartSeconds));
+			for (int32 Index = 0; Index < Sequences.Num(); Index++)
+			{
+				if (Sequences[Index].Frames.Num() > 0)
+				{
+					FrameResults[Index].Frame = Results.Views[Index].Frames.Num();
+					Results.Views[Index].Frames.Add(FrameResults[Index]);
+				}
+			}
+		}
+	};
+	for (int32 Frame = 0; Frame < FMath::Min(WarmupFrames, NumFrames); Frame++)
+	{
+		ReplayViewsFrame(Frame, false);
+	}
+	for (int32 Loop = 0; Loop < Loops; Loop++)
+	{
+		for (int32 Frame = 0; Frame < NumFrames; Frame++)
+		{
+			ReplayViewsFrame(Frame, true);
+		}
+	}
+	return Results;
+}
+
+NSSMultiViewReplayResults ReplayNSSStereo(const NSS& Upscaler,
+	INGSharedBackend& Backend,
+	EFFXBackendAPI Api,
+	const NSSReplaySequence& PrimaryEye,
+	const NSSReplaySequence& SecondaryEye,
+	const NSSStereoReplaySettings& Settings,
+	int32 WarmupFrames,
+	int32 Loops)
+{
+	NSSMultiViewReplayResults Results;
+	Results.bCrossEyeReuse = Settings.bCrossEyeReuse && Api == EFFXBackendAPI::CPU;
+	if (Settings.bCrossEyeReuse && !Results.bCrossEyeReuse)
+	{
+		UE_LOG(LogNSS, Warning, TEXT("Only the CPU backend replays cross-eye reuse, both eyes are dispatched"));
+	}
+	NSSReplayer Primary(Upscaler, Backend, Api, NSSReplayer::ReplayViewID);
+	NSSReplayer Secondary(Upscaler, Backend, Api, NSSReplayer::ReplayViewID + 1);
+	Primary.SetCountAllocations(true);
+	Secondary.SetCountAllocations(true);
+	const FIntPoint PrimaryMaxInputSize = PrimaryEye.GetMaxInputSize();
+	const FIntPoint SecondaryMaxInputSize = SecondaryEye.GetMaxInputSize();
+	const int32 NumFrames = FMath::Min(PrimaryEye.Frames.Num(), SecondaryEye.Frames.Num());
+	for (const NSSReplaySequence* Sequence : {&PrimaryEye, &SecondaryEye})
+	{
+		NSSReplayResults& View = Results.Views.AddDefaulted_GetRef();
+		View.SequenceName = Sequence->Name;
+		View.BackendName = GetBackendName(Api);
+		View.Frames.Reserve(NumFrames * Loops);
+	}
+	Results.FrameMilliseconds.Reserve(NumFrames * Loops);
+
+	auto ReplayStereoFrame = [&](int32 Frame, bool bRecord)
+	{
+		const double StartSeconds = FPlatformTime::Seconds();
+		NSSReplayFrameResult EyeResults[] = {
+			Primary.ReplayFrame(PrimaryEye.Frames[Frame], PrimaryMaxInputSize),
+			Secondary.ReplaySecondaryEyeFrame(SecondaryEye.Frames[Frame], SecondaryMaxInputSize, Primary, Settings),
+		};
+		if (bRecord)
+		{
+			Results.FrameMilliseconds.Add(ElapsedMilliseconds(StartSeconds));
+			for (int32 Eye = 0; Eye < 2; Eye++)
+			{
+				EyeResults[Eye].Frame = Results.Views[Eye].Frames.Num();
+				Results.Views[Eye].Frames.Add(EyeResults[Eye]);
+			}
+		}
+	};
+	for (int32 Frame = 0; Frame < FMath::Min(WarmupFrames, NumFrames); Frame++)
+	{
+		ReplayStereoFrame(Frame, false);
+	}
+	for (int32 Loop = 0; Loop < Loops; Loop++)
+	{
+		for (int32 Frame = 0; Frame < NumFrames; Frame++)
+		{
+			ReplayStereoFrame(Frame, true);
+		}
+	}
+	return Results;
+}
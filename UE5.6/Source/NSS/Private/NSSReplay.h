@@ -0,0 +1,219 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "NGCPUBackend.h"
+#include "NSSAllocationCounter.h"
+#include "NSSCaptureFile.h"
+#include "NSSGPUTimer.h"
+#include "NSSHistory.h"
+#include "NSSReference.h"
+#include "RHIResources.h"
+
+class NSS;
+
+struct NSSReplaySequence
+{
+	FString Name;
+	TArray<NSSReplayFrame> Frames;
+
+	// The largest render resolution of the sequence, which a dynamic resolution context has to fit.
+	FIntPoint GetMaxInputSize() const;
+};
+
+// Reads every frame of a capture file, e.g. one written by r.NSS.Capture.
+bool LoadNSSReplaySequence(const FString& Path, NSSReplaySequence& OutSequence, FString& OutError);
+bool SaveNSSReplaySequence(
+	const FString& Path, const NSSReplaySequence& Sequence, const NSSCaptureSettings& Settings = NSSCaptureSettings());
+
+// A sequence of a pattern panning across the view, with a camera cut every CameraCutInterval frames (0 for none),
+// for when there is no recording to hand. A non-zero EyeOffsetPixels makes the secondary eye of a stereo pair, which
+// sees the pattern that many render pixels further left than the sequence made without it.
+NSSReplaySequence MakeSyntheticNSSReplaySequence(
+	FIntPoint InputSize, FIntPoint OutputSize, int32 NumFrames, int32 CameraCutInterval, float EyeOffsetPixels = 0.0f);
+// The SecondaryClipToPrimaryClip of a synthetic stereo pair.
+FMatrix44f MakeSyntheticNSSStereoClipToPrimaryClip(FIntPoint InputSize, float EyeOffsetPixels);
+
+// The cost of replaying a frame.
+struct NSSReplayFrameResult
+{
+	int32 Frame = 0;
+	// Time the game thread spent on the whole frame, and on the input preparation and dispatch within it.
+	double CPUMilliseconds = 0.0;
+	double InputPreparationMilliseconds = 0.0;
+	double DispatchMilliseconds = 0.0;
+	NSSAllocationCounts Allocations;
+	int32 ContextCreations = 0;
+	bool bHistoryReset = false;
+	// The secondary eye of a stereo pair reprojected from the primary eye's output instead of being dispatched.
+	bool bReprojected = false;
+	double ReprojectionMilliseconds = 0.0;
+	// Tiles of the frame classified as r.NSS.SparseTiles does, 0 unless the replayer classifies them, and those that
+	// changed or are active.
+	int32 Tiles = 0;
+	int32 ChangedTiles = 0;
+	int32 ActiveTiles = 0;
+	double TileClassificationMilliseconds = 0.0;
+	// Reported by backends that time their dispatches on the GPU.
+	TOptional<double> GPUMilliseconds;
+};
+
+struct NSSReplayResults
+{
+	FString SequenceName;
+	FString BackendName;
+	TArray<NSSReplayFrameResult> Frames;
+
+	// Per frame results and a summary, for regression tracking.
+	FString ToJson() const;
+	FString ToCsv() const;
+};
+
+// How the eyes of a stereo pair are replayed, as r.NSS.XR.CrossEyeReuse and the settings that go with it.
+struct NSSStereoReplaySettings
+{
+	bool bCrossEyeReuse = true;
+	int32 SecondaryEyeInterval = 2;
+	float DisocclusionThreshold = 0.01f;
+	// Takes a clip space position of the secondary eye to the primary eye's.
+	FMatrix44f SecondaryClipToPrimaryClip = FMatrix44f::Identity;
+};
+
+// How the tiles of each replayed frame are classified, as r.NSS.SparseTiles and the settings that go with it.
+struct NSSReplayTileSettings
+{
+	NSSReference::FTileClassifyParams Params;
+	// Carry the history forward into the output of the inactive tiles, which needs the outputs as images, so only with
+	// the CPU backend.
+	bool bCompose = false;
+};
+
+// The cost of replaying several views, each frame of every view before the next frame of any.
+struct NSSMultiViewReplayResults
+{
+	// One per view, in the order of the sequences.
+	TArray<NSSReplayResults> Views;
+	// Wall time of each frame of all the views together.
+	TArray<double> FrameMilliseconds;
+	bool bParallel = false;
+	bool bBatched = false;
+	// For a stereo pair, whether the secondary eye reused the primary eye's output.
+	bool bCrossEyeReuse = false;
+
+	// A summary of the frames and of each view, for regression tracking.
+	FString ToJson() const;
+};
+
+//-------------------------------------------------------------------------------------
+// Feeds recorded frames to an upscaler the way NSS::AddPasses does: the frame and context sizes, the state lookup
+// in the context cache, the input preparation and the dispatch. Rendering isn't needed: the inputs are prepared with
+// the CPU reference and dispatched as CPU images to the CPU backend, or uploaded to textures for a GPU backend.
+//-------------------------------------------------------------------------------------
+class NSSReplayer
+{
+public:
+	NSSReplayer(
+		const NSS& InUpscaler, INGSharedBackend& InBackend, EFFXBackendAPI InApi, uint32 InViewID = ReplayViewID);
+	~NSSReplayer();
+
+	// Replays the sequence Loops times, after replaying its first WarmupFrames frames which aren't reported.
+	NSSReplayResults Replay(const NSSReplaySequence& Sequence, int32 WarmupFrames = 0, int32 Loops = 1);
+
+	NSSReplayFrameResult ReplayFrame(const NSSReplayFrame& Frame, FIntPoint MaxInputSize);
+	// ReplayFrame for the secondary eye of a stereo pair, which is reprojected from the output Primary has just
+	// replayed for the same frame instead of being dispatched on the frames NSS::AddPasses would do so. The outputs
+	// are only images with the CPU backend, so other backends always dispatch.
+	NSSReplayFrameResult ReplaySecondaryEyeFrame(const NSSReplayFrame& Frame,
+		FIntPoint MaxInputSize,
+		const NSSReplayer& Primary,
+		const NSSStereoReplaySettings& Settings);
+
+	// ReplayFrame in two steps, so that the dispatches of several views can be batched. BeginFrame chooses the state
+	// and prepares the inputs, returning false if the frame can't be dispatched.
+	bool BeginFrame(const NSSReplayFrame& Frame, FIntPoint MaxInputSize, NSSReplayFrameResult& OutResult);
+	// Dispatches the frames begun by replayers sharing a backend with one ffxDispatchBatch, completing their results.
+	static void DispatchBatch(TConstArrayView<NSSReplayer*> Replayers, TArrayView<NSSReplayFrameResult> Results);
+
+	// Classifies the tiles of the frames replayed from now on, reporting them in their results.
+	void SetTileSettings(const NSSReplayTileSettings& Settings);
+
+	// Counts the heap allocations of each frame replayed from now on, reporting them in their results. The first
+	// counter puts a proxy around GMalloc for the rest of the process, so this is only for the replay commandlet and
+	// the tests, never for replays made while a game runs.
+	void SetCountAllocations(bool bInCountAllocations);
+
+	// Times the frames dispatched on their own to a GPU backend with a pair of timestamps from Source, which are
+	// polled until the GPU has written them before the next frame is replayed. They are reported in place of the
+	// timings of the backend. Source must outlive the replayer, and null stops the timing.
+	void SetGPUTimestampSource(INSSGPUTimestampSource* Source);
+
+	// ViewID the replayed frames are attributed to by default, so that they don't take the contexts of real views.
+	// Replays of several views use the ones following it.
+	static constexpr uint32 ReplayViewID = 0xFFFFFF00u;
+
+private:
+	// Dispatches the frame begun by BeginFrame on its own, then ends it.
+	void Dispatch(NSSReplayFrameResult& Result);
+	void EndFrame(NSSReplayFrameResult& Result);
+	// Reads Timestamps once the GPU has written them, then releases them. Unset if they weren't written in time.
+	TOptional<double> ReadTimestamps(const NSSGPUTimer::FStageTimestamps& Timestamps);
+	// Points DispatchParams at the images for the CPU backend.
+	void SetCPUImages(ffxApiDispatchDescNss& DispatchParams);
+	// Uploads the images to textures for a GPU backend and points DispatchParams at them. Rendering thread.
+	void SetTextures(FRHICommandListImmediate& RHICmdList, ffxApiDispatchDescNss& DispatchParams);
+
+	const NSS& Upscaler;
+	INGSharedBackend& Backend;
+	EFFXBackendAPI Api;
+	uint32 ViewID;
+	TRefCountPtr<NSSHistory> History;
+	uint64 FrameNumber = 0;
+	// The dispatch of the frame begun by BeginFrame.
+	ffxApiDispatchDescNss PendingParams;
+	NSSStateRef PendingState;
+	// Inputs prepared for the network and the outputs, double buffered so that the previous one is the history.
+	NSSReference::FImage PaddedColor;
+	NSSReference::FImage PaddedDepth[2];
+	NSSReference::FImage MotionVectors;
+	NSSReference::FImage Outputs[2];
+	int32 Current = 0;
+	TOptional<NSSReplayTileSettings> TileSettings;
+	bool bCountAllocations = false;
+	INSSGPUTimestampSource* TimestampSource = nullptr;
+	// The timestamps around the last dispatch, written on the rendering thread.
+	NSSGPUTimer::FStageTimestamps DispatchTimestamps;
+	// The tiles of the inputs, double buffered like the depth so that the previous one is compared with.
+	NSSReference::FTileClassification TileClassifications[2];
+	// The textures the images are uploaded to for a GPU backend.
+	FTextureRHIRef ColorTexture;
+	FTextureRHIRef DepthTextures[2];
+	FTextureRHIRef MotionVectorTexture;
+	FTextureRHIRef OutputTextures[2];
+};
+
+// Replays a view per sequence, the way a split screen or stereo frame goes through the upscaler, counting the heap
+// allocations of each view (see NSSReplayer::SetCountAllocations). With bParallel the views of a frame are replayed
+// concurrently, as views added on different graph builders would be, which only the CPU backend supports: a GPU
+// backend replays them one after the other. With bBatched the views' inputs are prepared first and all of a frame's
+// views are then dispatched together, against one dispatch per view otherwise.
+NSSMultiViewReplayResults ReplayNSSViews(const NSS& Upscaler,
+	INGSharedBackend& Backend,
+	EFFXBackendAPI Api,
+	TConstArrayView<NSSReplaySequence> Sequences,
+	int32 WarmupFrames,
+	int32 Loops,
+	bool bParallel,
+	bool bBatched = false);
+
+// Replays the two eyes of a stereo pair, the primary eye before the secondary eye on every frame as the renderer
+// upscales them, and reports the cost of each eye, allocations included.
+NSSMultiViewReplayResults ReplayNSSStereo(const NSS& Upscaler,
+	INGSharedBackend& Backend,
+	EFFXBackendAPI Api,
+	const NSSReplaySequence& PrimaryEye,
+	const NSSReplaySequence& SecondaryEye,
+	const NSSStereoReplaySettings& Settings,
+	int32 WarmupFrames,
+	int32 Loops);
@@ -0,0 +1,285 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#include "NSSReplayCommandlet.h"
+
+#include "LogNSS.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "NGSettings.h"
+#include "NGSharedTrace.h"
+#include "NSS.h"
+#include "NSSModule.h"
+#include "NSSReplay.h"
+
+namespace
+{
+	FIntPoint ParseSize(const FString& Params, const TCHAR* Name, FIntPoint Default)
+	{
+		FString Value;
+		FString X;
+		FString Y;
+		if (FParse::Value(*Params, Name, Value) && Value.Split(TEXT("x"), &X, &Y))
+		{
+			return FIntPoint(FCString::Atoi(*X), FCString::Atoi(*Y));
+		}
+		return Default;
+	}
+
+	bool SaveResults(const FString& Contents, const FString& Path)
+	{
+		if (!FFileHelper::SaveStringToFile(Contents, *Path))
+		{
+			UE_LOG(LogNSS, Error, TEXT("Couldn't write '%s'"), *Path);
+			return false;
+		}
+		UE_LOG(LogNSS, Display, TEXT("Wrote '%s'"), *Path);
+		return true;
+	}
+
+	// Commandlets run before OnPostEngineInit, so the upscaler the view extension would create may not exist yet.
+	NSS* InitializeUpscaler()
+	{
+		NSSModule& NSSModuleInstance = FModuleManager::LoadModuleChecked<NSSModule>(TEXT("NSS"));
+		if (!NSSModuleInstance.GetNSSUpscaler())
+		{
+			NSSModuleInstance.SetTemporalUpscaler(MakeShared<NSS, ESPMode::ThreadSafe>());
+		}
+		NSS* Upscaler = NSSModuleInstance.GetNSSUpscaler();
+		Upscaler->Initialize();
+		if (!Upscaler->IsApiSupported())
+		{
+			UE_LOG(LogNSS, Error, TEXT("NSS isn't supported here, try -nullrhi to use the CPU backend"));
+			return nullptr;
+		}
+		return Upscaler;
+	}
+
+	// Re-issues the ffx calls of a trace recorded with r.NSS.Trace.Start against the backend in use.
+	int32 ReplayTrace(const FString& TracePath, const FString& Params)
+	{
+		NGSharedTraceFile Trace;
+		FString Error;
+		if (!LoadNGSharedTrace(TracePath, Trace, Error))
+		{
+			UE_LOG(LogNSS, Error, TEXT("%s"), *Error);
+			return 1;
+		}
+		NSS* Upscaler = InitializeUpscaler();
+		if (!Upscaler)
+		{
+			return 1;
+		}
+		NGSharedTraceReplayer Replayer(*Upscaler->GetBackend());
+		const NGSharedTraceReplayResults Results =
+			Replayer.Replay(Trace, FParse::Param(*Params, TEXT("PreserveTiming")));
+		UE_LOG(LogNSS,
+			Display,
+			TEXT("Replayed %d calls of '%s' in %.3fs, %d returned differently than when recorded"),
+			Trace.Events.Num(),
+			*TracePath,
+			Results.WallSeconds,
+			Results.Mismatches);
+		FString JsonPath = FPaths::Combine(
+			FPaths::ProjectSavedDir(), TEXT("NSSReplay"), FPaths::GetBaseFilename(TracePath) + TEXT(".json"));
+		FParse::Value(*Params, TEXT("Json="), JsonPath);
+		return SaveResults(Results.ToJson(), JsonPath) ? 0 : 1;
+	}
+}
+
+UNSSReplayCommandlet::UNSSReplayCommandlet()
+{
+	IsClient = false;
+	IsEditor = false;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UNSSReplayCommandlet::Main(const FString& Params)
+{
+	FString TracePath;
+	if (FParse::Value(*Params, TEXT("Trace="), TracePath))
+	{
+		return ReplayTrace(TracePath, Params);
+	}
+
+	int32 NumViews = 1;
+	FParse::Value(*Params, TEXT("Views="), NumViews);
+	NumViews = FMath::Max(NumViews, 1);
+	// The sequence of each view after the first, if there are several.
+	TArray<NSSReplaySequence> OtherViews;
+	const bool bStereo = FParse::Param(*Params, TEXT("Stereo"));
+	float EyeOffsetPixels = 8.0f;
+	FParse::Value(*Params, TEXT("EyeOffset="), EyeOffsetPixels);
+	NSSReplaySequence SecondaryEye;
+	NSSReplaySequence Sequence;
+	FString SequencePath;
+	if (FParse::Value(*Params, TEXT("Sequence="), SequencePath))
+	{
+		FString Error;
+		if (!LoadNSSReplaySequence(SequencePath, Sequence, Error))
+		{
+			UE_LOG(LogNSS, Error, TEXT("%s"), *Error);
+			return 1;
+		}
+	}
+	else if (FParse::Param(*Params, TEXT("Synthetic")))
+	{
+		int32 NumFrames = 120;
+		int32 CameraCutInterval = 0;
+		FParse::Value(*Params, TEXT("Frames="), NumFrames);
+		FParse::Value(*Params, TEXT("CameraCutInterval="), CameraCutInterval);
+		const FIntPoint InputSize = ParseSize(Params, TEXT("InputSize="), FIntPoint(540, 360));
+		const FIntPoint OutputSize = ParseSize(Params, TEXT("OutputSize="), FIntPoint(1080, 720));
+		Sequence = MakeSyntheticNSSReplaySequence(InputSize, OutputSize, NumFrames, CameraCutInterval);
+		if (bStereo)
+		{
+			SecondaryEye =
+				MakeSyntheticNSSReplaySequence(InputSize, OutputSize, NumFrames, CameraCutInterval, EyeOffsetPixels);
+		}
+		// Every other view is half the size, so that the views don't fit each other's contexts and resources.
+		for (int32 View = 1; View < NumViews; View++)
+		{
+			OtherViews.Add(View % 2 == 0 ? Sequence
+										 : MakeSyntheticNSSReplaySequence(
+											   InputSize / 2, OutputSize / 2, NumFrames, CameraCutInterval));
+		}
+	}
+	else
+	{
+		UE_LOG(LogNSS, Error, TEXT("Pass -Sequence=<file>, -Synthetic or -Trace=<file>"));
+		return 1;
+	}
+	if (Sequence.Frames.Num() == 0)
+	{
+		UE_LOG(LogNSS, Error, TEXT("Sequence '%s' has no frames"), *Sequence.Name);
+		return 1;
+	}
+
+	NSS* Upscaler = InitializeUpscaler();
+	if (!Upscaler)
+	{
+		return 1;
+	}
+
+	int32 WarmupFrames = 0;
+	int32 Loops = 1;
+	FParse::Value(*Params, TEXT("Warmup="), WarmupFrames);
+	FParse::Value(*Params, TEXT("Loops="), Loops);
+	const FString DefaultPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("NSSReplay"), Sequence.Name);
+	if (bStereo)
+	{
+		// A recorded sequence is replayed by both eyes, as if they coincided.
+		NSSStereoReplaySettings Settings;
+		Settings.bCrossEyeReuse =
+			FParse::Param(*Params, TEXT("CrossEyeReuse")) || CVarNSSXRCrossEyeReuse.GetValueOnAnyThread() != 0;
+		Settings.SecondaryEyeInterval = CVarNSSXRSecondaryEyeInterval.GetValueOnAnyThread();
+		FParse::Value(*Params, TEXT("SecondaryEyeInterval="), Settings.SecondaryEyeInterval);
+		Settings.DisocclusionThreshold = CVarNSSXRDisocclusionThreshold.GetValueOnAnyThread();
+		if (SecondaryEye.Frames.Num() > 0)
+		{
+			Settings.SecondaryClipToPrimaryClip =
+				MakeSyntheticNSSStereoClipToPrimaryClip(Sequence.Frames[0].InputSize, EyeOffsetPixels);
+		}
+		const NSSMultiViewReplayResults StereoResults = ReplayNSSStereo(*Upscaler,
+			*Upscaler->GetBackend(),
+			Upscaler->GetApi(),
+			Sequence,
+			SecondaryEye.Frames.Num() > 0 ? SecondaryEye : Sequence,
+			Settings,
+			WarmupFrames,
+			FMath::Max(Loops, 1));
+		FString JsonPath = DefaultPath + TEXT("_Stereo.json");
+		FParse::Value(*Params, TEXT("Json="), JsonPath);
+		UE_LOG(LogNSS,
+			Display,
+			TEXT("Replayed %d stereo frames of '%s'%s"),
+			StereoResults.FrameMilliseconds.Num(),
+			*Sequence.Name,
+			StereoResults.bCrossEyeReuse ? TEXT(" with cross-eye reuse") : TEXT(""));
+		return SaveResults(StereoResults.ToJson(), JsonPath) ? 0 : 1;
+	}
+	if (NumViews > 1)
+	{
+		TArray<NSSReplaySequence> Sequences;
+		Sequences.Add(Sequence);
+		for (int32 View = 1; View < NumViews; View++)
+		{
+			// A recorded sequence is replayed by every view.
+			Sequences.Add(OtherViews.IsValidIndex(View - 1) ? OtherViews[View - 1] : Sequence);
+		}
+		const NSSMultiViewReplayResults ViewResults = ReplayNSSViews(*Upscaler,
+			*Upscaler->GetBackend(),
+			Upscaler->GetApi(),
+			Sequences,
+			WarmupFrames,
+			FMath::Max(Loops, 1),
+			FParse::Param(*Params, TEXT("Parallel")),
+			FParse::Param(*Params, TEXT("Batched")));
+		FString JsonPath = FString::Printf(TEXT("%s_%dViews.json"), *DefaultPath, NumViews);
+		FParse::Value(*Params, TEXT("Json="), JsonPath);
+		UE_LOG(LogNSS,
+			Display,
+			TEXT("Replayed %d frames of %d views of '%s'%s%s"),
+			ViewResults.FrameMilliseconds.Num(),
+			NumViews,
+			*Sequence.Name,
+			ViewResults.bParallel ? TEXT(" in parallel") : TEXT(""),
+			ViewResults.bBatched ? TEXT(" with batched dispatches") : TEXT(""));
+		return SaveResults(ViewResults.ToJson(), JsonPath) ? 0 : 1;
+	}
+
+	// -SparseTiles classifies the tiles of every frame as r.NSS.SparseTiles does, and -SparseTiles=2 also carries the
+	// history forward into the inactive tiles.
+	int32 SparseTiles = CVarNSSSparseTiles.GetValueOnAnyThread();
+	if (FParse::Param(*Params, TEXT("SparseTiles")))
+	{
+		SparseTiles = FMath::Max(SparseTiles, 1);
+	}
+	FParse::Value(*Params, TEXT("SparseTiles="), SparseTiles);
+	NSSReplayResults Results;
+	{
+		NSSReplayer Replayer(*Upscaler, *Upscaler->GetBackend(), Upscaler->GetApi());
+		Replayer.SetCountAllocations(true);
+		if (SparseTiles != 0)
+		{
+			NSSReplayTileSettings TileSettings;
+			TileSettings.Params.TileSize = CVarNSSSparseTilesTileSize.GetValueOnAnyThread();
+			FParse::Value(*Params, TEXT("TileSize="), TileSettings.Params.TileSize);
+			TileSettings.Params.HaloTiles = CVarNSSSparseTilesHalo.GetValueOnAnyThread();
+			TileSettings.Params.MotionThresholdPixels = CVarNSSSparseTilesMotionThreshold.GetValueOnAnyThread();
+			TileSettings.Params.DepthThreshold = CVarNSSSparseTilesDepthThreshold.GetValueOnAnyThread();
+			TileSettings.Params.LumaThreshold = CVarNSSSparseTilesLumaThreshold.GetValueOnAnyThread();
+			TileSettings.bCompose = SparseTiles == 2;
+			Replayer.SetTileSettings(TileSettings);
+		}
+		Results = Replayer.Replay(Sequence, WarmupFrames, FMath::Max(Loops, 1));
+	}
+
+	FString JsonPath = DefaultPath + TEXT(".json");
+	FString CsvPath = DefaultPath + TEXT(".csv");
+	FParse::Value(*Params, TEXT("Json="), JsonPath);
+	FParse::Value(*Params, TEXT("Csv="), CsvPath);
+	UE_LOG(LogNSS,
+		Display,
+		TEXT("Replayed %d frames of '%s' with the %s backend"),
+		Results.Frames.Num(),
+		*Sequence.Name,
+		*Results.BackendName);
+	if (SparseTiles != 0)
+	{
+		int64 Tiles = 0;
+		int64 ActiveTiles = 0;
+		for (const NSSReplayFrameResult& Frame : Results.Frames)
+		{
+			Tiles += Frame.Tiles;
+			ActiveTiles += Frame.ActiveTiles;
+		}
+		UE_LOG(LogNSS,
+			Display,
+			TEXT("%.1f%% of the tiles were active"),
+			Tiles > 0 ? double(ActiveTiles) * 100.0 / double(Tiles) : 0.0);
+	}
+	const bool bSaved = SaveResults(Results.ToJson(), JsonPath) && SaveResults(Results.ToCsv(), CsvPath);
+	return bSaved ? 0 : 1;
+}
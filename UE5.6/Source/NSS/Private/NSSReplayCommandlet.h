@@ -0,0 +1,38 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "Commandlets/Commandlet.h"
+#include "CoreMinimal.h"
+
+#include "NSSReplayCommandlet.generated.h"
+
+//-------------------------------------------------------------------------------------
+// Replays a recorded sequence of NSS inputs and reports the cost of each frame, without a window or a scene:
+//   -run=NSSReplay -Sequence=<file> | -Synthetic [-InputSize=WxH] [-OutputSize=WxH] [-Frames=N]
+//       [-CameraCutInterval=N] [-Warmup=N] [-Loops=N] [-Json=<file>] [-Csv=<file>]
+// With -Views=N the sequence is replayed as N views, every other one at half the size for a synthetic sequence, and
+// the cost of each frame of all the views is reported to the Json file, with -Parallel replaying the views of a frame
+// concurrently and -Batched dispatching them together rather than one at a time.
+// With -Stereo the sequence is replayed as the two eyes of a stereo pair, the synthetic secondary eye seeing the
+// pattern -EyeOffset=N render pixels further left, and the cost of each eye is reported to the Json file.
+// -CrossEyeReuse (or r.NSS.XR.CrossEyeReuse) reprojects the secondary eye from the primary eye on the frames that
+// r.NSS.XR.SecondaryEyeInterval (or -SecondaryEyeInterval=N) skips the network on.
+// With -SparseTiles the tiles of each frame are classified as r.NSS.SparseTiles does, with -TileSize=N or the
+// r.NSS.SparseTiles settings, and the tiles that changed and are active are reported to the Json file; -SparseTiles=2
+// also carries the history forward into the output of the inactive tiles with the CPU backend.
+// or re-issues the ffx calls of a trace recorded with r.NSS.Trace.Start and reports what they cost:
+//   -run=NSSReplay -Trace=<file> [-PreserveTiming] [-Json=<file>]
+// With -nullrhi the CPU reference backend is used (r.NSS.CPUBackend).
+//-------------------------------------------------------------------------------------
+UCLASS()
+class UNSSReplayCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UNSSReplayCommandlet();
+
+	int32 Main(const FString& Params) override;
+};
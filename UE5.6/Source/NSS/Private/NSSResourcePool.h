@@ -0,0 +1,286 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Misc/ScopeLock.h"
+#include "PixelFormat.h"
+#include "RHIDefinitions.h"
+#include "Templates/Function.h"
+#include "Templates/RefCounting.h"
+#include "Templates/UniquePtr.h"
+
+//-------------------------------------------------------------------------------------
+// Identifies interchangeable NSS intermediates.
+//-------------------------------------------------------------------------------------
+struct NSSResourceKey
+{
+	FIntPoint Extent = FIntPoint::ZeroValue;
+	EPixelFormat Format = PF_Unknown;
+	ETextureCreateFlags Flags = TexCreate_None;
+
+	bool operator==(const NSSResourceKey& Other) const
+	{
+		return Extent == Other.Extent && Format == Other.Format && Flags == Other.Flags;
+	}
+
+	friend uint32 GetTypeHash(const NSSResourceKey& Key)
+	{
+		return HashCombine(
+			GetTypeHash(Key.Extent), HashCombine(GetTypeHash(uint32(Key.Format)), GetTypeHash(uint64(Key.Flags))));
+	}
+
+	uint64 GetSizeBytes() const
+	{
+		return uint64(Extent.X) * uint64(Extent.Y) * GPixelFormats[Format].BlockBytes;
+	}
+};
+
+// Rounds an extent up to a size class so that small resolution changes (e.g. dynamic resolution or resizing a
+// window) keep reusing the same resources.
+inline FIntPoint GetBucketedExtent(FIntPoint Extent, int32 BucketSize)
+{
+	if (BucketSize <= 1)
+	{
+		return Extent;
+	}
+	return FIntPoint(FMath::DivideAndRoundUp(Extent.X, BucketSize) * BucketSize,
+		FMath::DivideAndRoundUp(Extent.Y, BucketSize) * BucketSize);
+}
+
+struct NSSResourcePoolStats
+{
+	uint64 Hits = 0;
+	uint64 Misses = 0;
+	uint64 Evictions = 0;
+	// The memory currently retained by the pool, in use or not.
+	uint64 AllocatedBytes = 0;
+	int32 NumResources = 0;
+};
+
+//-------------------------------------------------------------------------------------
+// A pool of resources that persists across frames.
+// A resource is free for reuse once the pool holds the only reference to it, the same rule the engine's render
+// target pool uses, so anything still referenced by a graph or a history is never handed out twice.
+//-------------------------------------------------------------------------------------
+template <typename ResourceType>
+class TNSSResourcePool
+{
+public:
+	using FCreateResource = TFunctionRef<TRefCountPtr<ResourceType>(const NSSResourceKey&)>;
+
+	~TNSSResourcePool()
+	{
+		Empty();
+	}
+
+	// Returns a free resource matching Key, creating one with CreateResource if there is none.
+	TRefCountPtr<ResourceType> Acquire(const NSSResourceKey& Key, uint64 Frame, FCreateResource CreateResource)
+	{
+		FScopeLock Lock(&Mutex);
+		TArray<FEntry>& Entries = EntriesByKey.FindOrAdd(Key);
+		for (FEntry& Entry : Entries)
+		{
+			if (Entry.Resource.GetRefCount() == 1)
+			{
+				Entry.LastUsedFrame = Frame;
+				Stats.Hits++;
+				return Entry.Resource;
+			}
+		}
+
+		TRefCountPtr<ResourceType> Resource = CreateResource(Key);
+		check(Resource.IsValid());
+		FEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.Resource = Resource;
+		Entry.SizeBytes = Key.GetSizeBytes();
+		Entry.LastUsedFrame = Frame;
+		Stats.Misses++;
+		Stats.AllocatedBytes += Entry.SizeBytes;
+		Stats.NumResources++;
+		return Resource;
+	}
+
+	// Releases free resources that haven't been used for MaxUnusedFrames, then the least recently used free
+	// resources until the pool fits in MaxBytes. Resources in use are never released, so the pool can go over
+	// MaxBytes if a single frame needs more than that.
+	void Trim(uint64 Frame, uint64 MaxBytes, uint32 MaxUnusedFrames)
+	{
+		FScopeLock Lock(&Mutex);
+		for (auto It = EntriesByKey.CreateIterator(); It; ++It)
+		{
+			It.Value().RemoveAll(
+				[this, Frame, MaxUnusedFrames](const FEntry& Entry)
+				{
+					const bool bEvict = Entry.Resource.GetRefCount() == 1 && Frame > Entry.LastUsedFrame
+										&& Frame - Entry.LastUsedFrame > MaxUnusedFrames;
+					if (bEvict)
+					{
+						OnEvicted(Entry);
+					}
+					return bEvict;
+				});
+		}
+
+		while (Stats.AllocatedBytes > MaxBytes)
+		{
+			TArray<FEntry>* OldestEntries = nullptr;
+			int32 OldestIndex = INDEX_NONE;
+			for (auto& Pair : EntriesByKey)
+			{
+				for (int32 Index = 0; Index < Pair.Value.Num(); Index++)
+				{
+					const FEntry& Entry = Pair.Value[Index];
+					if (Entry.Resource.GetRefCount() == 1
+						&& (!OldestEntries || Entry.LastUsedFrame < (*OldestEntries)[OldestIndex].LastUsedFrame))
+					{
+						OldestEntries = &Pair.Value;
+						OldestIndex = Index;
+					}
+				}
+			}
+			if (!OldestEntries)
+			{
+				break;
+			}
+			OnEvicted((*OldestEntries)[OldestIndex]);
+			OldestEntries->RemoveAtSwap(OldestIndex);
+		}
+
+		for (auto It = EntriesByKey.CreateIterator(); It; ++It)
+		{
+			if (It.Value().IsEmpty())
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	// Drops the pool's references to every resource. Resources still in use stay alive until they are released.
+	void Empty()
+	{
+		FScopeLock Lock(&Mutex);
+		EntriesByKey.Empty();
+		Stats.AllocatedBytes = 0;
+		Stats.NumResources = 0;
+	}
+
+	NSSResourcePoolStats GetStats() const
+	{
+		FScopeLock Lock(&Mutex);
+		return Stats;
+	}
+
+private:
+	struct FEntry
+	{
+		TRefCountPtr<ResourceType> Resource;
+		uint64 SizeBytes = 0;
+		uint64 LastUsedFrame = 0;
+	};
+
+	void OnEvicted(const FEntry& Entry)
+	{
+		Stats.Evictions++;
+		Stats.AllocatedBytes -= Entry.SizeBytes;
+		Stats.NumResources--;
+	}
+
+	mutable FCriticalSection Mutex;
+	TMap<NSSResourceKey, TArray<FEntry>> EntriesByKey;
+	NSSResourcePoolStats Stats;
+};
+
+//-------------------------------------------------------------------------------------
+// A resource pool per view, keyed by ViewID, so that views never share intermediates: views of different sizes
+// don't evict each other's resources, and views can add their passes concurrently on different graph builders,
+// only contending on the lookup of their pool.
+//-------------------------------------------------------------------------------------
+template <typename ResourceType>
+class TNSSViewResourcePools
+{
+public:
+	using FPool = TNSSResourcePool<ResourceType>;
+
+	// Returns ViewID's pool, creating it the first time the view is seen. The pool stays valid until the view has
+	// been unused for long enough to be trimmed away, so it can be used for the rest of the view's frame.
+	FPool& FindOrAdd(uint32 ViewID, uint64 Frame)
+	{
+		FScopeLock Lock(&Mutex);
+		FView& View = Views.FindOrAdd(ViewID);
+		if (!View.Pool.IsValid())
+		{
+			View.Pool = MakeUnique<FPool>();
+		}
+		View.LastUsedFrame = Frame;
+		return *View.Pool;
+	}
+
+	// Trims each view's pool to MaxBytesPerView, then drops the pools of views that haven't been used for
+	// MaxUnusedFrames. Resources still in use stay alive until they are released. Between frames.
+	void Trim(uint64 Frame, uint64 MaxBytesPerView, uint32 MaxUnusedFrames)
+	{
+		FScopeLock Lock(&Mutex);
+		for (auto It = Views.CreateIterator(); It; ++It)
+		{
+			FView& View = It.Value();
+			View.Pool->Trim(Frame, MaxBytesPerView, MaxUnusedFrames);
+			if (Frame > View.LastUsedFrame && Frame - View.LastUsedFrame > MaxUnusedFrames)
+			{
+				// Keeps the counters of the pool so that the totals never go backwards.
+				const NSSResourcePoolStats PoolStats = View.Pool->GetStats();
+				RemovedStats.Hits += PoolStats.Hits;
+				RemovedStats.Misses += PoolStats.Misses;
+				RemovedStats.Evictions += PoolStats.Evictions + PoolStats.NumResources;
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	// Drops every view's pool.
+	void Empty()
+	{
+		FScopeLock Lock(&Mutex);
+		for (auto& Pair : Views)
+		{
+			Pair.Value.Pool->Empty();
+		}
+	}
+
+	// The totals of every view.
+	NSSResourcePoolStats GetStats() const
+	{
+		FScopeLock Lock(&Mutex);
+		NSSResourcePoolStats Result = RemovedStats;
+		for (const auto& Pair : Views)
+		{
+			const NSSResourcePoolStats PoolStats = Pair.Value.Pool->GetStats();
+			Result.Hits += PoolStats.Hits;
+			Result.Misses += PoolStats.Misses;
+			Result.Evictions += PoolStats.Evictions;
+			Result.AllocatedBytes += PoolStats.AllocatedBytes;
+			Result.NumResources += PoolStats.NumResources;
+		}
+		return Result;
+	}
+
+	int32 GetNumViews() const
+	{
+		FScopeLock Lock(&Mutex);
+		return Views.Num();
+	}
+
+private:
+	struct FView
+	{
+		TUniquePtr<FPool> Pool;
+		uint64 LastUsedFrame = 0;
+	};
+
+	mutable FCriticalSection Mutex;
+	TMap<uint32, FView> Views;
+	// The counters of the pools of views that have been trimmed away.
+	NSSResourcePoolStats RemovedStats;
+};
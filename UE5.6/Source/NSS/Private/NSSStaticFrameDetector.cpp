@@ -0,0 +1,62 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#include "NSSStaticFrameDetector.h"
+
+ENSSStaticFrameDecision NSSStaticFrameDetector::Update(
+	const NSSStaticFrameInputs& Inputs, const NSSStaticFrameSettings& Settings)
+{
+	const bool bStatic = IsStatic(Inputs, Settings);
+	Previous = Inputs;
+	if (!bStatic)
+	{
+		StaticFrames = 0;
+		ReusedFrames = 0;
+		return ENSSStaticFrameDecision::Dispatch;
+	}
+	StaticFrames++;
+	// The frames the output is reused for count as static, so after a refresh it's reused again straight away.
+	if (StaticFrames > FMath::Max(Settings.ConvergeFrames, 0) && ReusedFrames < Settings.MaxReuseFrames)
+	{
+		ReusedFrames++;
+		return ENSSStaticFrameDecision::Reuse;
+	}
+	ReusedFrames = 0;
+	return ENSSStaticFrameDecision::Dispatch;
+}
+
+void NSSStaticFrameDetector::Reset()
+{
+	Previous.Reset();
+	StaticFrames = 0;
+	ReusedFrames = 0;
+}
+
+bool NSSStaticFrameDetector::IsStatic(const NSSStaticFrameInputs& Inputs, const NSSStaticFrameSettings& Settings) const
+{
+	if (!Previous.IsSet() || Inputs.bHistoryReset || Inputs.InputSize != Previous->InputSize
+		|| Inputs.OutputSize != Previous->OutputSize || Inputs.PreExposure != Previous->PreExposure
+		|| Inputs.JitterSequenceLength != Previous->JitterSequenceLength)
+	{
+		return false;
+	}
+	// An object may start moving in any frame of a running world and the measured motion would only show it frames
+	// later, so a running world is never static.
+	if (!Inputs.bWorldPaused
+		|| (Inputs.MaxMotionPixels.IsSet() && Inputs.MaxMotionPixels.GetValue() > Settings.MotionTolerancePixels))
+	{
+		return false;
+	}
+	for (int32 Row = 0; Row < 4; Row++)
+	{
+		for (int32 Column = 0; Column < 4; Column++)
+		{
+			if (FMath::Abs(Inputs.WorldToClip.M[Row][Column] - Previous->WorldToClip.M[Row][Column])
+				> Settings.CameraTolerance)
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
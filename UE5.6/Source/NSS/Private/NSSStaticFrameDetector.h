@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// What is known about a view's frame when deciding whether it needs upscaling again.
+struct NSSStaticFrameInputs
+{
+	// The unjittered world to clip transform of the view. The jitter moves every frame whether the scene does or not.
+	FMatrix WorldToClip = FMatrix::Identity;
+	FIntPoint InputSize = FIntPoint::ZeroValue;
+	FIntPoint OutputSize = FIntPoint::ZeroValue;
+	float PreExposure = 1.0f;
+	// Number of samples in the jitter sequence, which changes the convergence of the history.
+	int32 JitterSequenceLength = 0;
+	// The history can't be used, e.g. on a camera cut.
+	bool bHistoryReset = false;
+	// The game is paused, so nothing in the world is moving by itself. Only paused frames are ever reused.
+	bool bWorldPaused = false;
+	// Length of the longest motion vector of objects moving by themselves in a recent frame, in input pixels. Unset
+	// while it hasn't been measured. It lags the frame by a few frames, so it only vetoes the reuse, e.g. for actors
+	// that tick while the game is paused.
+	TOptional<float> MaxMotionPixels;
+};
+
+struct NSSStaticFrameSettings
+{
+	// Number of static frames upscaled before the output is reused, so the history has converged over the jitter
+	// sequence first.
+	int32 ConvergeFrames = 8;
+	// Most consecutive frames the output is reused for before a frame is upscaled again, which catches the changes
+	// the detector can't see such as lighting or animated materials. 0 never reuses it.
+	int32 MaxReuseFrames = 30;
+	// Largest difference between elements of consecutive world to clip transforms of a static camera.
+	double CameraTolerance = 1e-6;
+	// Longest motion vector, in input pixels, of a static scene.
+	float MotionTolerancePixels = 0.01f;
+};
+
+enum class ENSSStaticFrameDecision : uint8
+{
+	// Run the network as usual.
+	Dispatch,
+	// Output the history again in place of the dispatch.
+	Reuse
+};
+
+//-------------------------------------------------------------------------------------
+// Spots the frames of a view that would be upscaled to the same output as the previous one, e.g. in pause menus, so
+// that they can reuse the converged history instead of running the network. A frame is static only when the world is
+// paused and the camera, jitter, sizes and exposure are unchanged. Any measured motion vector beyond the tolerance
+// still stops the reuse.
+//-------------------------------------------------------------------------------------
+class NSSStaticFrameDetector
+{
+public:
+	// Decides what to do with the view's next frame.
+	ENSSStaticFrameDecision Update(const NSSStaticFrameInputs& Inputs, const NSSStaticFrameSettings& Settings);
+
+	// Forgets the frames seen so far.
+	void Reset();
+
+	// Consecutive static frames up to and including the last one.
+	int32 GetStaticFrames() const
+	{
+		return StaticFrames;
+	}
+
+	// Consecutive frames the output has been reused for.
+	int32 GetReusedFrames() const
+	{
+		return ReusedFrames;
+	}
+
+private:
+	bool IsStatic(const NSSStaticFrameInputs& Inputs, const NSSStaticFrameSettings& Settings) const;
+
+	TOptional<NSSStaticFrameInputs> Previous;
+	int32 StaticFrames = 0;
+	int32 ReusedFrames = 0;
+};
@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Stats/Stats.h"
+
+//-------------------------------------------------------------------------------------
+// Stats for the NSS upscaler, visible with "stat NSS" and in CSV profiles under the NSS category.
+//-------------------------------------------------------------------------------------
+DECLARE_STATS_GROUP(TEXT("NSS"), STATGROUP_NSS, STATCAT_Advanced);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Input preparation passes"), STAT_NSS_InputPreparationPasses, STATGROUP_NSS, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Input preparation bytes allocated"),
+	STAT_NSS_InputPreparationBytes,
+	STATGROUP_NSS, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Output crop copies avoided"), STAT_NSS_CropCopiesAvoided, STATGROUP_NSS, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Resource pool hits"), STAT_NSS_PoolHits, STATGROUP_NSS, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Resource pool misses"), STAT_NSS_PoolMisses, STATGROUP_NSS, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Resource pool evictions"), STAT_NSS_PoolEvictions, STATGROUP_NSS, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Resource pool resources"), STAT_NSS_PoolResources, STATGROUP_NSS, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Resource pool memory"), STAT_NSS_PoolMemory, STATGROUP_NSS, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Context cache hits"), STAT_NSS_ContextCacheHits, STATGROUP_NSS, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Context creations"), STAT_NSS_ContextCreations, STATGROUP_NSS, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Context cache evictions"), STAT_NSS_ContextCacheEvictions, STATGROUP_NSS, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(
+	TEXT("Context cache lock contentions"), STAT_NSS_ContextCacheLockContentions, STATGROUP_NSS, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Cached contexts"), STAT_NSS_ContextCacheContexts, STATGROUP_NSS, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Context cache memory"), STAT_NSS_ContextCacheMemory, STATGROUP_NSS, );
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Context cache hit rate (%)"), STAT_NSS_ContextCacheHitRate, STATGROUP_NSS, );
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Context creation time avoided (ms)"),
+	STAT_NSS_ContextCreationMsAvoided,
+	STATGROUP_NSS, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Contexts created ahead of time"),
+	STAT_NSS_ContextsPrecreated,
+	STATGROUP_NSS, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Waits for contexts created ahead of time"),
+	STAT_NSS_ContextPrecreationWaits,
+	STATGROUP_NSS, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Contexts being created ahead of time"),
+	STAT_NSS_ContextPrecreationsPending,
+	STATGROUP_NSS, );
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Histories"), STAT_NSS_Histories, STATGROUP_NSS, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("History texture memory"), STAT_NSS_HistoryMemory, STATGROUP_NSS, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Context memory"), STAT_NSS_ContextMemory, STATGROUP_NSS, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Context scratch memory"), STAT_NSS_ContextScratchMemory, STATGROUP_NSS, );
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Total memory"), STAT_NSS_TotalMemory, STATGROUP_NSS, );
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("GPU input preparation (ms)"),
+	STAT_NSS_GPUInputPreparation,
+	STATGROUP_NSS, );
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("GPU dispatch (ms)"), STAT_NSS_GPUDispatch, STATGROUP_NSS, );
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("GPU dispatch input preparation (ms)"),
+	STAT_NSS_GPUDispatchInputPreparation,
+	STATGROUP_NSS, );
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("GPU dispatch inference (ms)"),
+	STAT_NSS_GPUDispatchInference,
+	STATGROUP_NSS, );
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("GPU dispatch output resolve (ms)"),
+	STAT_NSS_GPUDispatchOutputResolve,
+	STATGROUP_NSS, );
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("GPU output crop (ms)"), STAT_NSS_GPUOutputCrop, STATGROUP_NSS, );
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("GPU total (ms)"), STAT_NSS_GPUTotal, STATGROUP_NSS, );
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Dispatch recording"), STAT_NSS_DispatchRecording, STATGROUP_NSS, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Secondary eyes reprojected"), STAT_NSS_ReprojectedEyes, STATGROUP_NSS, );
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Governor screen percentage"),
+	STAT_NSS_GovernorScreenPercentage,
+	STATGROUP_NSS, );
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Governor GPU frame time (ms)"),
+	STAT_NSS_GovernorGPUFrameTime,
+	STATGROUP_NSS, );
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Static frames reused"), STAT_NSS_StaticFramesReused, STATGROUP_NSS, );
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Static frame dispatches skipped (%)"),
+	STAT_NSS_StaticFrameReuseRate,
+	STATGROUP_NSS, );
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Sparse tiles changed (%)"), STAT_NSS_SparseTilesChanged, STATGROUP_NSS, );
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("Sparse tiles active (%)"), STAT_NSS_SparseTilesActive, STATGROUP_NSS, );
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("ROI region pixels (%)"), STAT_NSS_RegionOfInterestPixels, STATGROUP_NSS, );
+
+CSV_DECLARE_CATEGORY_EXTERN(NSS);
+
+// The cost of preparing the network inputs for one view.
+struct NSSInputPreparationStats
+{
+	int32 NumPasses = 0;
+	// Transient texture memory allocated for padded copies or border strips.
+	uint64 AllocatedBytes = 0;
+
+	void AddTexture(const struct FRDGTextureDesc& Desc);
+	void Publish() const;
+};
+
+// Memory retained by the live NSS histories of one view, or of every view.
+struct NSSHistoryMemoryStats
+{
+	int32 NumHistories = 0;
+	uint64 TextureBytes = 0;
+	// Contexts are shared by consecutive histories of a view and only counted once.
+	int32 NumContexts = 0;
+	uint64 ContextBytes = 0;
+	uint64 ContextScratchBytes = 0;
+	// Contexts whose size the backend couldn't report, so ContextBytes is partly estimated.
+	int32 NumContextsEstimated = 0;
+
+	uint64 GetTotalBytes() const
+	{
+		return TextureBytes + ContextBytes;
+	}
+};
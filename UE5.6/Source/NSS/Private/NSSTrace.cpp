@@ -0,0 +1,99 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#include "NSSTrace.h"
+
+#include "HAL/PlatformTime.h"
+#include "ProfilingDebugging/MiscTrace.h"
+
+#include <atomic>
+
+#if NSS_TRACE_ENABLED
+
+UE_TRACE_CHANNEL_DEFINE(NSSChannel);
+
+UE_TRACE_EVENT_BEGIN(ArmNSS, Counters)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, LiveContexts)
+	UE_TRACE_EVENT_FIELD(uint32, PooledTextures)
+	UE_TRACE_EVENT_FIELD(uint64, AllocatedBytes)
+	UE_TRACE_EVENT_FIELD(uint32, ContextCreations)
+	UE_TRACE_EVENT_FIELD(uint32, CropCopies)
+	UE_TRACE_EVENT_FIELD(uint32, HistoryResets)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(ArmNSS, ContextCreated)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(double, Seconds)
+	UE_TRACE_EVENT_FIELD(uint32, ViewID)
+	UE_TRACE_EVENT_FIELD(uint32, InputWidth)
+	UE_TRACE_EVENT_FIELD(uint32, InputHeight)
+	UE_TRACE_EVENT_FIELD(uint32, OutputWidth)
+	UE_TRACE_EVENT_FIELD(uint32, OutputHeight)
+	UE_TRACE_EVENT_FIELD(bool, bAheadOfTime)
+UE_TRACE_EVENT_END()
+
+namespace
+{
+	std::atomic<uint32> GCountedEvents[int32(ENSSTraceCountedEvent::Num)];
+
+	uint32 TakeCount(ENSSTraceCountedEvent Event)
+	{
+		return GCountedEvents[int32(Event)].exchange(0, std::memory_order_relaxed);
+	}
+}
+
+void NSSTrace::Count(ENSSTraceCountedEvent Event)
+{
+	GCountedEvents[int32(Event)].fetch_add(1, std::memory_order_relaxed);
+}
+
+void NSSTrace::OutputCounters(const NSSTraceCounters& Values)
+{
+	UE_TRACE_LOG(ArmNSS, Counters, NSSChannel)
+		<< Counters.Cycle(FPlatformTime::Cycles64())
+		<< Counters.LiveContexts(uint32(Values.LiveContexts))
+		<< Counters.PooledTextures(uint32(Values.PooledTextures))
+		<< Counters.AllocatedBytes(Values.AllocatedBytes)
+		<< Counters.ContextCreations(uint32(Values.ContextCreations))
+		<< Counters.CropCopies(TakeCount(ENSSTraceCountedEvent::CropCopy))
+		<< Counters.HistoryResets(TakeCount(ENSSTraceCountedEvent::HistoryReset));
+}
+
+void NSSTrace::OutputContextCreated(
+	uint32 ViewID, FIntPoint InputSize, FIntPoint OutputSize, double Seconds, bool bAheadOfTime)
+{
+	UE_TRACE_LOG(ArmNSS, ContextCreated, NSSChannel)
+		<< ContextCreated.Cycle(FPlatformTime::Cycles64())
+		<< ContextCreated.Seconds(Seconds)
+		<< ContextCreated.ViewID(ViewID)
+		<< ContextCreated.InputWidth(uint32(InputSize.X))
+		<< ContextCreated.InputHeight(uint32(InputSize.Y))
+		<< ContextCreated.OutputWidth(uint32(OutputSize.X))
+		<< ContextCreated.OutputHeight(uint32(OutputSize.Y))
+		<< ContextCreated.bAheadOfTime(bAheadOfTime);
+	if (NSS_TRACE_IS_ENABLED())
+	{
+		TRACE_BOOKMARK(TEXT("NSS context %dx%d to %dx%d created%s in %.1fms"),
+			InputSize.X,
+			InputSize.Y,
+			OutputSize.X,
+			OutputSize.Y,
+			bAheadOfTime ? TEXT(" ahead of time") : TEXT(""),
+			Seconds * 1000.0);
+	}
+}
+
+#else
+
+void NSSTrace::Count(ENSSTraceCountedEvent Event)
+{}
+
+void NSSTrace::OutputCounters(const NSSTraceCounters& Values)
+{}
+
+void NSSTrace::OutputContextCreated(
+	uint32 ViewID, FIntPoint InputSize, FIntPoint OutputSize, double Seconds, bool bAheadOfTime)
+{}
+
+#endif
@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Trace/Trace.h"
+
+//-------------------------------------------------------------------------------------
+// Unreal Insights events of the NSS upscaler, on NSSChannel (-trace=cpu,nss). Everything is skipped behind a check of
+// the channel when it is disabled, and compiled out in builds without trace. The NSSInsights module analyses them.
+//-------------------------------------------------------------------------------------
+#define NSS_TRACE_ENABLED (UE_TRACE_ENABLED && !UE_BUILD_SHIPPING)
+
+#if NSS_TRACE_ENABLED
+UE_TRACE_CHANNEL_EXTERN(NSSChannel);
+
+#define NSS_TRACE_IS_ENABLED() UE_TRACE_CHANNELEXPR_IS_ENABLED(NSSChannel)
+#define NSS_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL_STR(Name, NSSChannel)
+// Counts an occurrence towards the current frame's counters.
+#define NSS_TRACE_COUNT(Event)                            \
+	do                                                    \
+	{                                                     \
+		if (NSS_TRACE_IS_ENABLED())                       \
+		{                                                 \
+			NSSTrace::Count(ENSSTraceCountedEvent::Event); \
+		}                                                 \
+	} while (0)
+#else
+#define NSS_TRACE_IS_ENABLED() false
+#define NSS_TRACE_SCOPE(Name)
+#define NSS_TRACE_COUNT(Event)
+#endif
+
+enum class ENSSTraceCountedEvent : uint8
+{
+	CropCopy,
+	HistoryReset,
+	Num
+};
+
+// The state of the upscaler at the end of a frame.
+struct NSSTraceCounters
+{
+	int32 LiveContexts = 0;
+	int32 PooledTextures = 0;
+	uint64 AllocatedBytes = 0;
+	int32 ContextCreations = 0;
+};
+
+namespace NSSTrace
+{
+	void Count(ENSSTraceCountedEvent Event);
+	// Outputs the counters with the events counted since the previous call, once a frame.
+	void OutputCounters(const NSSTraceCounters& Values);
+	// Outputs a context creation and bookmarks it. bAheadOfTime for those made by the context factory.
+	void OutputContextCreated(
+		uint32 ViewID, FIntPoint InputSize, FIntPoint OutputSize, double Seconds, bool bAheadOfTime);
+}
@@ -30,6 +30,7 @@
 #include "LandscapeProxy.h"
 #include "Materials/Material.h"
 #include "NGSettings.h"
+#include "NSSCalibration.h"
 #include "NSSModule.h"
 #include "NSSProxy.h"
 #include "PostProcess/PostProcessing.h"
@@ -56,6 +57,8 @@ NSSViewExtension::NSSViewExtension(const FAutoRegister& AutoRegister) : FSceneVi
 		TSharedPtr<NSS, ESPMode::ThreadSafe> NSSTemporalUpscaler = MakeShared<NSS, ESPMode::ThreadSafe>();
 		NSSModuleInstance.SetTemporalUpscaler(NSSTemporalUpscaler);
 	}
+	Upscaler = NSSModuleInterface.GetNSSUpscaler();
+	check(Upscaler);
 }
 
 void NSSViewExtension::SetupViewFamily(FSceneViewFamily& InViewFamily)
@@ -66,14 +69,11 @@ void NSSViewExtension::SetupViewFamily(FSceneViewFamily& InViewFamily)
 			IConsoleManager::Get().FindConsoleVariable(TEXT("r.ViewTextureMipBias.Min"));
 		static IConsoleVariable* CVarMinAutomaticViewMipBiasOffset =
 			IConsoleManager::Get().FindConsoleVariable(TEXT("r.ViewTextureMipBias.Offset"));
-		INSSModule& NSSModuleInterface = FModuleManager::GetModuleChecked<INSSModule>(TEXT("NSS"));
-		check(NSSModuleInterface.GetNSSUpscaler());
-
-		if (CVarEnableNSS.GetValueOnAnyThread() && !NSSModuleInterface.GetNSSUpscaler()->IsApiSupported())
+		if (CVarEnableNSS.GetValueOnAnyThread() && !Upscaler->IsApiSupported())
 		{
-			NSSModuleInterface.GetNSSUpscaler()->Initialize();
+			Upscaler->Initialize();
 
-			if (CVarEnableNSS.GetValueOnAnyThread() && NSSModuleInterface.GetNSSUpscaler()->IsApiSupported())
+			if (CVarEnableNSS.GetValueOnAnyThread() && Upscaler->IsApiSupported())
 			{
 				// Initialize by default for game, but not the editor unless we intend to use NSS in the viewport by
 				// default
@@ -93,6 +93,12 @@ void NSSViewExtension::SetupViewFamily(FSceneViewFamily& InViewFamily)
 								float(-1.0f + FLT_EPSILON), EConsoleVariableFlags::ECVF_SetByCode);
 						}
 					}
+					// Picks the quality mode for this device, timing the upscaler in the background the first time
+					// it is seen.
+					if (!GIsEditor && InViewFamily.RenderTarget)
+					{
+						CalibrateNSSOnFirstLaunch(*Upscaler, InViewFamily.RenderTarget->GetSizeXY());
+					}
 				}
 				else
 				{
@@ -164,8 +170,6 @@ void NSSViewExtension::BeginRenderViewFamily(FSceneViewFamily& InViewFamily)
 {
 	if (InViewFamily.GetFeatureLevel() >= ERHIFeatureLevel::ES3_1)
 	{
-		INSSModule& NSSModuleInterface = FModuleManager::GetModuleChecked<INSSModule>(TEXT("NSS"));
-		NSS* Upscaler = NSSModuleInterface.GetNSSUpscaler();
 		bool IsTemporalUpscalingRequested = false;
 		bool bIsGameView = !WITH_EDITOR;
 		for (int i = 0; i < InViewFamily.Views.Num(); i++)
@@ -190,7 +194,9 @@ void NSSViewExtension::BeginRenderViewFamily(FSceneViewFamily& InViewFamily)
 		{
 			if (!WITH_EDITOR || (CVarEnableNSSInEditor.GetValueOnGameThread() == 1) || bIsGameView)
 			{
+				Upscaler->UpdateQualityGovernor();
 				Upscaler->UpdateDynamicResolutionState();
+				Upscaler->PredictContexts(InViewFamily);
 				InViewFamily.SetTemporalUpscalerInterface(new NSSProxy(Upscaler));
 			}
 		}
@@ -220,23 +226,7 @@ void NSSViewExtension::PreRenderView_RenderThread(FRenderGraphType& GraphBuilder
 	{
 		if (CVarEnableNSS.GetValueOnAnyThread())
 		{
-			INSSModule& NSSModuleInterface = FModuleManager::GetModuleChecked<INSSModule>(TEXT("NSS"));
-			// NSSModuleInterface.GetNSSUpscaler()->SetLumenReflections(InView);
-		}
-	}
-}
-
-void NSSViewExtension::PrePostProcessPass_RenderThread(
-	FRDGBuilder& GraphBuilder, const FSceneView& View, const FPostProcessingInputs& Inputs)
-{
-	// NSS requires the separate translucency data which is only available through the post-inputs so bind them to the
-	// upscaler now.
-	if (View.GetFeatureLevel() >= ERHIFeatureLevel::ES3_1)
-	{
-		if (CVarEnableNSS.GetValueOnAnyThread())
-		{
-			INSSModule& NSSModuleInterface = FModuleManager::GetModuleChecked<INSSModule>(TEXT("NSS"));
-			NSSModuleInterface.GetNSSUpscaler()->SetPostProcessingInputs(Inputs);
+			// Upscaler->SetLumenReflections(InView);
 		}
 	}
 }
@@ -249,8 +239,7 @@ void NSSViewExtension::PostRenderViewFamily_RenderThread(FRenderGraphType& Graph
 	{
 		if (CVarEnableNSS.GetValueOnAnyThread())
 		{
-			INSSModule& NSSModuleInterface = FModuleManager::GetModuleChecked<INSSModule>(TEXT("NSS"));
-			NSSModuleInterface.GetNSSUpscaler()->EndOfFrame();
+			Upscaler->EndOfFrame();
 		}
 	}
 }
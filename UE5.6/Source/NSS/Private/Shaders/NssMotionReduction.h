@@ -0,0 +1,41 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+#include "DataDrivenShaderPlatformInfo.h"
+#include "GlobalShader.h"
+#include "RenderGraphFwd.h"
+#include "ShaderCompilerCore.h"
+#include "ShaderParameterStruct.h"
+
+//-------------------------------------------------------------------------------------
+// Measures the longest motion vector of the objects moving by themselves in a view, for r.NSS.StaticFrameSkip.
+//-------------------------------------------------------------------------------------
+class FNssMotionReductionCS : public FGlobalShader
+{
+public:
+	static constexpr uint32 ThreadgroupSizeX = 8;
+	static constexpr uint32 ThreadgroupSizeY = 8;
+
+	DECLARE_GLOBAL_SHADER(FNssMotionReductionCS);
+	SHADER_USE_PARAMETER_STRUCT(FNssMotionReductionCS, FGlobalShader);
+	// clang-format off
+	BEGIN_SHADER_PARAMETER_STRUCT (FParameters, )
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, InputVelocity)
+		SHADER_PARAMETER(FIntPoint, InputViewMin)
+		SHADER_PARAMETER(FIntPoint, InputViewSize)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<uint>, OutMaxMotion)
+	END_SHADER_PARAMETER_STRUCT()
+	// clang-format on
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::ES3_1);
+	}
+
+	static void ModifyCompilationEnvironment(
+		const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZEX"), ThreadgroupSizeX);
+		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZEY"), ThreadgroupSizeY);
+	}
+};
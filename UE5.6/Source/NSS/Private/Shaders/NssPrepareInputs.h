@@ -0,0 +1,101 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+#include "DataDrivenShaderPlatformInfo.h"
+#include "GlobalShader.h"
+#include "RenderGraphFwd.h"
+#include "SceneTextureParameters.h"
+#include "ScreenPass.h"
+#include "ShaderCompilerCore.h"
+#include "ShaderParameterStruct.h"
+
+// How the padding of the network inputs to a multiple of 8 is produced.
+enum class ENssInputPadding : int32
+{
+	// The view is already a multiple of 8.
+	None,
+	// The padded view is copied into new colour/depth textures.
+	Copy,
+	// Only the border texels are written, directly into the scene colour/depth (see FNssPadBorderPS).
+	InPlace,
+	MAX
+};
+
+//-------------------------------------------------------------------------------------
+// Fused input preparation: mirror pads colour/depth and converts velocity in one compute pass.
+//-------------------------------------------------------------------------------------
+class FNssPrepareInputsCS : public FGlobalShader
+{
+public:
+	static constexpr uint32 ThreadgroupSizeX = 8;
+	static constexpr uint32 ThreadgroupSizeY = 8;
+
+	DECLARE_GLOBAL_SHADER(FNssPrepareInputsCS);
+	SHADER_USE_PARAMETER_STRUCT(FNssPrepareInputsCS, FGlobalShader);
+
+	class FPadMode : SHADER_PERMUTATION_ENUM_CLASS("PAD_MODE", ENssInputPadding);
+	using FPermutationDomain = TShaderPermutationDomain<FPadMode>;
+
+	// Width of the border strip textures written when padding in place.
+	static constexpr uint32 BorderStripWidth = 256;
+
+	// clang-format off
+	BEGIN_SHADER_PARAMETER_STRUCT (FParameters, )
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, InputColor)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, InputDepth)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, InputVelocity)
+		SHADER_PARAMETER(FIntPoint, InputViewMin)
+		SHADER_PARAMETER(FIntPoint, InputViewSize)
+		SHADER_PARAMETER(FUintVector2, OutputSize)
+		SHADER_PARAMETER(FVector2f, InvContentSize)
+		SHADER_PARAMETER_STRUCT_REF(FViewUniformShaderParameters, View)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float4>, OutColor)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float>, OutDepth)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float2>, OutMotionVectors)
+		SHADER_PARAMETER(uint32, BorderStripWidth)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float4>, OutBorderColor)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float>, OutBorderDepth)
+	END_SHADER_PARAMETER_STRUCT()
+	// clang-format on
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::ES3_1);
+	}
+
+	static void ModifyCompilationEnvironment(
+		const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZEX"), ThreadgroupSizeX);
+		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZEY"), ThreadgroupSizeY);
+	}
+};
+
+//-------------------------------------------------------------------------------------
+// Writes the border strips produced by FNssPrepareInputsCS into the scene colour/depth past the end of the view.
+//-------------------------------------------------------------------------------------
+class FNssPadBorderPS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FNssPadBorderPS);
+	SHADER_USE_PARAMETER_STRUCT(FNssPadBorderPS, FGlobalShader);
+	// clang-format off
+	BEGIN_SHADER_PARAMETER_STRUCT (FParameters, )
+		SHADER_PARAMETER(FIntPoint, InputViewSize)
+		SHADER_PARAMETER(FUintVector2, OutputSize)
+		SHADER_PARAMETER(uint32, BorderStripWidth)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, BorderColor)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<float>, BorderDepth)
+		RENDER_TARGET_BINDING_SLOTS()
+	END_SHADER_PARAMETER_STRUCT()
+	// clang-format on
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::ES3_1);
+	}
+
+	static void ModifyCompilationEnvironment(
+		const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{}
+};
@@ -0,0 +1,41 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+#include "DataDrivenShaderPlatformInfo.h"
+#include "GlobalShader.h"
+#include "RenderGraphFwd.h"
+#include "ShaderCompilerCore.h"
+#include "ShaderParameterStruct.h"
+
+//-------------------------------------------------------------------------------------
+// Keeps the network's output within the region of interest of r.NSS.ROI, with a bilinear upscale of the periphery.
+//-------------------------------------------------------------------------------------
+class FNssRegionOfInterestPS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FNssRegionOfInterestPS);
+	SHADER_USE_PARAMETER_STRUCT(FNssRegionOfInterestPS, FGlobalShader);
+	// clang-format off
+	BEGIN_SHADER_PARAMETER_STRUCT (FParameters, )
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, NetworkOutput)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, InputColor)
+		SHADER_PARAMETER_SAMPLER(SamplerState, LinearSampler)
+		SHADER_PARAMETER(FIntPoint, InputViewSize)
+		SHADER_PARAMETER(FIntPoint, OutputViewSize)
+		SHADER_PARAMETER(FIntPoint, InputColorMin)
+		SHADER_PARAMETER(FVector2f, InvInputColorExtent)
+		SHADER_PARAMETER(FVector2f, RegionCenter)
+		SHADER_PARAMETER(float, RegionRadius)
+		SHADER_PARAMETER(float, RegionFeather)
+		RENDER_TARGET_BINDING_SLOTS()
+	END_SHADER_PARAMETER_STRUCT()
+	// clang-format on
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::ES3_1);
+	}
+
+	static void ModifyCompilationEnvironment(
+		const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{}
+};
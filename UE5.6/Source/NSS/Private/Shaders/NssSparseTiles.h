@@ -0,0 +1,86 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+#include "DataDrivenShaderPlatformInfo.h"
+#include "GlobalShader.h"
+#include "RenderGraphFwd.h"
+#include "ShaderCompilerCore.h"
+#include "ShaderParameterStruct.h"
+
+//-------------------------------------------------------------------------------------
+// The tile classification of r.NSS.SparseTiles, with a thread group per tile of the padded inputs.
+//-------------------------------------------------------------------------------------
+class FNssClassifyTilesCS : public FGlobalShader
+{
+public:
+	static constexpr uint32 ThreadgroupSizeX = 8;
+	static constexpr uint32 ThreadgroupSizeY = 8;
+
+	DECLARE_GLOBAL_SHADER(FNssClassifyTilesCS);
+	SHADER_USE_PARAMETER_STRUCT(FNssClassifyTilesCS, FGlobalShader);
+	// clang-format off
+	BEGIN_SHADER_PARAMETER_STRUCT (FParameters, )
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, InputColor)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, InputDepth)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, InputMotionVectors)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, PrevFeatures)
+		SHADER_PARAMETER(FIntPoint, InputColorMin)
+		SHADER_PARAMETER(FIntPoint, InputDepthMin)
+		SHADER_PARAMETER(FIntPoint, PaddedSize)
+		SHADER_PARAMETER(int32, TileSize)
+		SHADER_PARAMETER(int32, bHasPrevious)
+		SHADER_PARAMETER(float, MotionThresholdPixels)
+		SHADER_PARAMETER(float, DepthThreshold)
+		SHADER_PARAMETER(float, LumaThreshold)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<float4>, OutFeatures)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<uint>, OutChanged)
+	END_SHADER_PARAMETER_STRUCT()
+	// clang-format on
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::ES3_1);
+	}
+
+	static void ModifyCompilationEnvironment(
+		const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZEX"), ThreadgroupSizeX);
+		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZEY"), ThreadgroupSizeY);
+	}
+};
+
+//-------------------------------------------------------------------------------------
+// Adds the halo around the changed tiles and counts the changed and active ones, with a thread per tile.
+//-------------------------------------------------------------------------------------
+class FNssDilateTilesCS : public FGlobalShader
+{
+public:
+	static constexpr uint32 ThreadgroupSizeX = 8;
+	static constexpr uint32 ThreadgroupSizeY = 8;
+
+	DECLARE_GLOBAL_SHADER(FNssDilateTilesCS);
+	SHADER_USE_PARAMETER_STRUCT(FNssDilateTilesCS, FGlobalShader);
+	// clang-format off
+	BEGIN_SHADER_PARAMETER_STRUCT (FParameters, )
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D<uint>, Changed)
+		SHADER_PARAMETER(FIntPoint, NumTiles)
+		SHADER_PARAMETER(int32, HaloTiles)
+		SHADER_PARAMETER_RDG_TEXTURE_UAV(RWTexture2D<uint>, OutActive)
+		SHADER_PARAMETER_RDG_BUFFER_UAV(RWBuffer<uint>, OutTileCounts)
+	END_SHADER_PARAMETER_STRUCT()
+	// clang-format on
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::ES3_1);
+	}
+
+	static void ModifyCompilationEnvironment(
+		const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{
+		FGlobalShader::ModifyCompilationEnvironment(Parameters, OutEnvironment);
+		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZEX"), ThreadgroupSizeX);
+		OutEnvironment.SetDefine(TEXT("THREADGROUP_SIZEY"), ThreadgroupSizeY);
+	}
+};
@@ -0,0 +1,45 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+#include "DataDrivenShaderPlatformInfo.h"
+#include "GlobalShader.h"
+#include "RenderGraphFwd.h"
+#include "ShaderCompilerCore.h"
+#include "ShaderParameterStruct.h"
+
+//-------------------------------------------------------------------------------------
+// Fills the secondary eye's upscaled output from the primary eye's, for the frames it skips the network on.
+//-------------------------------------------------------------------------------------
+class FNssStereoReprojectPS : public FGlobalShader
+{
+public:
+	DECLARE_GLOBAL_SHADER(FNssStereoReprojectPS);
+	SHADER_USE_PARAMETER_STRUCT(FNssStereoReprojectPS, FGlobalShader);
+	// clang-format off
+	BEGIN_SHADER_PARAMETER_STRUCT (FParameters, )
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, PrimaryOutput)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, PrimaryDepth)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, SecondaryColor)
+		SHADER_PARAMETER_RDG_TEXTURE(Texture2D, SecondaryDepth)
+		SHADER_PARAMETER_SAMPLER(SamplerState, LinearSampler)
+		SHADER_PARAMETER(FIntPoint, InputViewSize)
+		SHADER_PARAMETER(FIntPoint, OutputViewSize)
+		SHADER_PARAMETER(FIntPoint, PrimaryDepthMin)
+		SHADER_PARAMETER(FIntPoint, SecondaryDepthMin)
+		SHADER_PARAMETER(FIntPoint, SecondaryColorMin)
+		SHADER_PARAMETER(FVector2f, InvPrimaryOutputExtent)
+		SHADER_PARAMETER(FVector2f, InvSecondaryColorExtent)
+		SHADER_PARAMETER(FMatrix44f, SecondaryClipToPrimaryClip)
+		SHADER_PARAMETER(float, DisocclusionThreshold)
+		RENDER_TARGET_BINDING_SLOTS()
+	END_SHADER_PARAMETER_STRUCT()
+	// clang-format on
+
+	static bool ShouldCompilePermutation(const FGlobalShaderPermutationParameters& Parameters)
+	{
+		return IsFeatureLevelSupported(Parameters.Platform, ERHIFeatureLevel::ES3_1);
+	}
+
+	static void ModifyCompilationEnvironment(
+		const FGlobalShaderPermutationParameters& Parameters, FShaderCompilerEnvironment& OutEnvironment)
+	{}
+};
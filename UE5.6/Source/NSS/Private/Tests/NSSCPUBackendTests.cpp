@@ -0,0 +1,188 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "NGCPUBackend.h"
+#include "NSSInclude.h"
+
+namespace
+{
+	ffxApiDispatchDescNss MakeDispatch(NGCPUImage& Color, NGCPUImage& MotionVectors, NGCPUImage& History,
+		NGCPUImage& Output, bool bReset)
+	{
+		ffxApiDispatchDescNss Desc;
+		FMemory::Memzero(Desc);
+		Desc.header.type = FFX_API_DISPATCH_DESC_TYPE_NSS;
+		Desc.color = NGCPUBackendModule::GetImageResource(Color, FFX_API_RESOURCE_STATE_COMPUTE_READ);
+		Desc.motionVectors = NGCPUBackendModule::GetImageResource(MotionVectors, FFX_API_RESOURCE_STATE_COMPUTE_READ);
+		Desc.outputTm1 = NGCPUBackendModule::GetImageResource(History, FFX_API_RESOURCE_STATE_COMPUTE_READ);
+		Desc.output = NGCPUBackendModule::GetImageResource(Output, FFX_API_RESOURCE_STATE_UNORDERED_ACCESS);
+		Desc.renderSize.width = Color.Size.X;
+		Desc.renderSize.height = Color.Size.Y;
+		Desc.upscaleSize.width = Output.Size.X;
+		Desc.upscaleSize.height = Output.Size.Y;
+		Desc.motionVectorScale.x = Color.Size.X;
+		Desc.motionVectorScale.y = Color.Size.Y;
+		Desc.reset = bReset;
+		return Desc;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNSSCPUBackendTest,
+	"ArmNG.UnitTests.NSS.CPUBackend",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext
+		| EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter)
+
+bool FNSSCPUBackendTest::RunTest(const FString& Parameters)
+{
+	NGCPUBackendModule& Module = FModuleManager::LoadModuleChecked<NGCPUBackendModule>(TEXT("NGCPUBackend"));
+	INGSharedBackend* Backend = Module.GetBackend();
+	TestTrue(TEXT("API"), Backend->GetAPI() == EFFXBackendAPI::CPU);
+	Module.ResetCallStats();
+
+	ffxApiCreateContextDescNss Params;
+	FMemory::Memzero(Params);
+	Params.header.type = FFX_API_CREATE_CONTEXT_DESC_TYPE_NSS;
+	Params.maxRenderSize.width = 4;
+	Params.maxRenderSize.height = 4;
+	Params.maxUpscaleSize.width = 8;
+	Params.maxUpscaleSize.height = 8;
+	ffxContext Context = nullptr;
+	TestTrue(TEXT("Create"), Backend->ffxCreateContext(&Context, &Params.header) == FFX_OK);
+
+	NGCPUImage Color;
+	Color.Init(FIntPoint(4, 4), 4, 1.0f);
+	NGCPUImage MotionVectors;
+	MotionVectors.Init(FIntPoint(4, 4), 2);
+	NGCPUImage History;
+	History.Init(FIntPoint(8, 8), 4, 0.0f);
+	NGCPUImage Output;
+	Output.Init(FIntPoint(8, 8), 4);
+
+	// On a reset the output is the current frame upsampled.
+	ffxApiDispatchDescNss Desc = MakeDispatch(Color, MotionVectors, History, Output, true);
+	TestTrue(TEXT("Reset dispatch"), Backend->ffxDispatch(&Context, &Desc.header) == FFX_OK);
+	TestEqual(TEXT("Reset output"), Output.At(5, 3)[0], 1.0f);
+
+	// Otherwise the history is clamped to the current frame's neighbourhood before blending, so a flat frame
+	// replaces it entirely.
+	Desc = MakeDispatch(Color, MotionVectors, History, Output, false);
+	Backend->ffxDispatch(&Context, &Desc.header);
+	TestEqual(TEXT("Clamped history"), Output.At(5, 3)[0], 1.0f);
+
+	// History within the neighbourhood is kept, and is fetched from where the motion vectors say the pixel was.
+	for (int32 Y = 0; Y < Color.Size.Y; Y++)
+	{
+		for (int32 X = 0; X < Color.Size.X; X++)
+		{
+			Color.At(X, Y)[0] = X < 2 ? 0.0f : 1.0f;
+			MotionVectors.At(X, Y)[0] = 1.0f / float(Color.Size.X);
+		}
+	}
+	History.Init(FIntPoint(8, 8), 4, 0.0f);
+	History.At(3, 3)[0] = 0.5f;
+	Desc = MakeDispatch(Color, MotionVectors, History, Output, false);
+	Backend->ffxDispatch(&Context, &Desc.header);
+	TestEqual(TEXT("Reprojected history"), Output.At(5, 3)[0], FMath::Lerp(0.5f, 1.0f, 0.1f), UE_KINDA_SMALL_NUMBER);
+
+	// Dispatches that don't fit the context are rejected, and RHI textures without CPU images are only validated.
+	ffxApiDispatchDescNss Oversized = MakeDispatch(Color, MotionVectors, History, Output, true);
+	Oversized.upscaleSize.width = 16;
+	AddExpectedError(TEXT("exceeds the context's maximum sizes"), EAutomationExpectedErrorFlags::Contains, 1);
+	TestTrue(TEXT("Oversized"), Backend->ffxDispatch(&Context, &Oversized.header) != FFX_OK);
+	ffxApiDispatchDescNss Validated = Desc;
+	Validated.color = FfxApiResource{};
+	Validated.output = FfxApiResource{};
+	TestTrue(TEXT("Validate only"), Backend->ffxDispatch(&Context, &Validated.header) == FFX_OK);
+
+	TestTrue(TEXT("Destroy"), Backend->ffxDestroyContext(&Context) == FFX_OK);
+	TestNull(TEXT("Destroyed"), Context);
+
+	// Every call is costed.
+	TestEqual(TEXT("Create calls"), Module.GetCallStats(ENGCPUBackendCall::CreateContext).Calls, uint64(1));
+	TestEqual(TEXT("Dispatch calls"), Module.GetCallStats(ENGCPUBackendCall::Dispatch).Calls, uint64(5));
+	TestEqual(TEXT("Destroy calls"), Module.GetCallStats(ENGCPUBackendCall::DestroyContext).Calls, uint64(1));
+	TestTrue(TEXT("Dispatch cost"), Module.GetCallStats(ENGCPUBackendCall::Dispatch).TotalSeconds > 0.0);
+	Module.ResetCallStats();
+	TestEqual(TEXT("Reset"), Module.GetCallStats(ENGCPUBackendCall::Dispatch).Calls, uint64(0));
+	return true;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNSSCPUBackendDispatchBatchTest,
+	"ArmNG.UnitTests.NSS.CPUBackend.DispatchBatch",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext
+		| EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter)
+
+bool FNSSCPUBackendDispatchBatchTest::RunTest(const FString& Parameters)
+{
+	NGCPUBackendModule& Module = FModuleManager::LoadModuleChecked<NGCPUBackendModule>(TEXT("NGCPUBackend"));
+	INGSharedBackend* Backend = Module.GetBackend();
+	Module.ResetCallStats();
+
+	ffxApiCreateContextDescNss Params;
+	FMemory::Memzero(Params);
+	Params.header.type = FFX_API_CREATE_CONTEXT_DESC_TYPE_NSS;
+	Params.maxRenderSize.width = 8;
+	Params.maxRenderSize.height = 8;
+	Params.maxUpscaleSize.width = 16;
+	Params.maxUpscaleSize.height = 16;
+	constexpr int32 NumViews = 3;
+	ffxContext Contexts[NumViews] = {};
+	NGCPUImage Colors[NumViews];
+	NGCPUImage MotionVectors[NumViews];
+	NGCPUImage Histories[NumViews];
+	NGCPUImage Outputs[NumViews];
+	NGCPUImage Expected[NumViews];
+	ffxApiDispatchDescNss Descs[NumViews];
+	for (int32 View = 0; View < NumViews; View++)
+	{
+		TestTrue(TEXT("Create"), Backend->ffxCreateContext(&Contexts[View], &Params.header) == FFX_OK);
+		const FIntPoint InputSize(4 + View * 2, 4);
+		Colors[View].Init(InputSize, 4, 0.25f * float(View + 1));
+		Colors[View].At(1, 1)[0] = 1.0f;
+		MotionVectors[View].Init(InputSize, 2);
+		Histories[View].Init(InputSize * 2, 4, 0.5f);
+		Outputs[View].Init(InputSize * 2, 4);
+		Expected[View].Init(InputSize * 2, 4);
+
+		// What each view gets dispatched on its own.
+		ffxApiDispatchDescNss Desc =
+			MakeDispatch(Colors[View], MotionVectors[View], Histories[View], Expected[View], false);
+		Backend->ffxDispatch(&Contexts[View], &Desc.header);
+		Descs[View] = MakeDispatch(Colors[View], MotionVectors[View], Histories[View], Outputs[View], false);
+	}
+
+	// A batch of the views upscales each of them the same as dispatching them one at a time.
+	NGSharedBatchedDispatch Dispatches[NumViews];
+	for (int32 View = 0; View < NumViews; View++)
+	{
+		Dispatches[View].Context = &Contexts[View];
+		Dispatches[View].Desc = &Descs[View].header;
+	}
+	TestTrue(TEXT("Batch"), Backend->ffxDispatchBatch(Dispatches) == FFX_OK);
+	for (int32 View = 0; View < NumViews; View++)
+	{
+		TestTrue(TEXT("Batched output"), Outputs[View].Texels == Expected[View].Texels);
+	}
+
+	// A failing dispatch doesn't stop the others, and its error is returned.
+	Descs[1].upscaleSize.width = 32;
+	Outputs[2].Init(Outputs[2].Size, 4);
+	AddExpectedError(TEXT("exceeds the context's maximum sizes"), EAutomationExpectedErrorFlags::Contains, 1);
+	TestTrue(TEXT("Failed batch"), Backend->ffxDispatchBatch(Dispatches) != FFX_OK);
+	TestTrue(TEXT("Rest of the batch"), Outputs[2].Texels == Expected[2].Texels);
+
+	TestEqual(TEXT("Batch calls"), Module.GetCallStats(ENGCPUBackendCall::DispatchBatch).Calls, uint64(2));
+	TestEqual(TEXT("Single dispatches"), Module.GetCallStats(ENGCPUBackendCall::Dispatch).Calls, uint64(NumViews));
+	for (ffxContext& Context : Contexts)
+	{
+		Backend->ffxDestroyContext(&Context);
+	}
+	Module.ResetCallStats();
+	return true;
+}
+
+#endif
@@ -0,0 +1,124 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "NGSettings.h"
+#include "NSS.h"
+#include "NSSCalibration.h"
+#include "NSSModule.h"
+
+namespace
+{
+	// Frame times recorded at each quality mode on a device, with a slow first frame and an untimed one.
+	NSSCalibrationMeasurement MeasureRecorded(ENSSQualityMode QualityMode, double Milliseconds)
+	{
+		const double FrameMilliseconds[] = {Milliseconds * 3.0,
+			Milliseconds,
+			Milliseconds * 0.95,
+			0.0,
+			Milliseconds * 1.05,
+			Milliseconds,
+			Milliseconds * 0.9,
+			Milliseconds,
+			Milliseconds * 1.02,
+			Milliseconds};
+		return MeasureNSSCalibrationTimings(int32(QualityMode),
+			NSS::GetQualityModeScreenPercentage(int32(QualityMode)),
+			FrameMilliseconds,
+			0.75f);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNSSCalibrationTest,
+	"ArmNG.UnitTests.NSS.Calibration",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext
+		| EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter)
+
+bool FNSSCalibrationTest::RunTest(const FString& Parameters)
+{
+	// The percentile of the timed frames, which a single slow frame doesn't decide.
+	const NSSCalibrationMeasurement Balanced = MeasureRecorded(ENSSQualityMode::Balanced, 4.0);
+	TestEqual(TEXT("Timed frames"), Balanced.NumFrames, 9);
+	TestEqual(TEXT("Percentile"), Balanced.Milliseconds, 4.0 * 1.02, 1e-9);
+	TestEqual(TEXT("Untimed"), MeasureNSSCalibrationTimings(1, 50.0f, {0.0, -1.0}, 0.9f).NumFrames, 0);
+
+	TArray<NSSCalibrationMeasurement> Measurements = {MeasureRecorded(ENSSQualityMode::Quality, 5.2),
+		Balanced,
+		MeasureRecorded(ENSSQualityMode::Performance, 3.1),
+		MeasureRecorded(ENSSQualityMode::UltraPerformance, 2.0)};
+	TestEqual(
+		TEXT("Best that fits"), ChooseNSSCalibrationQualityMode(Measurements, 4.5), int32(ENSSQualityMode::Balanced));
+	TestEqual(TEXT("Highest"), ChooseNSSCalibrationQualityMode(Measurements, 8.0), int32(ENSSQualityMode::Quality));
+	TestEqual(TEXT("Nothing fits"),
+		ChooseNSSCalibrationQualityMode(Measurements, 1.0),
+		int32(ENSSQualityMode::UltraPerformance));
+	Measurements[0].NumFrames = 0;
+	TestEqual(TEXT("Unmeasured mode skipped"),
+		ChooseNSSCalibrationQualityMode(Measurements, 8.0),
+		int32(ENSSQualityMode::Balanced));
+	TestEqual(TEXT("Nothing measured"), ChooseNSSCalibrationQualityMode({}, 8.0), int32(ENSSQualityMode::Custom));
+
+	// Records round trip through the config string, keeping the time of each measured mode.
+	NSSCalibrationRecord Record;
+	Record.QualityMode = ChooseNSSCalibrationQualityMode(Measurements, 4.5);
+	Record.TargetMilliseconds = 4.5;
+	Record.Measurements = Measurements;
+	NSSCalibrationRecord Parsed;
+	TestTrue(TEXT("Parse"), ParseNSSCalibrationRecord(Record.ToString(), Parsed));
+	TestEqual(TEXT("Quality mode"), Parsed.QualityMode, Record.QualityMode);
+	TestEqual(TEXT("Target"), Parsed.TargetMilliseconds, 4.5, 1e-6);
+	TestEqual(TEXT("Measured modes"), Parsed.Measurements.Num(), 3);
+	TestEqual(TEXT("Measured mode"), Parsed.Measurements[0].QualityMode, int32(ENSSQualityMode::Balanced));
+	TestEqual(TEXT("Measured time"), Parsed.Measurements[0].Milliseconds, Balanced.Milliseconds, 1e-3);
+	TestEqual(TEXT("Same choice"),
+		ChooseNSSCalibrationQualityMode(Parsed.Measurements, 4.5),
+		int32(ENSSQualityMode::Balanced));
+	TestFalse(TEXT("Malformed"), ParseNSSCalibrationRecord(TEXT("TargetMs=4.0"), Parsed));
+
+	TestEqual(TEXT("Device key"),
+		MakeNSSCalibrationDeviceKey(TEXT(" Mali-G715 (r0p1) "), TEXT("v1.r46p0=1")),
+		FString(TEXT("Mali-G715__r0p1__v1.r46p0_1")));
+	TestNotEqual(TEXT("Driver in key"),
+		MakeNSSCalibrationDeviceKey(TEXT("Mali-G715"), TEXT("46.0")),
+		MakeNSSCalibrationDeviceKey(TEXT("Mali-G715"), TEXT("47.0")));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNSSCalibrationReplayTest,
+	"ArmNG.UnitTests.NSS.Calibration.Replay",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext
+		| EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter)
+
+bool FNSSCalibrationReplayTest::RunTest(const FString& Parameters)
+{
+	// Only runs where the upscaler uses the CPU backend, e.g. with -nullrhi.
+	NSSModule* Module = FModuleManager::GetModulePtr<NSSModule>(TEXT("NSS"));
+	NSS* Upscaler = Module ? Module->GetNSSUpscaler() : nullptr;
+	if (!Upscaler || Upscaler->GetApi() != EFFXBackendAPI::CPU)
+	{
+		AddInfo(TEXT("Skipped as the upscaler isn't using the CPU backend"));
+		return true;
+	}
+
+	NSSCalibrationSettings Settings;
+	Settings.OutputSize = FIntPoint(64, 32);
+	Settings.WarmupFrames = 1;
+	Settings.Frames = 4;
+	const TArray<NSSCalibrationMeasurement> Measurements = MeasureNSSCalibration(*Upscaler, Settings);
+	TestEqual(TEXT("Quality modes"), Measurements.Num(), 4);
+	for (const NSSCalibrationMeasurement& Measurement : Measurements)
+	{
+		TestEqual(TEXT("Frames"), Measurement.NumFrames, Settings.Frames);
+		TestTrue(TEXT("Timed"), Measurement.Milliseconds > 0.0);
+	}
+	TestTrue(TEXT("Quality first"), Measurements[0].ScreenPercentage > Measurements[3].ScreenPercentage);
+
+	const std::atomic<bool> bCancel = true;
+	Settings.Cancel = &bCancel;
+	TestEqual(TEXT("Cancelled"), MeasureNSSCalibration(*Upscaler, Settings).Num(), 0);
+	return true;
+}
+
+#endif
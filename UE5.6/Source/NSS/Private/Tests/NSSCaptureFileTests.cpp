@@ -0,0 +1,127 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HAL/FileManager.h"
+#include "Math/Float16.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "NSSCapture.h"
+#include "NSSReplay.h"
+
+namespace
+{
+	FString GetCapturePath(const TCHAR* Name)
+	{
+		return FPaths::Combine(FPaths::AutomationTransientDir(), Name);
+	}
+
+	float GetMaxDifference(const NSSReference::FImage& A, const NSSReference::FImage& B)
+	{
+		float MaxDifference = A.Texels.Num() == B.Texels.Num() ? 0.0f : MAX_flt;
+		for (int32 Index = 0; Index < FMath::Min(A.Texels.Num(), B.Texels.Num()); Index++)
+		{
+			MaxDifference = FMath::Max(MaxDifference, FMath::Abs(A.Texels[Index] - B.Texels[Index]));
+		}
+		return MaxDifference;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNSSCaptureFileTest,
+	"ArmNG.UnitTests.NSS.Capture.File",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext
+		| EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter)
+
+bool FNSSCaptureFileTest::RunTest(const FString& Parameters)
+{
+	NSSReplaySequence Sequence = MakeSyntheticNSSReplaySequence(FIntPoint(64, 32), FIntPoint(128, 64), 10, 0);
+	// A prepared frame with a history, as r.NSS.Capture writes them.
+	NSSReplayFrame& Prepared = Sequence.Frames[7];
+	Prepared.bPrepared = true;
+	Prepared.HistoryColor.Init(FIntPoint(128, 64), 4, 0.25f);
+	Prepared.HistoryDepth.Init(FIntPoint(64, 32), 1, 0.5f);
+
+	const FString Path = GetCapturePath(TEXT("NSSCaptureFileTest.nsscap"));
+	NSSCaptureSettings Settings;
+	Settings.KeyframeInterval = 4;
+	TestTrue(TEXT("Save"), SaveNSSReplaySequence(Path, Sequence, Settings));
+
+	// Half floats with deltas, compressed, are much smaller than the images.
+	int64 ImageBytes = 0;
+	for (const NSSReplayFrame& Frame : Sequence.Frames)
+	{
+		ImageBytes += (Frame.Color.Texels.Num() + Frame.Depth.Texels.Num() + Frame.Velocity.Texels.Num()
+						  + Frame.HistoryColor.Texels.Num() + Frame.HistoryDepth.Texels.Num())
+					  * sizeof(float);
+	}
+	const int64 FileBytes = IFileManager::Get().FileSize(*Path);
+	TestTrue(TEXT("Compact"), FileBytes > 0 && FileBytes * 4 < ImageBytes);
+
+	NSSCaptureReader Reader;
+	FString Error;
+	TestTrue(TEXT("Open"), Reader.Open(Path, Error));
+	TestEqual(TEXT("Name"), Reader.GetName(), Sequence.Name);
+	TestEqual(TEXT("Frames"), Reader.GetNumFrames(), Sequence.Frames.Num());
+
+	// Frames can be read in any order, decoding from their keyframe.
+	for (int32 Index : {6, 2, 3, 9, 0, 7})
+	{
+		NSSReplayFrame Frame;
+		TestTrue(*FString::Printf(TEXT("Read %d"), Index), Reader.ReadFrame(Index, Frame, Error));
+		const NSSReplayFrame& Expected = Sequence.Frames[Index];
+		TestTrue(TEXT("Jitter"), Frame.JitterPixels == Expected.JitterPixels);
+		TestTrue(TEXT("Prepared"), Frame.bPrepared == Expected.bPrepared);
+		TestTrue(TEXT("Colour as halves"), GetMaxDifference(Frame.Color, Expected.Color) < 1e-3f);
+		TestTrue(TEXT("Velocity as halves"), GetMaxDifference(Frame.Velocity, Expected.Velocity) < 1e-3f);
+		TestTrue(TEXT("Depth exact"), Frame.Depth.Texels == Expected.Depth.Texels);
+		TestEqual(TEXT("History"), Frame.HistoryColor.Texels.Num(), Expected.HistoryColor.Texels.Num());
+	}
+	Reader = NSSCaptureReader();
+
+	// A truncated file has no index.
+	TArray<uint8> Bytes;
+	FFileHelper::LoadFileToArray(Bytes, *Path);
+	Bytes.SetNum(Bytes.Num() / 2);
+	FFileHelper::SaveArrayToFile(Bytes, *Path);
+	NSSCaptureReader Truncated;
+	TestFalse(TEXT("Truncated"), Truncated.Open(Path, Error));
+	Truncated = NSSCaptureReader();
+	IFileManager::Get().Delete(*Path);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNSSCaptureTexelsTest,
+	"ArmNG.UnitTests.NSS.Capture.Texels",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext
+		| EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter)
+
+bool FNSSCaptureTexelsTest::RunTest(const FString& Parameters)
+{
+	TestFalse(TEXT("Depth stencil"), IsNSSCaptureFormatSupported(PF_DepthStencil));
+
+	// R11G11B10: 1.0 is an exponent of 15 with no mantissa, 0.5 an exponent of 14.
+	const uint32 Packed = (15u << 6) | ((14u << 6) << 11) | ((16u << 5) << 22);
+	uint32 Texels[2] = {Packed, 0};
+	NSSReference::FImage Image;
+	TestTrue(TEXT("R11G11B10"),
+		DecodeNSSCaptureTexels(PF_FloatR11G11B10, reinterpret_cast<const uint8*>(Texels), 2, FIntPoint(1, 1), Image));
+	TestEqual(TEXT("R"), Image.At(0, 0)[0], 1.0f);
+	TestEqual(TEXT("G"), Image.At(0, 0)[1], 0.5f);
+	TestEqual(TEXT("B"), Image.At(0, 0)[2], 2.0f);
+
+	// Rows are RowPitchInPixels apart.
+	FFloat16 Halves[4 * 3];
+	for (int32 Index = 0; Index < UE_ARRAY_COUNT(Halves); Index++)
+	{
+		Halves[Index] = FFloat16(float(Index));
+	}
+	TestTrue(TEXT("G16R16F"),
+		DecodeNSSCaptureTexels(PF_G16R16F, reinterpret_cast<const uint8*>(Halves), 3, FIntPoint(2, 2), Image));
+	TestEqual(TEXT("Second row"), Image.At(1, 1)[0], 8.0f);
+	TestEqual(TEXT("Second channel"), Image.At(1, 1)[1], 9.0f);
+	return true;
+}
+
+#endif
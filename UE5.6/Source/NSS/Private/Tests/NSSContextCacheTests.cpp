@@ -0,0 +1,205 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Async/Async.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "NSSContextCache.h"
+#include "NSSTestBackend.h"
+
+namespace
+{
+	// NSS states are RHI resources that may be deleted after the test returns, so the backend has to outlive them.
+	NSSTestBackend& GetTestBackend()
+	{
+		static NSSTestBackend Backend;
+		return Backend;
+	}
+
+	ffxApiCreateContextDescNss MakeParams(int32 RenderWidth, int32 RenderHeight, float Ratio = 2.0f)
+	{
+		ffxApiCreateContextDescNss Params;
+		FMemory::Memzero(Params);
+		Params.header.type = FFX_API_CREATE_CONTEXT_DESC_TYPE_NSS;
+		Params.flags = FFX_API_NSS_CONTEXT_FLAG_QUANTIZED;
+		Params.maxRenderSize.width = RenderWidth;
+		Params.maxRenderSize.height = RenderHeight;
+		Params.maxUpscaleSize.width = uint32(RenderWidth * Ratio);
+		Params.maxUpscaleSize.height = uint32(RenderHeight * Ratio);
+		return Params;
+	}
+
+	NSSStateRef MakeState(const ffxApiCreateContextDescNss& Params, uint32 ViewID, uint64 Frame)
+	{
+		NSSStateRef State = new NSSState(&GetTestBackend());
+		FMemory::Memcpy(State->Params, Params);
+		GetTestBackend().ffxCreateContext(&State->Nss, &State->Params.header);
+		State->ViewID = ViewID;
+		State->LastUsedFrame = Frame;
+		State->GPUSizeBytes = uint64(Params.maxRenderSize.width) * Params.maxRenderSize.height;
+		return State;
+	}
+
+	struct FReleaseStressResults
+	{
+		double Milliseconds = 0.0;
+		uint64 LockContentions = 0;
+		int32 NumCached = 0;
+	};
+
+	// Many threads release their views' contexts over and over, as histories dropped on other threads do, while
+	// this thread looks contexts up as the render thread would. With bLockFree the releases go through Release rather
+	// than Add.
+	FReleaseStressResults StressRelease(bool bLockFree)
+	{
+		constexpr int32 NumThreads = 8;
+		constexpr int32 NumStatesPerThread = 4;
+		constexpr int32 NumReleasesPerThread = 20000;
+		NSSContextCache Cache;
+		TArray<TArray<NSSStateRef>> States;
+		for (int32 Thread = 0; Thread < NumThreads; Thread++)
+		{
+			TArray<NSSStateRef>& ThreadStates = States.AddDefaulted_GetRef();
+			for (int32 Index = 0; Index < NumStatesPerThread; Index++)
+			{
+				ThreadStates.Add(MakeState(MakeParams(320 + Index * 8, 180), uint32(Thread), 0));
+			}
+		}
+
+		std::atomic<int32> NumRunning{NumThreads};
+		const double StartSeconds = FPlatformTime::Seconds();
+		TArray<TFuture<void>> Releasers;
+		for (int32 Thread = 0; Thread < NumThreads; Thread++)
+		{
+			Releasers.Add(Async(EAsyncExecution::Thread,
+				[&Cache, &NumRunning, &ThreadStates = States[Thread], bLockFree]()
+				{
+					for (int32 Index = 0; Index < NumReleasesPerThread; Index++)
+					{
+						const NSSStateRef& State = ThreadStates[Index % NumStatesPerThread];
+						if (bLockFree)
+						{
+							Cache.Release(State);
+						}
+						else
+						{
+							Cache.Add(State);
+						}
+					}
+					NumRunning--;
+				}));
+		}
+		for (uint64 Frame = 1; NumRunning > 0; Frame++)
+		{
+			Cache.AddReleased();
+			Cache.Find(MakeParams(320, 180), uint32(Frame % NumThreads), Frame);
+		}
+		for (TFuture<void>& Releaser : Releasers)
+		{
+			Releaser.Wait();
+		}
+
+		FReleaseStressResults Results;
+		Results.Milliseconds = (FPlatformTime::Seconds() - StartSeconds) * 1000.0;
+		Results.LockContentions = Cache.GetStats().LockContentions;
+		// Only the cache should be left referencing the contexts, each of them once.
+		States.Empty();
+		Cache.Trim(MAX_int32, MAX_uint64);
+		Results.NumCached = Cache.GetStats().NumCached;
+		return Results;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNSSContextCacheReuseTest,
+	"ArmNG.UnitTests.NSS.ContextCache.Reuse",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext
+		| EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter)
+
+bool FNSSContextCacheReuseTest::RunTest(const FString& Parameters)
+{
+	NSSContextCache Cache;
+	const ffxApiCreateContextDescNss Params1080p = MakeParams(960, 544);
+	const ffxApiCreateContextDescNss Params1440p = MakeParams(1280, 720);
+
+	NSSStateRef Released = MakeState(Params1080p, 1, 10);
+	Cache.Add(Released);
+	Cache.Add(Released);
+	TestTrue(TEXT("Not reused during the frame it was last used"), Cache.Find(Params1080p, 1, 10) == nullptr);
+	TestTrue(TEXT("Not reused while a history still holds it"), Cache.Find(Params1080p, 1, 11) == nullptr);
+
+	NSSState* ReleasedPtr = Released.GetReference();
+	Released.SafeRelease();
+	TestTrue(TEXT("Not reused for different parameters"), Cache.Find(Params1440p, 1, 11) == nullptr);
+	TestTrue(TEXT("Not reused by another view"), Cache.Find(Params1080p, 2, 11) == nullptr);
+	NSSStateRef Found = Cache.Find(Params1080p, 1, 11);
+	TestTrue(TEXT("Reused for the same view and parameters"), Found.GetReference() == ReleasedPtr);
+	TestTrue(TEXT("Taken out of the cache"), Cache.Find(Params1080p, 1, 12) == nullptr);
+
+	const NSSContextCacheStats Stats = Cache.GetStats();
+	TestEqual(TEXT("Lookups"), Stats.Lookups, uint64(6));
+	TestEqual(TEXT("Hits"), Stats.Hits, uint64(1));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNSSContextCacheEvictionTest,
+	"ArmNG.UnitTests.NSS.ContextCache.Eviction",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext
+		| EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter)
+
+bool FNSSContextCacheEvictionTest::RunTest(const FString& Parameters)
+{
+	NSSContextCache Cache;
+	// Resizing an editor viewport releases a context per size.
+	for (int32 Frame = 0; Frame < 4; Frame++)
+	{
+		Cache.Add(MakeState(MakeParams(640 + Frame * 8, 360), 1, Frame));
+	}
+
+	Cache.Trim(2, MAX_uint64);
+	NSSContextCacheStats Stats = Cache.GetStats();
+	TestEqual(TEXT("Count budget"), Stats.NumCached, 2);
+	TestEqual(TEXT("Evictions"), Stats.Evictions, uint64(2));
+	TestTrue(TEXT("The least recently used are evicted"), Cache.Find(MakeParams(640, 360), 1, 10) == nullptr);
+	TestTrue(TEXT("The most recently used are kept"), Cache.Find(MakeParams(664, 360), 1, 10) != nullptr);
+
+	Cache.Add(MakeState(MakeParams(1920, 1080), 1, 5));
+	Cache.Trim(8, uint64(1920 * 1080));
+	Stats = Cache.GetStats();
+	TestEqual(TEXT("Memory budget"), Stats.CachedBytes, uint64(1920 * 1080));
+	TestTrue(TEXT("The most recently used is kept"), Cache.Find(MakeParams(1920, 1080), 1, 10) != nullptr);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNSSContextCacheConcurrentReleaseTest,
+	"ArmNG.UnitTests.NSS.ContextCache.ConcurrentRelease",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext
+		| EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter)
+
+bool FNSSContextCacheConcurrentReleaseTest::RunTest(const FString& Parameters)
+{
+	const FReleaseStressResults Locked = StressRelease(false);
+	const FReleaseStressResults LockFree = StressRelease(true);
+	AddInfo(FString::Printf(TEXT("Add: %.2fms with %llu lock contentions, Release: %.2fms with %llu"),
+		Locked.Milliseconds,
+		Locked.LockContentions,
+		LockFree.Milliseconds,
+		LockFree.LockContentions));
+	TestEqual(TEXT("Contexts added"), Locked.NumCached, 32);
+	TestEqual(TEXT("Contexts released"), LockFree.NumCached, 32);
+	// Only the looking up thread takes the lock.
+	TestEqual(TEXT("Release doesn't contend"), LockFree.LockContentions, uint64(0));
+
+	// Released contexts are found once added, and not while queued with a reference of their own.
+	NSSContextCache Cache;
+	const ffxApiCreateContextDescNss Params = MakeParams(960, 544);
+	NSSStateRef State = MakeState(Params, 1, 1);
+	NSSState* Released = State.GetReference();
+	Cache.Release(MoveTemp(State));
+	TestEqual(TEXT("Queued with a reference"), int32(Released->GetRefCount()), 1);
+	TestTrue(TEXT("Found after being added"), Cache.Find(Params, 1, 2).GetReference() == Released);
+	return true;
+}
+
+#endif
@@ -0,0 +1,128 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Misc/ScopeExit.h"
+#include "NSSContextFactory.h"
+#include "NSSTestBackend.h"
+
+namespace
+{
+	// NSS states are RHI resources that may be deleted after the test returns, so the backend has to outlive them.
+	NSSTestBackend& GetTestBackend()
+	{
+		static NSSTestBackend Backend;
+		return Backend;
+	}
+
+	ffxApiCreateContextDescNss MakeParams(const NSSContextSizes& Sizes)
+	{
+		ffxApiCreateContextDescNss Params;
+		FMemory::Memzero(Params);
+		Params.header.type = FFX_API_CREATE_CONTEXT_DESC_TYPE_NSS;
+		Params.flags = FFX_API_NSS_CONTEXT_FLAG_QUANTIZED;
+		Params.maxRenderSize.width = Sizes.PaddedInputSize.X;
+		Params.maxRenderSize.height = Sizes.PaddedInputSize.Y;
+		Params.maxUpscaleSize.width = Sizes.PaddedOutputSize.X;
+		Params.maxUpscaleSize.height = Sizes.PaddedOutputSize.Y;
+		return Params;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNSSContextPredictionTest,
+	"ArmNG.UnitTests.NSS.ContextFactory.Prediction",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext
+		| EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter)
+
+bool FNSSContextPredictionTest::RunTest(const FString& Parameters)
+{
+	// 545 pads to 552 and is then upscaled by 2.
+	NSSContextSizes Sizes = GetNssContextSizes(FIntPoint(960, 545), 2.0f);
+	TestTrue(TEXT("Padded input"), Sizes.PaddedInputSize == FIntPoint(960, 552));
+	TestTrue(TEXT("Padded output"), Sizes.PaddedOutputSize == FIntPoint(1920, 1104));
+
+	NSSContextPrediction Prediction;
+	Prediction.OutputSize = FIntPoint(1920, 1080);
+	Prediction.ScreenPercentage = 50.0f;
+	Sizes = PredictNssContextSizes(Prediction);
+	TestTrue(TEXT("Screen percentage input"), Sizes.PaddedInputSize == FIntPoint(960, 544));
+	TestTrue(TEXT("Screen percentage output"), Sizes.PaddedOutputSize == FIntPoint(1920, 1088));
+
+	// The view size is rounded up before padding, 640.5 to 641 and 360.5 to 361.
+	Prediction.OutputSize = FIntPoint(1281, 721);
+	Sizes = PredictNssContextSizes(Prediction);
+	TestTrue(TEXT("Rounded input"), Sizes.PaddedInputSize == FIntPoint(648, 368));
+
+	// Dynamic resolution runs at its upper bound after a drop in load, which is when a hitch is most visible.
+	Prediction.OutputSize = FIntPoint(1920, 1080);
+	Prediction.bDynamicResolution = true;
+	Prediction.MaxResolutionFraction = 0.75f;
+	Sizes = PredictNssContextSizes(Prediction);
+	TestTrue(TEXT("Dynamic resolution input"), Sizes.PaddedInputSize == FIntPoint(1440, 816));
+	TestTrue(TEXT("Dynamic resolution output"), Sizes.PaddedOutputSize == FIntPoint(2880, 1632));
+
+	// With r.NSS.DynamicResolution the context covers every render size down to the minimum fraction.
+	Prediction.bDynamicResolutionContext = true;
+	Sizes = PredictNssContextSizes(Prediction);
+	TestTrue(TEXT("Dynamic resolution context input"), Sizes.PaddedInputSize == FIntPoint(1440, 816));
+	TestTrue(TEXT("Dynamic resolution context output"), Sizes.PaddedOutputSize == FIntPoint(1948, 1108));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNSSContextPrecreationTest,
+	"ArmNG.UnitTests.NSS.ContextFactory.Precreation",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext
+		| EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter)
+
+bool FNSSContextPrecreationTest::RunTest(const FString& Parameters)
+{
+	NSSTestBackend& Backend = GetTestBackend();
+	// Much slower than the requests themselves, so anything waiting for a creation shows up in the timings.
+	constexpr float CreateDelaySeconds = 0.2f;
+	Backend.CreateDelaySeconds = CreateDelaySeconds;
+	ON_SCOPE_EXIT
+	{
+		Backend.CreateDelaySeconds = 0.0f;
+	};
+
+	const ffxApiCreateContextDescNss Params1080p = MakeParams(GetNssContextSizes(FIntPoint(960, 540), 2.0f));
+	const ffxApiCreateContextDescNss Params1440p = MakeParams(GetNssContextSizes(FIntPoint(1280, 720), 2.0f));
+	const int32 NumCreatedBefore = Backend.NumCreated;
+
+	NSSContextCache Cache;
+	NSSContextFactory Factory;
+	const double RequestStartTime = FPlatformTime::Seconds();
+	Factory.Request(&Backend, Params1080p);
+	Factory.Request(&Backend, Params1080p);
+	Factory.Request(&Backend, Params1440p);
+	TestTrue(TEXT("Requests don't wait for the creation"),
+		FPlatformTime::Seconds() - RequestStartTime < CreateDelaySeconds);
+	TestTrue(TEXT("Requested"), Factory.IsPending(Params1080p) && Factory.IsPending(Params1440p));
+	TestEqual(TEXT("Duplicate requests are ignored"), Factory.GetStats().NumPending, 2);
+
+	// A view needing a context that is still being created waits for it rather than creating another.
+	NSSStateRef Taken = Factory.TakePending(Params1440p);
+	TestTrue(TEXT("Taken"), Taken.IsValid() && !IsNssContextParamsChanged(Taken->Params, Params1440p));
+	TestFalse(TEXT("No longer pending"), Factory.IsPending(Params1440p));
+	TestTrue(TEXT("Nothing else to take"), Factory.TakePending(Params1440p) == nullptr);
+
+	Factory.Wait();
+	Factory.Flush(Cache, 10);
+	TestFalse(TEXT("Flushed"), Factory.IsPending(Params1080p));
+	TestEqual(TEXT("Each context is created once"), Backend.NumCreated - NumCreatedBefore, 2);
+
+	// Precreated contexts can be used by any view.
+	NSSStateRef Found = Cache.Find(Params1080p, 7, 11);
+	TestTrue(TEXT("Found in the cache"), Found.IsValid());
+
+	const NSSContextFactoryStats Stats = Factory.GetStats();
+	TestEqual(TEXT("Requests"), Stats.Requests, uint64(2));
+	TestEqual(TEXT("Created"), Stats.Created, uint64(2));
+	TestEqual(TEXT("Failed"), Stats.Failed, uint64(0));
+	TestEqual(TEXT("Pending"), Stats.NumPending, 0);
+	return true;
+}
+
+#endif
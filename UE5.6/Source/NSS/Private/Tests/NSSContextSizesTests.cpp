@@ -0,0 +1,128 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "NSSContextSizes.h"
+
+namespace
+{
+	const FIntPoint OutputSize(1920, 1080);
+	constexpr float MinResolutionFraction = 0.25f;
+
+	NSSContextSizes GetTargetSizes(float MaxResolutionFraction)
+	{
+		const FIntPoint MaxInputSize(FMath::CeilToInt(OutputSize.X * MaxResolutionFraction),
+			FMath::CeilToInt(OutputSize.Y * MaxResolutionFraction));
+		return GetNssDynamicResolutionContextSizes(MaxInputSize, OutputSize, MinResolutionFraction);
+	}
+
+	NSSContextSizes GetFrameSizes(float ResolutionFraction)
+	{
+		const FIntPoint InputSize(FMath::CeilToInt(OutputSize.X * ResolutionFraction),
+			FMath::CeilToInt(OutputSize.Y * ResolutionFraction));
+		return GetNssDynamicResolutionFrameSizes(InputSize, OutputSize);
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNSSDynamicResolutionSizesTest,
+	"ArmNG.UnitTests.NSS.DynamicResolution.Sizes",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext
+		| EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter)
+
+bool FNSSDynamicResolutionSizesTest::RunTest(const FString& Parameters)
+{
+	// The output padding follows this frame's ratio rather than r.ScreenPercentage.
+	const NSSContextSizes Frame = GetNssDynamicResolutionFrameSizes(FIntPoint(1000, 563), OutputSize);
+	TestTrue(TEXT("Frame input"), Frame.PaddedInputSize == FIntPoint(1000, 568));
+	TestTrue(TEXT("Frame output"), Frame.PaddedOutputSize == FIntPoint(1920, 1090));
+
+	// Up to 7 texels of padding upscaled by up to 4.
+	const NSSContextSizes Target = GetTargetSizes(0.75f);
+	TestTrue(TEXT("Context input"), Target.PaddedInputSize == FIntPoint(1440, 816));
+	TestTrue(TEXT("Context output"), Target.PaddedOutputSize == FIntPoint(1948, 1108));
+
+	// Every frame dynamic resolution can pick runs in the context.
+	for (float Fraction = MinResolutionFraction; Fraction <= 0.75f; Fraction += 0.01f)
+	{
+		if (!Target.Contains(GetFrameSizes(Fraction)))
+		{
+			AddError(FString::Printf(TEXT("A frame at %.2f doesn't fit"), Fraction));
+			break;
+		}
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNSSDynamicResolutionHysteresisTest,
+	"ArmNG.UnitTests.NSS.DynamicResolution.Hysteresis",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext
+		| EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter)
+
+bool FNSSDynamicResolutionHysteresisTest::RunTest(const FString& Parameters)
+{
+	NSSDynamicResolutionSettings Settings;
+	Settings.Headroom = 0.1f;
+	Settings.ResizeDelayFrames = 4;
+	int32 FramesOutOfBounds = 0;
+
+	// The first context is sized for the bounds, without headroom.
+	NSSContextSizes Target = GetTargetSizes(0.75f);
+	NSSContextSizes Current = UpdateNssDynamicResolutionContextSizes(
+		NSSContextSizes(), GetFrameSizes(0.5f), Target, Settings, FramesOutOfBounds);
+	TestTrue(TEXT("Created for the bounds"), Current == Target);
+
+	// Changes of the render size within the bounds never recreate it.
+	for (int32 Frame = 0; Frame < 100; Frame++)
+	{
+		const float Fraction = 0.5f + 0.25f * (Frame % 10) / 9.0f;
+		if (!(UpdateNssDynamicResolutionContextSizes(
+				  Current, GetFrameSizes(Fraction), Target, Settings, FramesOutOfBounds)
+				== Current))
+		{
+			AddError(FString::Printf(TEXT("Recreated for a frame at %.2f"), Fraction));
+			break;
+		}
+	}
+
+	// Raised bounds are only followed once they have settled, with headroom.
+	Target = GetTargetSizes(0.8f);
+	for (int32 Frame = 1; Frame < Settings.ResizeDelayFrames; Frame++)
+	{
+		TestTrue(TEXT("Kept while the bounds settle"),
+			UpdateNssDynamicResolutionContextSizes(Current, GetFrameSizes(0.7f), Target, Settings, FramesOutOfBounds)
+				== Current);
+	}
+	Current =
+		UpdateNssDynamicResolutionContextSizes(Current, GetFrameSizes(0.7f), Target, Settings, FramesOutOfBounds);
+	TestTrue(TEXT("Grown with headroom"), Current.PaddedInputSize == FIntPoint(1696, 952));
+
+	// Bounds that go back within the context's sizes reset the delay.
+	Target = GetTargetSizes(0.5f);
+	for (int32 Frame = 1; Frame < Settings.ResizeDelayFrames; Frame++)
+	{
+		UpdateNssDynamicResolutionContextSizes(Current, GetFrameSizes(0.5f), Target, Settings, FramesOutOfBounds);
+	}
+	TestTrue(TEXT("Back within bounds"),
+		UpdateNssDynamicResolutionContextSizes(
+			Current, GetFrameSizes(0.8f), GetTargetSizes(0.8f), Settings, FramesOutOfBounds)
+			== Current);
+	TestEqual(TEXT("Delay reset"), FramesOutOfBounds, 0);
+
+	// Lowered bounds release the memory once settled, without headroom.
+	for (int32 Frame = 0; Frame < Settings.ResizeDelayFrames; Frame++)
+	{
+		Current =
+			UpdateNssDynamicResolutionContextSizes(Current, GetFrameSizes(0.5f), Target, Settings, FramesOutOfBounds);
+	}
+	TestTrue(TEXT("Shrunk to the bounds"), Current == Target);
+
+	// A frame that doesn't fit recreates the context immediately.
+	Current =
+		UpdateNssDynamicResolutionContextSizes(Current, GetFrameSizes(0.6f), Target, Settings, FramesOutOfBounds);
+	TestTrue(TEXT("Grown immediately"), Current.PaddedInputSize == FIntPoint(1272, 720));
+	return true;
+}
+
+#endif
@@ -0,0 +1,126 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "NSSGPUTimer.h"
+
+namespace
+{
+	//-------------------------------------------------------------------------------------
+	// Timestamps the test writes itself, standing in for the GPU.
+	//-------------------------------------------------------------------------------------
+	class NSSFakeTimestampSource final : public INSSGPUTimestampSource
+	{
+	public:
+		uint32 AllocateTimestamp() override
+		{
+			const uint32 Timestamp = ++NextTimestamp;
+			Timestamps.Add(Timestamp, TOptional<uint64>());
+			return Timestamp;
+		}
+
+		void WriteTimestamp(FRHICommandListImmediate& RHICmdList, uint32 Timestamp) override
+		{}
+
+		bool ReadTimestamp(uint32 Timestamp, uint64& OutMicroseconds) override
+		{
+			const TOptional<uint64>* Value = Timestamps.Find(Timestamp);
+			if (!Value || !Value->IsSet())
+			{
+				return false;
+			}
+			OutMicroseconds = Value->GetValue();
+			return true;
+		}
+
+		void ReleaseTimestamp(uint32 Timestamp) override
+		{
+			Timestamps.Remove(Timestamp);
+		}
+
+		void Write(uint32 Timestamp, uint64 Microseconds)
+		{
+			Timestamps.FindChecked(Timestamp) = Microseconds;
+		}
+
+		void Write(const NSSGPUTimer::FStageTimestamps& Stage, uint64 BeginMicroseconds, uint64 Microseconds)
+		{
+			Write(Stage.Begin, BeginMicroseconds);
+			Write(Stage.End, BeginMicroseconds + Microseconds);
+		}
+
+		int32 GetNumAllocated() const
+		{
+			return Timestamps.Num();
+		}
+
+	private:
+		TMap<uint32, TOptional<uint64>> Timestamps;
+		uint32 NextTimestamp = 0;
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNSSGPUTimerTest,
+	"ArmNG.UnitTests.NSS.GPUTimer",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext
+		| EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter)
+
+bool FNSSGPUTimerTest::RunTest(const FString& Parameters)
+{
+	NSSFakeTimestampSource* Source = new NSSFakeTimestampSource();
+	NSSGPUTimer Timer{TUniquePtr<INSSGPUTimestampSource>(Source)};
+
+	// Two views in frame 10, one of which times its input preparation in two parts.
+	Timer.AddView(10);
+	Timer.AddView(10);
+	const NSSGPUTimer::FStageTimestamps Prepare1 = Timer.AddStage(10, ENSSGPUStage::InputPreparation);
+	const NSSGPUTimer::FStageTimestamps Prepare2 = Timer.AddStage(10, ENSSGPUStage::InputPreparation);
+	const NSSGPUTimer::FStageTimestamps Dispatch1 = Timer.AddStage(10, ENSSGPUStage::Dispatch);
+	const NSSGPUTimer::FStageTimestamps Dispatch2 = Timer.AddStage(10, ENSSGPUStage::Dispatch);
+	const NSSGPUTimer::FStageTimestamps Crop = Timer.AddStage(10, ENSSGPUStage::OutputCrop);
+	NGSharedDispatchTimings DispatchTimings;
+	DispatchTimings.InputPreparationMicroseconds = 100;
+	DispatchTimings.InferenceMicroseconds = 1500;
+	DispatchTimings.OutputResolveMicroseconds = 200;
+	Timer.AddDispatchTimings(10, DispatchTimings);
+
+	// Nothing is published until every stage of the frame has been read back.
+	Source->Write(Prepare1, 1000, 250);
+	Source->Write(Prepare2, 2000, 250);
+	Source->Write(Dispatch1, 3000, 2000);
+	Timer.Update(12);
+	TestEqual(TEXT("Incomplete frame"), Timer.GetLatestTimings().Frame, uint64(0));
+
+	Source->Write(Dispatch2, 6000, 1500);
+	Source->Write(Crop, 8000, 100);
+	Timer.Update(13);
+	NSSGPUTimings Timings = Timer.GetLatestTimings();
+	TestEqual(TEXT("Frame"), Timings.Frame, uint64(10));
+	TestEqual(TEXT("Views"), Timings.NumViews, 2);
+	TestEqual(TEXT("Input preparation"), Timings.GetMilliseconds(ENSSGPUStage::InputPreparation), 0.5);
+	TestEqual(TEXT("Dispatch"), Timings.GetMilliseconds(ENSSGPUStage::Dispatch), 3.5);
+	TestEqual(TEXT("Inference"), Timings.GetMilliseconds(ENSSGPUStage::DispatchInference), 1.5);
+	TestEqual(TEXT("Output crop"), Timings.GetMilliseconds(ENSSGPUStage::OutputCrop), 0.1);
+	TestEqual(TEXT("Sub-stages aren't counted twice"), Timings.GetTotalMilliseconds(), 4.1);
+	TestEqual(TEXT("Timestamps released"), Source->GetNumAllocated(), 0);
+
+	// A frame with a timestamp that is never written is dropped rather than published as faster than it was.
+	const NSSGPUTimer::FStageTimestamps Lost = Timer.AddStage(20, ENSSGPUStage::Dispatch);
+	Source->Write(Lost.Begin, 1000);
+	Source->Write(Timer.AddStage(21, ENSSGPUStage::Dispatch), 5000, 1000);
+	Timer.Update(20 + NSSGPUTimer::MaxPendingFrames);
+	Timings = Timer.GetLatestTimings();
+	TestEqual(TEXT("Next complete frame"), Timings.Frame, uint64(21));
+	TestEqual(TEXT("Next complete frame's dispatch"), Timings.GetMilliseconds(ENSSGPUStage::Dispatch), 1.0);
+	TestEqual(TEXT("Lost timestamps released"), Source->GetNumAllocated(), 0);
+
+	// Late dispatch timings for a frame that has already been published are ignored.
+	Timer.AddDispatchTimings(21, DispatchTimings);
+	Timer.Update(40);
+	TestEqual(TEXT("Published frames are final"), Timer.GetLatestTimings().Frame, uint64(21));
+	return true;
+}
+
+#endif
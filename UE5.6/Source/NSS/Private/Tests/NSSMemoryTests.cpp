@@ -0,0 +1,70 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "Misc/ScopeExit.h"
+#include "NSSHistory.h"
+#include "NSSTestBackend.h"
+
+namespace
+{
+	// NSS states are RHI resources that may be deleted after the test returns, so the backend has to outlive them.
+	NSSTestBackend& GetTestBackend()
+	{
+		static NSSTestBackend Backend;
+		return Backend;
+	}
+
+	NSSStateRef MakeState(int32 RenderWidth, int32 RenderHeight)
+	{
+		NSSStateRef State = new NSSState(&GetTestBackend());
+		FMemory::Memzero(State->Params);
+		State->Params.header.type = FFX_API_CREATE_CONTEXT_DESC_TYPE_NSS;
+		State->Params.maxRenderSize.width = RenderWidth;
+		State->Params.maxRenderSize.height = RenderHeight;
+		State->Params.maxUpscaleSize.width = RenderWidth * 2;
+		State->Params.maxUpscaleSize.height = RenderHeight * 2;
+		GetTestBackend().ffxCreateContext(&State->Nss, &State->Params.header);
+		return State;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNSSContextMemoryTest,
+	"ArmNG.UnitTests.NSS.Memory.Contexts",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext
+		| EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter)
+
+bool FNSSContextMemoryTest::RunTest(const FString& Parameters)
+{
+	NSSTestBackend& Backend = GetTestBackend();
+	ON_SCOPE_EXIT
+	{
+		Backend.GPUMemoryUsageBytes = 0;
+		Backend.GPUScratchUsageBytes = 0;
+	};
+
+	// Without the query extension the size is estimated from the context's sizes.
+	NSSStateRef State = MakeState(960, 540);
+	State->UpdateGPUSizeBytes();
+	TestTrue(TEXT("Estimated"), State->bGPUSizeEstimated);
+	TestEqual(TEXT("Estimate"), State->GPUSizeBytes, EstimateNssContextSizeBytes(State->Params));
+	TestEqual(TEXT("No scratch estimate"), State->GPUScratchSizeBytes, uint64(0));
+
+	// Backends that support it report what the context allocated.
+	Backend.GPUMemoryUsageBytes = 48 * 1024 * 1024;
+	Backend.GPUScratchUsageBytes = 16 * 1024 * 1024;
+	State->UpdateGPUSizeBytes();
+	TestFalse(TEXT("Reported"), State->bGPUSizeEstimated);
+	TestEqual(TEXT("Reported size"), State->GPUSizeBytes, Backend.GPUMemoryUsageBytes);
+	TestEqual(TEXT("Reported scratch"), State->GPUScratchSizeBytes, Backend.GPUScratchUsageBytes);
+
+	// A history without textures yet only accounts for its context.
+	TRefCountPtr<NSSHistory> History = new NSSHistory(State, nullptr);
+	TestEqual(TEXT("No history textures"), History->GetTextureSizeBytes(), uint64(0));
+	TestEqual(TEXT("History size"), History->GetGPUSizeBytes(), Backend.GPUMemoryUsageBytes);
+	return true;
+}
+
+#endif
@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "NSSAllocationCounter.h"
+#include "NSSObjectPool.h"
+
+namespace
+{
+	struct FPooledObject
+	{
+		uint64 Payload[8];
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNSSObjectPoolTest,
+	"ArmNG.UnitTests.NSS.ObjectPool",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext
+		| EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter)
+
+bool FNSSObjectPoolTest::RunTest(const FString& Parameters)
+{
+	TNSSObjectPool<FPooledObject> Pool(2);
+	TestEqual(TEXT("Preallocated"), Pool.GetStats().NumFree, 2);
+
+	// Freed blocks are handed out again.
+	void* First = Pool.Allocate();
+	Pool.Free(First);
+	TestTrue(TEXT("Reused"), Pool.Allocate() == First);
+
+	// The pool grows while more objects are live than it has blocks for.
+	void* Second = Pool.Allocate();
+	void* Third = Pool.Allocate();
+	TestTrue(TEXT("Distinct"), First != Second && Second != Third && First != Third);
+	NSSObjectPoolStats Stats = Pool.GetStats();
+	TestEqual(TEXT("Misses"), int32(Stats.Misses), 1);
+	TestEqual(TEXT("Blocks"), Stats.NumBlocks, 3);
+	TestEqual(TEXT("None free"), Stats.NumFree, 0);
+	Pool.Free(First);
+	Pool.Free(Second);
+	Pool.Free(Third);
+	TestEqual(TEXT("All free"), Pool.GetStats().NumFree, 3);
+
+	// Once grown, frames that need no more blocks than before don't allocate.
+	if (NSSScopedAllocationCounter::IsAvailable())
+	{
+		NSSAllocationCounts Counts;
+		{
+			NSSScopedAllocationCounter Counter;
+			for (int32 Frame = 0; Frame < 4; Frame++)
+			{
+				void* Blocks[3] = {Pool.Allocate(), Pool.Allocate(), Pool.Allocate()};
+				for (void* Block : Blocks)
+				{
+					Pool.Free(Block);
+				}
+			}
+			Counts = Counter.GetCounts();
+		}
+		TestEqual(TEXT("Steady state allocations"), int32(Counts.GetTotal()), 0);
+	}
+	TestEqual(TEXT("Steady state misses"), int32(Pool.GetStats().Misses), 1);
+	return true;
+}
+
+#endif
@@ -0,0 +1,152 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "NSSQualityGovernor.h"
+
+namespace
+{
+	// A GPU whose frame time is FixedMilliseconds plus PixelMilliseconds scaled by the number of pixels rendered, with
+	// uniform noise of +/- Noise of it. Each frame's time is measured two frames after it was rendered.
+	struct FSyntheticGPU
+	{
+		double FixedMilliseconds = 4.0;
+		double PixelMilliseconds = 40.0;
+		float Noise = 0.0f;
+		int32 Seed = 0;
+
+		double GetMilliseconds(float Fraction) const
+		{
+			return FixedMilliseconds + PixelMilliseconds * Fraction * Fraction;
+		}
+	};
+
+	struct FTraceResult
+	{
+		float Fraction = 0.0f;
+		int32 Adjustments = 0;
+		// Adjustments in the opposite direction to the one before.
+		int32 Reversals = 0;
+		int32 LastAdjustmentFrame = -1;
+	};
+
+	FTraceResult RunTrace(NSSQualityGovernor& Governor,
+		const NSSQualityGovernorSettings& Settings,
+		const FSyntheticGPU& GPU,
+		int32 Frames)
+	{
+		FRandomStream Random(GPU.Seed);
+		TArray<float> Rendered = {Governor.GetFraction(), Governor.GetFraction()};
+		FTraceResult Result;
+		int32 LastDirection = 0;
+		for (int32 Frame = 0; Frame < Frames; Frame++)
+		{
+			const double Milliseconds = GPU.GetMilliseconds(Rendered[Rendered.Num() - 2])
+										* (1.0 + GPU.Noise * (2.0 * Random.GetFraction() - 1.0));
+			const float Previous = Governor.GetFraction();
+			const float Fraction = Governor.Update(Milliseconds, Settings);
+			if (Fraction != Previous)
+			{
+				const int32 Direction = Fraction > Previous ? 1 : -1;
+				Result.Reversals += LastDirection != 0 && Direction != LastDirection ? 1 : 0;
+				LastDirection = Direction;
+				Result.LastAdjustmentFrame = Frame;
+			}
+			Rendered.Add(Fraction);
+		}
+		Result.Fraction = Governor.GetFraction();
+		Result.Adjustments = Governor.GetNumAdjustments();
+		return Result;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNSSQualityGovernorTest,
+	"ArmNG.UnitTests.NSS.QualityGovernor",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext
+		| EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter)
+
+bool FNSSQualityGovernorTest::RunTest(const FString& Parameters)
+{
+	NSSQualityGovernorSettings Settings;
+	const double UpperBand = Settings.BudgetMilliseconds * (1.0 + Settings.Hysteresis);
+
+	// Over budget at the highest fraction: lowered until the frame time is back within the band, then left alone.
+	{
+		FSyntheticGPU GPU;
+		NSSQualityGovernor Governor(Settings.MaxFraction);
+		const FTraceResult Result = RunTrace(Governor, Settings, GPU, 600);
+		TestTrue(TEXT("Over budget lowered"), Result.Fraction < Settings.MaxFraction);
+		TestTrue(TEXT("Over budget within band"), GPU.GetMilliseconds(Result.Fraction) <= UpperBand);
+		TestTrue(TEXT("Over budget settled"), Result.LastAdjustmentFrame < 300);
+		TestEqual(TEXT("Over budget reversals"), Result.Reversals, 0);
+	}
+
+	// Well under budget at the lowest fraction: raised up to the highest.
+	{
+		FSyntheticGPU GPU;
+		GPU.FixedMilliseconds = 2.0;
+		GPU.PixelMilliseconds = 10.0;
+		NSSQualityGovernor Governor(Settings.MinFraction);
+		const FTraceResult Result = RunTrace(Governor, Settings, GPU, 600);
+		TestEqual(TEXT("Under budget raised"), Result.Fraction, Settings.MaxFraction);
+		TestEqual(TEXT("Under budget reversals"), Result.Reversals, 0);
+	}
+
+	// A raise stops at the bottom of the band rather than going past the budget.
+	{
+		FSyntheticGPU GPU;
+		NSSQualityGovernor Governor(Settings.MinFraction);
+		const FTraceResult Result = RunTrace(Governor, Settings, GPU, 600);
+		TestTrue(TEXT("Raised"), Result.Fraction > Settings.MinFraction);
+		TestTrue(TEXT("Raised within budget"), GPU.GetMilliseconds(Result.Fraction) <= Settings.BudgetMilliseconds);
+		TestEqual(TEXT("Raise reversals"), Result.Reversals, 0);
+	}
+
+	// A budget that can't be met stays at the lowest fraction.
+	{
+		FSyntheticGPU GPU;
+		GPU.FixedMilliseconds = 30.0;
+		NSSQualityGovernor Governor(Settings.MaxFraction);
+		const FTraceResult Result = RunTrace(Governor, Settings, GPU, 600);
+		TestEqual(TEXT("Impossible budget"), Result.Fraction, Settings.MinFraction);
+		TestTrue(TEXT("Impossible budget settled"), Result.LastAdjustmentFrame < 300);
+	}
+
+	// Noisy frame times just over the band at the highest fraction don't make the fraction oscillate.
+	for (int32 Seed = 0; Seed < 8; Seed++)
+	{
+		FSyntheticGPU GPU;
+		GPU.PixelMilliseconds = 32.0;
+		GPU.Noise = 0.2f;
+		GPU.Seed = Seed;
+		NSSQualityGovernor Governor(Settings.MaxFraction);
+		const FTraceResult Result = RunTrace(Governor, Settings, GPU, 1200);
+		TestTrue(FString::Printf(TEXT("Noisy trace %d reversals"), Seed), Result.Reversals <= 1);
+		TestTrue(FString::Printf(TEXT("Noisy trace %d adjustments"), Seed), Result.Adjustments <= 3);
+	}
+
+	// Frames without a GPU time change nothing.
+	{
+		NSSQualityGovernor Governor(0.5f);
+		for (int32 Frame = 0; Frame < 100; Frame++)
+		{
+			Governor.Update(0.0, Settings);
+		}
+		TestEqual(TEXT("No timings"), Governor.GetFraction(), 0.5f);
+		TestEqual(TEXT("No timings adjustments"), Governor.GetNumAdjustments(), 0);
+	}
+
+	// Narrower bounds clamp the fraction straight away.
+	{
+		NSSQualityGovernor Governor(Settings.MaxFraction);
+		NSSQualityGovernorSettings Narrower = Settings;
+		Narrower.MaxFraction = 0.5f;
+		TestEqual(TEXT("Clamped to new bounds"), Governor.Update(Settings.BudgetMilliseconds, Narrower), 0.5f);
+	}
+	return true;
+}
+
+#endif
@@ -0,0 +1,427 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "NSSReference.h"
+
+namespace
+{
+	using namespace NSSReference;
+
+	void FillRandom(FImage& Image, FRandomStream& Random, float Min, float Max)
+	{
+		for (float& Texel : Image.Texels)
+		{
+			Texel = Random.FRandRange(Min, Max);
+		}
+	}
+
+	// Builds a velocity image where roughly half the pixels have no encoded velocity (x == 0) so that both the
+	// decode and the static (camera) velocity paths are exercised.
+	void FillVelocity(FImage& Image, FRandomStream& Random)
+	{
+		for (int32 Y = 0; Y < Image.Size.Y; Y++)
+		{
+			for (int32 X = 0; X < Image.Size.X; X++)
+			{
+				const bool bHasVelocity = Random.FRand() > 0.5f;
+				Image.Store(FIntPoint(X, Y),
+					FVector4f(bHasVelocity ? Random.FRandRange(0.1f, 0.9f) : 0.0f, Random.FRand(), 0.0f, 0.0f));
+			}
+		}
+	}
+
+	bool ImagesEqual(FAutomationTestBase& Test, const TCHAR* What, const FImage& A, const FImage& B)
+	{
+		if (A.Size != B.Size)
+		{
+			Test.AddError(
+				FString::Printf(TEXT("%s: size mismatch %s vs %s"), What, *A.Size.ToString(), *B.Size.ToString()));
+			return false;
+		}
+		for (int32 Y = 0; Y < A.Size.Y; Y++)
+		{
+			for (int32 X = 0; X < A.Size.X; X++)
+			{
+				const FVector4f ValueA = A.Load(FIntPoint(X, Y));
+				const FVector4f ValueB = B.Load(FIntPoint(X, Y));
+				if (!ValueA.Equals(ValueB, 0.0f))
+				{
+					Test.AddError(FString::Printf(TEXT("%s: mismatch at (%d, %d): %s vs %s"),
+						What,
+						X,
+						Y,
+						*ValueA.ToString(),
+						*ValueB.ToString()));
+					return false;
+				}
+			}
+		}
+		return true;
+	}
+
+	// Runs the current two-pass preparation (mirror pad then convert velocity) and the fused kernel on the same
+	// inputs and checks the outputs handed to the SDK are identical.
+	bool CompareTwoPassAndFused(FAutomationTestBase& Test, FIntPoint TextureSize, FIntRect ViewRect, int32 Seed)
+	{
+		FRandomStream Random(Seed);
+		FImage Color, Depth, Velocity;
+		Color.Init(TextureSize, 4);
+		Depth.Init(TextureSize, 1);
+		Velocity.Init(TextureSize, 2);
+		FillRandom(Color, Random, 0.0f, 4.0f);
+		FillRandom(Depth, Random, 0.0f, 1.0f);
+		FillVelocity(Velocity, Random);
+
+		FPrepareInputsParams Params;
+		Params.InputViewRect = ViewRect;
+		Params.PaddedSize = FIntPoint(Align(ViewRect.Width(), 8), Align(ViewRect.Height(), 8));
+		Params.ClipToPrevClip = FMatrix44f(FTranslationMatrix(FVector(0.01, -0.02, 0.0)));
+
+		FImage PaddedColor, PaddedDepth, PaddedVelocity, MotionVectors;
+		MirrorPad(Color, Depth, Velocity, Params, PaddedColor, PaddedDepth, PaddedVelocity);
+		ConvertVelocity(PaddedDepth, PaddedVelocity, Params, MotionVectors);
+
+		FImage FusedColor, FusedDepth, FusedMotionVectors;
+		PrepareInputs(Color, Depth, Velocity, Params, FusedColor, FusedDepth, FusedMotionVectors);
+
+		bool bOk = ImagesEqual(Test, TEXT("Color"), PaddedColor, FusedColor);
+		bOk &= ImagesEqual(Test, TEXT("Depth"), PaddedDepth, FusedDepth);
+		bOk &= ImagesEqual(Test, TEXT("MotionVectors"), MotionVectors, FusedMotionVectors);
+		return bOk;
+	}
+
+	// Pads in place inside a texture with room for the padding and checks the padded region matches the copies.
+	bool ComparePaddedCopyAndInPlace(FAutomationTestBase& Test, FIntPoint TextureSize, FIntPoint ViewSize, int32 Seed)
+	{
+		FRandomStream Random(Seed);
+		FImage Color, Depth, Velocity;
+		Color.Init(TextureSize, 4);
+		Depth.Init(TextureSize, 1);
+		Velocity.Init(TextureSize, 2);
+		FillRandom(Color, Random, 0.0f, 4.0f);
+		FillRandom(Depth, Random, 0.0f, 1.0f);
+		FillVelocity(Velocity, Random);
+
+		FPrepareInputsParams Params;
+		Params.InputViewRect = FIntRect(FIntPoint::ZeroValue, ViewSize);
+		Params.PaddedSize = FIntPoint(Align(ViewSize.X, 8), Align(ViewSize.Y, 8));
+		Params.ClipToPrevClip = FMatrix44f(FTranslationMatrix(FVector(-0.03, 0.01, 0.0)));
+
+		FImage PaddedColor, PaddedDepth, MotionVectors;
+		PrepareInputs(Color, Depth, Velocity, Params, PaddedColor, PaddedDepth, MotionVectors);
+
+		FImage InPlaceMotionVectors;
+		// A narrow strip so the border wraps over several rows.
+		PrepareInputsInPlace(Color, Depth, Velocity, Params, 16, InPlaceMotionVectors);
+
+		bool bOk = ImagesEqual(Test, TEXT("MotionVectors"), MotionVectors, InPlaceMotionVectors);
+		for (int32 Y = 0; Y < Params.PaddedSize.Y && bOk; Y++)
+		{
+			for (int32 X = 0; X < Params.PaddedSize.X && bOk; X++)
+			{
+				const FIntPoint Pos(X, Y);
+				bOk &= Test.TestTrue(FString::Printf(TEXT("Color at (%d, %d)"), X, Y),
+					Color.Load(Pos).Equals(PaddedColor.Load(Pos), 0.0f));
+				bOk &= Test.TestTrue(FString::Printf(TEXT("Depth at (%d, %d)"), X, Y),
+					Depth.Load(Pos).Equals(PaddedDepth.Load(Pos), 0.0f));
+			}
+		}
+		return bOk;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNSSMirrorCoordinateTest,
+	"ArmNG.UnitTests.NSS.MirrorCoordinate",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext
+		| EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter)
+
+bool FNSSMirrorCoordinateTest::RunTest(const FString& Parameters)
+{
+	// 545 wide pads to 552: the first padding column reflects 543, not 544, so the edge texel is not duplicated.
+	TestEqual(TEXT("Inside the view"), MirrorCoordinate(10, 545), 10);
+	TestEqual(TEXT("Last texel"), MirrorCoordinate(544, 545), 544);
+	TestEqual(TEXT("First padding texel"), MirrorCoordinate(545, 545), 543);
+	TestEqual(TEXT("Last padding texel"), MirrorCoordinate(551, 545), 537);
+	TestEqual(TEXT("Degenerate view"), MirrorCoordinate(3, 1), 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNSSFusedInputPreparationTest,
+	"ArmNG.UnitTests.NSS.FusedInputPreparation",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext
+		| EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter)
+
+bool FNSSFusedInputPreparationTest::RunTest(const FString& Parameters)
+{
+	// Already a multiple of 8: nothing is mirrored, only motion vectors differ from the inputs.
+	CompareTwoPassAndFused(*this, FIntPoint(32, 16), FIntRect(0, 0, 32, 16), 1);
+	// Padding on both axes.
+	CompareTwoPassAndFused(*this, FIntPoint(27, 19), FIntRect(0, 0, 27, 19), 2);
+	// The view is a sub-rect of a larger texture, as happens in the editor and with split screen.
+	CompareTwoPassAndFused(*this, FIntPoint(64, 48), FIntRect(12, 5, 57, 36), 3);
+	return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNSSInPlacePaddingTest,
+	"ArmNG.UnitTests.NSS.InPlacePadding",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext
+		| EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter)
+
+bool FNSSInPlacePaddingTest::RunTest(const FString& Parameters)
+{
+	// Padding on both axes, with the corner.
+	ComparePaddedCopyAndInPlace(*this, FIntPoint(40, 32), FIntPoint(27, 19), 4);
+	// Padding on one axis only.
+	ComparePaddedCopyAndInPlace(*this, FIntPoint(64, 24), FIntPoint(61, 24), 5);
+	ComparePaddedCopyAndInPlace(*this, FIntPoint(16, 40), FIntPoint(16, 33), 6);
+	return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNSSStereoReprojectTest,
+	"ArmNG.UnitTests.NSS.StereoReproject",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext
+		| EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter)
+
+bool FNSSStereoReprojectTest::RunTest(const FString& Parameters)
+{
+	FRandomStream Random(7);
+	FStereoReprojectParams Params;
+	Params.InputSize = FIntPoint(8, 4);
+	Params.OutputSize = FIntPoint(16, 8);
+	FImage PrimaryOutput, Depth, SecondaryColor;
+	PrimaryOutput.Init(Params.OutputSize, 4);
+	FillRandom(PrimaryOutput, Random, 0.0f, 1.0f);
+	Depth.Init(Params.InputSize, 1, 0.5f);
+	SecondaryColor.Init(Params.InputSize, 4, 0.25f);
+
+	// The secondary eye sees Shift output texels further left than the primary eye, which it has to fill in from
+	// its own render. Coincident eyes see the same surfaces, so the output is the primary eye's.
+	FImage Output;
+	for (const int32 Shift : {0, 4})
+	{
+		Params.SecondaryClipToPrimaryClip.M[3][0] = -2.0f * Shift / Params.OutputSize.X;
+		TestEqual(FString::Printf(TEXT("Disoccluded with a shift of %d"), Shift),
+			ReprojectStereo(PrimaryOutput, Depth, SecondaryColor, Depth, Params, Output),
+			Shift * Params.OutputSize.Y);
+		for (int32 Y = 0; Y < Params.OutputSize.Y; Y++)
+		{
+			for (int32 X = 0; X < Params.OutputSize.X; X++)
+			{
+				const FVector4f Expected =
+					X < Shift ? FVector4f(0.25f, 0.25f, 0.25f, 0.25f) : PrimaryOutput.Load(FIntPoint(X - Shift, Y));
+				if (!Output.Load(FIntPoint(X, Y)).Equals(Expected, 1e-4f))
+				{
+					AddError(FString::Printf(TEXT("Shift of %d: mismatch at (%d, %d)"), Shift, X, Y));
+					return false;
+				}
+			}
+		}
+	}
+
+	// The primary eye sees a nearer surface everywhere, so nothing can be reused.
+	FImage NearDepth;
+	NearDepth.Init(Params.InputSize, 1, 0.75f);
+	Params.SecondaryClipToPrimaryClip = FMatrix44f::Identity;
+	TestEqual(TEXT("Occluded disoccluded"),
+		ReprojectStereo(PrimaryOutput, NearDepth, SecondaryColor, Depth, Params, Output),
+		Params.OutputSize.X * Params.OutputSize.Y);
+
+	// A padded output is filled to its edge.
+	FImage PaddedOutput;
+	PaddedOutput.Init(Params.OutputSize + FIntPoint(8, 8), 4);
+	ReprojectStereo(PrimaryOutput, Depth, SecondaryColor, Depth, Params, PaddedOutput);
+	TestEqual(TEXT("Padded size"), PaddedOutput.Size, Params.OutputSize + FIntPoint(8, 8));
+	TestTrue(TEXT("Padding from the edge"),
+		PaddedOutput.Load(PaddedOutput.Size - FIntPoint(1, 1))
+			.Equals(PrimaryOutput.Load(Params.OutputSize - FIntPoint(1, 1)), 1e-4f));
+	return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNSSSparseTilesTest,
+	"ArmNG.UnitTests.NSS.SparseTiles",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext
+		| EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter)
+
+bool FNSSSparseTilesTest::RunTest(const FString& Parameters)
+{
+	// A still frame of 4x4 tiles.
+	const FIntPoint Size(32, 32);
+	FImage Color, Depth, MotionVectors;
+	Color.Init(Size, 4, 0.5f);
+	Depth.Init(Size, 1, 0.5f);
+	MotionVectors.Init(Size, 2);
+	FTileClassifyParams Params;
+	FTileClassification Previous, Tiles;
+	ClassifyTiles(Color, Depth, MotionVectors, nullptr, Params, Previous);
+	TestEqual(TEXT("Tiles"), Previous.NumTiles, FIntPoint(4, 4));
+	TestEqual(TEXT("Everything changed without a previous frame"), Previous.NumActive, 16);
+	ClassifyTiles(Color, Depth, MotionVectors, &Previous.Features, Params, Tiles);
+	TestEqual(TEXT("Still frame changed"), Tiles.NumChanged, 0);
+	TestEqual(TEXT("Still frame active"), Tiles.NumActive, 0);
+
+	// Something moving a texel in tile (1, 1) activates it and the tiles around it.
+	FImage Moving = MotionVectors;
+	Moving.Store(FIntPoint(10, 10), FVector4f(1.0f / Size.X, 0.0f, 0.0f, 0.0f));
+	ClassifyTiles(Color, Depth, Moving, &Previous.Features, Params, Tiles);
+	TestEqual(TEXT("Moving changed"), Tiles.NumChanged, 1);
+	TestEqual(TEXT("Moving active"), Tiles.NumActive, 9);
+	TestTrue(TEXT("Halo"), Tiles.IsActive(FIntPoint(2, 2)) && !Tiles.IsActive(FIntPoint(3, 3)));
+	Params.HaloTiles = 0;
+	ClassifyTiles(Color, Depth, Moving, &Previous.Features, Params, Tiles);
+	TestEqual(TEXT("Moving active without a halo"), Tiles.NumActive, 1);
+	Params.HaloTiles = 1;
+
+	// A tile getting brighter or nearer without moving, e.g. lighting or a disocclusion, past the thresholds only.
+	FImage Brighter = Color;
+	for (int32 Y = 24; Y < 32; Y++)
+	{
+		for (int32 X = 24; X < 32; X++)
+		{
+			Brighter.Store(FIntPoint(X, Y), FVector4f(0.6f, 0.6f, 0.6f, 1.0f));
+		}
+	}
+	ClassifyTiles(Brighter, Depth, MotionVectors, &Previous.Features, Params, Tiles);
+	TestEqual(TEXT("Brighter changed"), Tiles.NumChanged, 1);
+	TestEqual(TEXT("Brighter active in the corner"), Tiles.NumActive, 4);
+	FImage Dimmer = Color;
+	Dimmer.Store(FIntPoint(0, 0), FVector4f(0.4f, 0.4f, 0.4f, 1.0f));
+	ClassifyTiles(Dimmer, Depth, MotionVectors, &Previous.Features, Params, Tiles);
+	TestEqual(TEXT("Luma within the threshold"), Tiles.NumChanged, 0);
+	FImage Nearer = Depth;
+	for (int32 Y = 24; Y < 32; Y++)
+	{
+		for (int32 X = 0; X < 8; X++)
+		{
+			Nearer.Store(FIntPoint(X, Y), FVector4f(0.51f, 0.0f, 0.0f, 0.0f));
+		}
+	}
+	ClassifyTiles(Color, Nearer, MotionVectors, &Previous.Features, Params, Tiles);
+	TestEqual(TEXT("Nearer changed"), Tiles.NumChanged, 1);
+	TestTrue(TEXT("Nearer tile"), Tiles.Changed[3 * Tiles.NumTiles.X] != 0);
+
+	// Larger tiles, which don't have to divide the size, and features of another size aren't compared with.
+	Params.TileSize = 16;
+	FImage Wide;
+	Wide.Init(FIntPoint(40, 24), 4, 0.5f);
+	FImage WideDepth, WideMotion;
+	WideDepth.Init(Wide.Size, 1, 0.5f);
+	WideMotion.Init(Wide.Size, 2);
+	ClassifyTiles(Wide, WideDepth, WideMotion, &Previous.Features, Params, Tiles);
+	TestEqual(TEXT("Partial tiles"), Tiles.NumTiles, FIntPoint(3, 2));
+	TestEqual(TEXT("Other size changed"), Tiles.NumChanged, 6);
+	Previous = Tiles;
+	ClassifyTiles(Wide, WideDepth, WideMotion, &Previous.Features, Params, Tiles);
+	TestEqual(TEXT("Partial tiles still"), Tiles.NumChanged, 0);
+	Params.TileSize = 8;
+
+	// The output of the inactive tiles is the history, upscaled twice here so each tile covers 16x16 output texels.
+	Params.HaloTiles = 0;
+	ClassifyTiles(Color, Depth, MotionVectors, nullptr, Params, Previous);
+	ClassifyTiles(Color, Depth, Moving, &Previous.Features, Params, Tiles);
+	FImage History, Output;
+	History.Init(Size * 2, 4, 1.0f);
+	Output.Init(Size * 2, 4, 0.0f);
+	TestEqual(TEXT("Carried forward"), ComposeTiles(Tiles, Params.TileSize, Size, History, Output), 64 * 64 - 16 * 16);
+	TestEqual(TEXT("Active tile kept"), Output.Load(FIntPoint(16, 31)).X, 0.0f);
+	TestEqual(TEXT("Inactive tile carried"), Output.Load(FIntPoint(32, 16)).X, 1.0f);
+	TestEqual(TEXT("Inactive tile carried before"), Output.Load(FIntPoint(15, 16)).X, 1.0f);
+	return !HasAnyErrors();
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNSSRegionOfInterestTest,
+	"ArmNG.UnitTests.NSS.RegionOfInterest",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext
+		| EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter)
+
+bool FNSSRegionOfInterestTest::RunTest(const FString& Parameters)
+{
+	// A region at the centre of the view with a radius of 8 output texels and a feather of 8 more.
+	const FIntPoint OutputSize(64, 32);
+	const FIntPoint InputSize = OutputSize / 2;
+	NSSRegionOfInterest Region;
+	Region.Radius = 0.25f;
+	Region.Feather = 0.25f;
+	TestEqual(TEXT("Centre"), GetRegionOfInterestWeight(Region, FVector2f(32.0f, 16.0f), OutputSize), 1.0f);
+	TestEqual(TEXT("Radius"), GetRegionOfInterestWeight(Region, FVector2f(40.0f, 16.0f), OutputSize), 1.0f);
+	TestEqual(TEXT("Feather"), GetRegionOfInterestWeight(Region, FVector2f(32.0f, 4.0f), OutputSize), 0.5f);
+	TestEqual(TEXT("Periphery"), GetRegionOfInterestWeight(Region, FVector2f(48.0f, 16.0f), OutputSize), 0.0f);
+
+	// The count by rows agrees with the weight of every texel, including regions partly outside the view.
+	auto CountTexels = [&OutputSize](const NSSRegionOfInterest& CountedRegion)
+	{
+		int32 NumTexels = 0;
+		for (int32 Y = 0; Y < OutputSize.Y; Y++)
+		{
+			for (int32 X = 0; X < OutputSize.X; X++)
+			{
+				const FVector2f Pos(X + 0.5f, Y + 0.5f);
+				NumTexels += GetRegionOfInterestWeight(CountedRegion, Pos, OutputSize) > 0.0f ? 1 : 0;
+			}
+		}
+		return NumTexels;
+	};
+	NSSRegionOfInterest Corner;
+	Corner.Center = FVector2f(0.9f, 0.1f);
+	Corner.Radius = 0.3f;
+	Corner.Feather = 0.2f;
+	NSSRegionOfInterest HardEdge = Region;
+	HardEdge.Feather = 0.0f;
+	NSSRegionOfInterest Empty;
+	Empty.Radius = 0.0f;
+	Empty.Feather = 0.0f;
+	NSSRegionOfInterest Covering;
+	Covering.Radius = 2.0f;
+	for (const NSSRegionOfInterest& Counted : {Region, Corner, HardEdge, Empty, Covering, NSSRegionOfInterest()})
+	{
+		TestEqual(TEXT("Network texels"), CountRegionOfInterestTexels(Counted, OutputSize), CountTexels(Counted));
+	}
+	TestEqual(TEXT("Empty region"), CountRegionOfInterestTexels(Empty, OutputSize), 0);
+	TestEqual(TEXT("Covering region"), CountRegionOfInterestTexels(Covering, OutputSize), OutputSize.X * OutputSize.Y);
+
+	// The network's output of 1 is kept within the region and blended with the periphery's 0.25 across the feather.
+	// The padding of the output takes its weight from the edge of the view.
+	FImage NetworkOutput, InputColor, Output;
+	NetworkOutput.Init(OutputSize + FIntPoint(8, 8), 4, 1.0f);
+	InputColor.Init(InputSize, 4, 0.25f);
+	TestEqual(TEXT("Blended network texels"),
+		BlendRegionOfInterest(NetworkOutput, InputColor, InputSize, OutputSize, Region, Output),
+		CountTexels(Region));
+	TestEqual(TEXT("Padded size"), Output.Size, NetworkOutput.Size);
+	for (int32 Y = 0; Y < OutputSize.Y; Y++)
+	{
+		for (int32 X = 0; X < OutputSize.X; X++)
+		{
+			const float Weight = GetRegionOfInterestWeight(Region, FVector2f(X + 0.5f, Y + 0.5f), OutputSize);
+			if (!FMath::IsNearlyEqual(Output.Load(FIntPoint(X, Y)).X, FMath::Lerp(0.25f, 1.0f, Weight), 1e-4f))
+			{
+				AddError(FString::Printf(TEXT("Blend mismatch at (%d, %d)"), X, Y));
+				return false;
+			}
+		}
+	}
+	TestEqual(TEXT("Kept"), Output.Load(FIntPoint(32, 16)).X, 1.0f);
+	TestEqual(TEXT("Upscaled"), Output.Load(FIntPoint(0, 0)).X, 0.25f);
+	TestTrue(TEXT("Padding from the edge"),
+		Output.Load(Output.Size - FIntPoint(1, 1)).Equals(Output.Load(OutputSize - FIntPoint(1, 1)), 1e-4f));
+
+	// The periphery is a bilinear upscale of the render, so a ramp across the render stays a ramp.
+	for (int32 X = 0; X < InputSize.X; X++)
+	{
+		for (int32 Y = 0; Y < InputSize.Y; Y++)
+		{
+			InputColor.Store(FIntPoint(X, Y), FVector4f(float(X), 0.0f, 0.0f, 1.0f));
+		}
+	}
+	TestEqual(TEXT("Empty blended network texels"),
+		BlendRegionOfInterest(NetworkOutput, InputColor, InputSize, OutputSize, Empty, Output),
+		0);
+	TestEqual(TEXT("Ramp"), Output.Load(FIntPoint(10, 5)).X, 4.75f);
+	TestEqual(TEXT("Ramp clamped"), Output.Load(FIntPoint(0, 5)).X, 0.0f);
+	return !HasAnyErrors();
+}
+
+#endif
@@ -0,0 +1,285 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+#include "NSS.h"
+#include "NSSAllocationCounter.h"
+#include "NSSModule.h"
+#include "NSSProxy.h"
+#include "NSSReplay.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNSSReplaySequenceTest,
+	"ArmNG.UnitTests.NSS.Replay.Sequence",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext
+		| EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter)
+
+bool FNSSReplaySequenceTest::RunTest(const FString& Parameters)
+{
+	const NSSReplaySequence Sequence = MakeSyntheticNSSReplaySequence(FIntPoint(16, 8), FIntPoint(32, 16), 6, 4);
+	TestEqual(TEXT("Frames"), Sequence.Frames.Num(), 6);
+	TestTrue(TEXT("Max input size"), Sequence.GetMaxInputSize() == FIntPoint(16, 8));
+	TestFalse(TEXT("First frame isn't a cut"), Sequence.Frames[0].bCameraCut);
+	TestTrue(TEXT("Cut"), Sequence.Frames[4].bCameraCut);
+	TestEqual(TEXT("Colour texels"), Sequence.Frames[0].Color.Texels.Num(), 16 * 8 * 4);
+	// The encoded velocity decodes to the pan of the pattern.
+	const FVector2f Velocity = NSSReference::DecodeVelocity(Sequence.Frames[1].Velocity.Load(FIntPoint(3, 3)));
+	TestEqual(TEXT("Velocity"), Velocity.X, 2.0f * 2.0f / 16.0f, 1e-3f);
+	TestEqual(TEXT("No vertical velocity"), Velocity.Y, 0.0f, 1e-3f);
+
+	const FString Path = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("NSSReplaySequenceTest.nsscap"));
+	TestTrue(TEXT("Save"), SaveNSSReplaySequence(Path, Sequence, NSSCaptureSettings::Lossless()));
+	NSSReplaySequence Loaded;
+	FString Error;
+	TestTrue(TEXT("Load"), LoadNSSReplaySequence(Path, Loaded, Error));
+	IFileManager::Get().Delete(*Path);
+	TestEqual(TEXT("Name"), Loaded.Name, Sequence.Name);
+	TestEqual(TEXT("Loaded frames"), Loaded.Frames.Num(), Sequence.Frames.Num());
+	TestTrue(TEXT("Cut roundtrip"), Loaded.Frames[4].bCameraCut);
+	TestTrue(TEXT("Jitter roundtrip"), Loaded.Frames[2].JitterPixels == Sequence.Frames[2].JitterPixels);
+	TestTrue(TEXT("Colour roundtrip"), Loaded.Frames[5].Color.Texels == Sequence.Frames[5].Color.Texels);
+
+	TestFalse(TEXT("Missing file"), LoadNSSReplaySequence(Path, Loaded, Error));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNSSReplayResultsTest,
+	"ArmNG.UnitTests.NSS.Replay.Results",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext
+		| EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter)
+
+bool FNSSReplayResultsTest::RunTest(const FString& Parameters)
+{
+	NSSReplayResults Results;
+	Results.SequenceName = TEXT("Test");
+	Results.BackendName = TEXT("CPU");
+	for (int32 Index = 0; Index < 4; Index++)
+	{
+		NSSReplayFrameResult& Frame = Results.Frames.AddDefaulted_GetRef();
+		Frame.Frame = Index;
+		Frame.CPUMilliseconds = double(Index + 1);
+		Frame.Allocations.Allocations = Index == 0 ? 10 : 0;
+		Frame.ContextCreations = Index == 0 ? 1 : 0;
+		Frame.bHistoryReset = Index == 0;
+	}
+	Results.Frames[3].GPUMilliseconds = 0.5;
+
+	const FString Json = Results.ToJson();
+	TestTrue(TEXT("Backend"), Json.Contains(TEXT("\"backend\": \"CPU\"")));
+	TestTrue(TEXT("Mean"), Json.Contains(TEXT("\"cpuMs\": {\"mean\": 2.5000")));
+	TestTrue(TEXT("Max"), Json.Contains(TEXT("\"max\": 4.0000")));
+	TestTrue(TEXT("Allocations"), Json.Contains(TEXT("\"allocations\": 10,")));
+	TestTrue(TEXT("Creations"), Json.Contains(TEXT("\"contextCreations\": 1,")));
+	TestTrue(TEXT("Frames without GPU timings"), Json.Contains(TEXT("\"gpuMs\": null}")));
+
+	TArray<FString> Lines;
+	Results.ToCsv().ParseIntoArrayLines(Lines);
+	TestEqual(TEXT("Rows"), Lines.Num(), 5);
+	TestTrue(TEXT("Header"), Lines[0].StartsWith(TEXT("Frame,CPUMs,")));
+	TestTrue(TEXT("First frame"), Lines[1].EndsWith(TEXT(",10,0,1,1,")));
+	TestTrue(TEXT("GPU time"), Lines[4].EndsWith(TEXT(",0.5000")));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNSSReplayTest,
+	"ArmNG.UnitTests.NSS.Replay.CPUBackend",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext
+		| EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter)
+
+bool FNSSReplayTest::RunTest(const FString& Parameters)
+{
+	// Only runs where the upscaler uses the CPU backend, e.g. with -nullrhi.
+	NSSModule* Module = FModuleManager::GetModulePtr<NSSModule>(TEXT("NSS"));
+	NSS* Upscaler = Module ? Module->GetNSSUpscaler() : nullptr;
+	if (!Upscaler || Upscaler->GetApi() != EFFXBackendAPI::CPU)
+	{
+		AddInfo(TEXT("Skipped as the upscaler isn't using the CPU backend"));
+		return true;
+	}
+
+	const NSSReplaySequence Sequence = MakeSyntheticNSSReplaySequence(FIntPoint(32, 16), FIntPoint(64, 32), 6, 4);
+	NSSReplayResults Results;
+	{
+		NSSReplayer Replayer(*Upscaler, *Upscaler->GetBackend(), Upscaler->GetApi());
+		Results = Replayer.Replay(Sequence, 1);
+	}
+	TestEqual(TEXT("Frames"), Results.Frames.Num(), 6);
+	TestEqual(TEXT("Backend"), Results.BackendName, FString(TEXT("CPU")));
+	// The warmup frame created the context, which the sequence keeps using and which the cut only resets.
+	int32 ContextCreations = 0;
+	for (const NSSReplayFrameResult& Frame : Results.Frames)
+	{
+		ContextCreations += Frame.ContextCreations;
+	}
+	TestEqual(TEXT("Context creations"), ContextCreations, 0);
+	TestTrue(TEXT("Cut resets"), Results.Frames[4].bHistoryReset);
+	TestFalse(TEXT("History kept"), Results.Frames[3].bHistoryReset);
+	TestTrue(TEXT("Timed"), Results.Frames[2].CPUMilliseconds > 0.0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNSSReplaySteadyStateTest,
+	"ArmNG.UnitTests.NSS.Replay.SteadyStateAllocations",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext
+		| EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter)
+
+bool FNSSReplaySteadyStateTest::RunTest(const FString& Parameters)
+{
+	NSSModule* Module = FModuleManager::GetModulePtr<NSSModule>(TEXT("NSS"));
+	NSS* Upscaler = Module ? Module->GetNSSUpscaler() : nullptr;
+	if (!Upscaler || Upscaler->GetApi() != EFFXBackendAPI::CPU || !NSSScopedAllocationCounter::IsAvailable())
+	{
+		AddInfo(TEXT("Skipped as the upscaler isn't using the CPU backend or allocations can't be counted"));
+		return true;
+	}
+
+	// Once the first frame has created the context and both frames' images exist, no frame should touch the heap,
+	// the camera cut included.
+	const NSSReplaySequence Sequence = MakeSyntheticNSSReplaySequence(FIntPoint(32, 16), FIntPoint(64, 32), 8, 5);
+	NSSReplayResults Results;
+	{
+		NSSReplayer Replayer(*Upscaler, *Upscaler->GetBackend(), Upscaler->GetApi());
+		Replayer.SetCountAllocations(true);
+		Results = Replayer.Replay(Sequence, 2, 2);
+	}
+	TestEqual(TEXT("Frames"), Results.Frames.Num(), 16);
+	for (const NSSReplayFrameResult& Frame : Results.Frames)
+	{
+		if (Frame.Allocations.GetTotal() != 0)
+		{
+			AddError(FString::Printf(TEXT("Frame %d made %llu allocations and %llu reallocations"),
+				Frame.Frame,
+				Frame.Allocations.Allocations,
+				Frame.Allocations.Reallocations));
+		}
+	}
+
+	// The view family proxies and their forks come from a pool too.
+	delete new NSSProxy(Upscaler);
+	NSSAllocationCounts Counts;
+	{
+		NSSScopedAllocationCounter Counter;
+		for (int32 Frame = 0; Frame < 4; Frame++)
+		{
+			NSSProxy* FamilyProxy = new NSSProxy(Upscaler);
+			NSSProxy* ForkedProxy = new NSSProxy(Upscaler);
+			delete FamilyProxy;
+			delete ForkedProxy;
+		}
+		Counts = Counter.GetCounts();
+	}
+	TestEqual(TEXT("Proxy allocations"), int32(Counts.GetTotal()), 0);
+	return true;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNSSReplayMultiViewTest,
+	"ArmNG.UnitTests.NSS.Replay.MultiView",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext
+		| EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter)
+
+bool FNSSReplayMultiViewTest::RunTest(const FString& Parameters)
+{
+	NSSModule* Module = FModuleManager::GetModulePtr<NSSModule>(TEXT("NSS"));
+	NSS* Upscaler = Module ? Module->GetNSSUpscaler() : nullptr;
+	if (!Upscaler || Upscaler->GetApi() != EFFXBackendAPI::CPU)
+	{
+		AddInfo(TEXT("Skipped as the upscaler isn't using the CPU backend"));
+		return true;
+	}
+
+	// Views of different sizes replayed concurrently each keep their own context once the warmup has created them.
+	const NSSReplaySequence Sequences[] = {
+		MakeSyntheticNSSReplaySequence(FIntPoint(32, 16), FIntPoint(64, 32), 6, 0),
+		MakeSyntheticNSSReplaySequence(FIntPoint(16, 8), FIntPoint(32, 16), 6, 0),
+		MakeSyntheticNSSReplaySequence(FIntPoint(32, 16), FIntPoint(64, 32), 3, 0),
+	};
+	const NSSMultiViewReplayResults Results =
+		ReplayNSSViews(*Upscaler, *Upscaler->GetBackend(), Upscaler->GetApi(), Sequences, 1, 2, true);
+	TestTrue(TEXT("Parallel"), Results.bParallel);
+	TestEqual(TEXT("Frames"), Results.FrameMilliseconds.Num(), 12);
+	TestEqual(TEXT("Views"), Results.Views.Num(), 3);
+	for (const NSSReplayResults& View : Results.Views)
+	{
+		TestEqual(TEXT("Frames of each view"), View.Frames.Num(), 12);
+		int32 ContextCreations = 0;
+		for (const NSSReplayFrameResult& Frame : View.Frames)
+		{
+			ContextCreations += Frame.ContextCreations;
+		}
+		TestEqual(TEXT("Views don't take each other's contexts"), ContextCreations, 0);
+	}
+	TestTrue(TEXT("Summarised"), Results.ToJson().Contains(TEXT("\"perView\"")));
+
+	// Batching the views' dispatches gives the same frames, with the same contexts.
+	const NSSMultiViewReplayResults BatchedResults =
+		ReplayNSSViews(*Upscaler, *Upscaler->GetBackend(), Upscaler->GetApi(), Sequences, 1, 2, true, true);
+	TestTrue(TEXT("Batched"), BatchedResults.bBatched);
+	TestEqual(TEXT("Batched frames"), BatchedResults.FrameMilliseconds.Num(), 12);
+	for (const NSSReplayResults& View : BatchedResults.Views)
+	{
+		TestEqual(TEXT("Frames of each batched view"), View.Frames.Num(), 12);
+		for (const NSSReplayFrameResult& Frame : View.Frames)
+		{
+			TestEqual(TEXT("Batched views keep their contexts"), Frame.ContextCreations, 0);
+			TestTrue(TEXT("Batched dispatches are timed"), Frame.DispatchMilliseconds > 0.0);
+		}
+	}
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNSSReplayStereoTest,
+	"ArmNG.UnitTests.NSS.Replay.Stereo",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext
+		| EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter)
+
+bool FNSSReplayStereoTest::RunTest(const FString& Parameters)
+{
+	NSSModule* Module = FModuleManager::GetModulePtr<NSSModule>(TEXT("NSS"));
+	NSS* Upscaler = Module ? Module->GetNSSUpscaler() : nullptr;
+	if (!Upscaler || Upscaler->GetApi() != EFFXBackendAPI::CPU)
+	{
+		AddInfo(TEXT("Skipped as the upscaler isn't using the CPU backend"));
+		return true;
+	}
+
+	const FIntPoint InputSize(32, 16);
+	const NSSReplaySequence PrimaryEye = MakeSyntheticNSSReplaySequence(InputSize, FIntPoint(64, 32), 6, 0);
+	const NSSReplaySequence SecondaryEye = MakeSyntheticNSSReplaySequence(InputSize, FIntPoint(64, 32), 6, 0, 4.0f);
+	NSSStereoReplaySettings Settings;
+	Settings.SecondaryClipToPrimaryClip = MakeSyntheticNSSStereoClipToPrimaryClip(InputSize, 4.0f);
+	for (const bool bCrossEyeReuse : {false, true})
+	{
+		Settings.bCrossEyeReuse = bCrossEyeReuse;
+		const NSSMultiViewReplayResults Results = ReplayNSSStereo(
+			*Upscaler, *Upscaler->GetBackend(), Upscaler->GetApi(), PrimaryEye, SecondaryEye, Settings, 1, 1);
+		TestEqual(TEXT("Cross-eye reuse"), Results.bCrossEyeReuse, bCrossEyeReuse);
+		TestEqual(TEXT("Eyes"), Results.Views.Num(), 2);
+		int32 Reprojected[2] = {0, 0};
+		int32 Resets[2] = {0, 0};
+		for (int32 Eye = 0; Eye < Results.Views.Num(); Eye++)
+		{
+			TestEqual(TEXT("Frames of each eye"), Results.Views[Eye].Frames.Num(), 6);
+			for (const NSSReplayFrameResult& Frame : Results.Views[Eye].Frames)
+			{
+				Reprojected[Eye] += Frame.bReprojected ? 1 : 0;
+				Resets[Eye] += Frame.bHistoryReset ? 1 : 0;
+				TestEqual(TEXT("Eyes keep their contexts"), Frame.ContextCreations, 0);
+			}
+		}
+		// Every dispatch of the secondary eye follows a reprojected frame, which its context's history missed.
+		TestEqual(TEXT("Primary eye resets"), Resets[0], 0);
+		TestEqual(TEXT("Secondary eye resets"), Resets[1], bCrossEyeReuse ? 3 : 0);
+		// The secondary eye runs the network on every other frame, the first one after the warmup being reprojected.
+		TestEqual(TEXT("Primary eye reprojected"), Reprojected[0], 0);
+		TestEqual(TEXT("Secondary eye reprojected"), Reprojected[1], bCrossEyeReuse ? 3 : 0);
+		TestTrue(TEXT("Per eye summary"),
+			Results.ToJson().Contains(FString::Printf(TEXT("\"reprojectedFrames\": %d}"), Reprojected[1])));
+	}
+	return true;
+}
+
+#endif
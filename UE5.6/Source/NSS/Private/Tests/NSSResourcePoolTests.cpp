@@ -0,0 +1,165 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "NSSResourcePool.h"
+
+namespace
+{
+	// Stands in for a pooled render target, so the pool can be tested without an RHI.
+	class FFakeResource : public FRefCountBase
+	{
+	public:
+		explicit FFakeResource(const NSSResourceKey& InKey) : Key(InKey) {}
+
+		NSSResourceKey Key;
+	};
+
+	using FFakePool = TNSSResourcePool<FFakeResource>;
+
+	NSSResourceKey MakeKey(FIntPoint Extent, int32 BucketSize = 0)
+	{
+		NSSResourceKey Key;
+		Key.Extent = GetBucketedExtent(Extent, BucketSize);
+		Key.Format = PF_G16R16F;
+		Key.Flags = TexCreate_ShaderResource | TexCreate_UAV;
+		return Key;
+	}
+
+	TRefCountPtr<FFakeResource> Acquire(FFakePool& Pool, const NSSResourceKey& Key, uint64 Frame)
+	{
+		return Pool.Acquire(Key, Frame, [](const NSSResourceKey& NewKey) { return new FFakeResource(NewKey); });
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNSSResourcePoolSteadyStateTest,
+	"ArmNG.UnitTests.NSS.ResourcePool.SteadyState",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext
+		| EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter)
+
+bool FNSSResourcePoolSteadyStateTest::RunTest(const FString& Parameters)
+{
+	FFakePool Pool;
+	const NSSResourceKey Key = MakeKey(FIntPoint(960, 544));
+
+	// Like the padded depth: used this frame and kept alive by the history until the next one.
+	TRefCountPtr<FFakeResource> History;
+	for (uint64 Frame = 0; Frame < 100; Frame++)
+	{
+		TRefCountPtr<FFakeResource> Current = Acquire(Pool, Key, Frame);
+		TestFalse(TEXT("A resource still held by the history is not handed out"), Current == History);
+		History = Current;
+		Pool.Trim(Frame, MAX_uint64, 30);
+	}
+
+	const NSSResourcePoolStats Stats = Pool.GetStats();
+	TestEqual(TEXT("Only the first two frames allocate"), Stats.Misses, uint64(2));
+	TestEqual(TEXT("Every other frame reuses"), Stats.Hits, uint64(98));
+	TestEqual(TEXT("Nothing is evicted"), Stats.Evictions, uint64(0));
+	TestEqual(TEXT("Two resources are retained"), Stats.NumResources, 2);
+	TestEqual(TEXT("Memory is tracked"), Stats.AllocatedBytes, 2 * Key.GetSizeBytes());
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNSSResourcePoolBucketingTest,
+	"ArmNG.UnitTests.NSS.ResourcePool.Bucketing",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext
+		| EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter)
+
+bool FNSSResourcePoolBucketingTest::RunTest(const FString& Parameters)
+{
+	TestTrue(TEXT("Rounded up"), GetBucketedExtent(FIntPoint(1917, 1080), 64) == FIntPoint(1920, 1088));
+	TestTrue(TEXT("Already a multiple"), GetBucketedExtent(FIntPoint(1920, 1088), 64) == FIntPoint(1920, 1088));
+	TestTrue(TEXT("Disabled"), GetBucketedExtent(FIntPoint(1917, 1080), 0) == FIntPoint(1917, 1080));
+
+	// Dynamic resolution wobbling by a few pixels stays within one bucket.
+	FFakePool Pool;
+	for (int32 Frame = 0; Frame < 16; Frame++)
+	{
+		Acquire(Pool, MakeKey(FIntPoint(1264 + (Frame % 4) * 2, 700 - (Frame % 3) * 4), 64), Frame);
+	}
+	TestEqual(TEXT("One allocation"), Pool.GetStats().Misses, uint64(1));
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNSSResourcePoolEvictionTest,
+	"ArmNG.UnitTests.NSS.ResourcePool.Eviction",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext
+		| EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter)
+
+bool FNSSResourcePoolEvictionTest::RunTest(const FString& Parameters)
+{
+	FFakePool Pool;
+	const NSSResourceKey Small = MakeKey(FIntPoint(64, 64));
+	const NSSResourceKey Large = MakeKey(FIntPoint(256, 256));
+
+	Acquire(Pool, Small, 0);
+	TRefCountPtr<FFakeResource> InUse = Acquire(Pool, Large, 1);
+	Acquire(Pool, Small, 2);
+
+	// Over the ceiling: the unused small resource goes, the large one is still referenced and must stay.
+	Pool.Trim(3, Small.GetSizeBytes(), 30);
+	NSSResourcePoolStats Stats = Pool.GetStats();
+	TestEqual(TEXT("The free resource is evicted"), Stats.Evictions, uint64(1));
+	TestEqual(TEXT("The resource in use is kept"), Stats.NumResources, 1);
+	TestEqual(TEXT("The pool may exceed the ceiling while resources are in use"),
+		Stats.AllocatedBytes,
+		Large.GetSizeBytes());
+
+	// Released and then left unused for long enough.
+	InUse.SafeRelease();
+	Pool.Trim(20, MAX_uint64, 30);
+	TestEqual(TEXT("Recently used resources are kept"), Pool.GetStats().NumResources, 1);
+	Pool.Trim(40, MAX_uint64, 30);
+	Stats = Pool.GetStats();
+	TestEqual(TEXT("Stale resources are evicted"), Stats.NumResources, 0);
+	TestEqual(TEXT("No memory is retained"), Stats.AllocatedBytes, uint64(0));
+	TestEqual(TEXT("Evictions are counted"), Stats.Evictions, uint64(2));
+	return true;
+}
+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNSSResourcePoolPerViewTest,
+	"ArmNG.UnitTests.NSS.ResourcePool.PerView",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext
+		| EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter)
+
+bool FNSSResourcePoolPerViewTest::RunTest(const FString& Parameters)
+{
+	TNSSViewResourcePools<FFakeResource> Pools;
+	const NSSResourceKey Key = MakeKey(FIntPoint(960, 544));
+
+	// Two views of the same size each keep their own resource: neither is handed the other's.
+	for (uint64 Frame = 0; Frame < 10; Frame++)
+	{
+		TRefCountPtr<FFakeResource> Left = Acquire(Pools.FindOrAdd(1, Frame), Key, Frame);
+		TRefCountPtr<FFakeResource> Right = Acquire(Pools.FindOrAdd(2, Frame), Key, Frame);
+		TestFalse(TEXT("Views don't share resources"), Left == Right);
+		Pools.Trim(Frame, MAX_uint64, 30);
+	}
+	NSSResourcePoolStats Stats = Pools.GetStats();
+	TestEqual(TEXT("Views"), Pools.GetNumViews(), 2);
+	TestEqual(TEXT("One allocation per view"), Stats.Misses, uint64(2));
+	TestEqual(TEXT("Every other frame reuses"), Stats.Hits, uint64(18));
+
+	// The same view gets the same pool back.
+	TestTrue(TEXT("Stable pool"), &Pools.FindOrAdd(1, 10) == &Pools.FindOrAdd(1, 11));
+
+	// A view that stops rendering is dropped, without the totals going backwards.
+	for (uint64 Frame = 12; Frame < 50; Frame++)
+	{
+		Acquire(Pools.FindOrAdd(1, Frame), Key, Frame);
+		Pools.Trim(Frame, MAX_uint64, 30);
+	}
+	Stats = Pools.GetStats();
+	TestEqual(TEXT("The unused view is dropped"), Pools.GetNumViews(), 1);
+	TestEqual(TEXT("Its resource is released"), Stats.NumResources, 1);
+	TestEqual(TEXT("Its memory is released"), Stats.AllocatedBytes, Key.GetSizeBytes());
+	TestEqual(TEXT("Misses are kept"), Stats.Misses, uint64(2));
+	TestEqual(TEXT("Its resource is counted as evicted"), Stats.Evictions, uint64(1));
+	return true;
+}
+
+#endif
@@ -0,0 +1,166 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/AutomationTest.h"
+#include "NSSStaticFrameDetector.h"
+
+namespace
+{
+	// A camera looking down the X axis from Position at a paused world, with no moving objects.
+	NSSStaticFrameInputs MakeStaticFrame(const FVector& Position = FVector::ZeroVector)
+	{
+		NSSStaticFrameInputs Inputs;
+		Inputs.WorldToClip = FTranslationMatrix(-Position)
+							 * FReversedZPerspectiveMatrix(FMath::DegreesToRadians(45.0), 16.0f, 9.0f, 10.0f);
+		Inputs.InputSize = FIntPoint(960, 540);
+		Inputs.OutputSize = FIntPoint(1920, 1080);
+		Inputs.JitterSequenceLength = 8;
+		Inputs.bWorldPaused = true;
+		Inputs.MaxMotionPixels = 0.0f;
+		return Inputs;
+	}
+
+	// Runs Frames identical frames and returns how many of them reused the output.
+	int32 CountReused(NSSStaticFrameDetector& Detector,
+		const NSSStaticFrameInputs& Inputs,
+		const NSSStaticFrameSettings& Settings,
+		int32 Frames)
+	{
+		int32 Reused = 0;
+		for (int32 Frame = 0; Frame < Frames; Frame++)
+		{
+			Reused += Detector.Update(Inputs, Settings) == ENSSStaticFrameDecision::Reuse ? 1 : 0;
+		}
+		return Reused;
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNSSStaticFrameDetectorTest,
+	"ArmNG.UnitTests.NSS.StaticFrameDetector",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext
+		| EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter)
+
+bool FNSSStaticFrameDetectorTest::RunTest(const FString& Parameters)
+{
+	NSSStaticFrameSettings Settings;
+	Settings.ConvergeFrames = 4;
+	Settings.MaxReuseFrames = 10;
+	const NSSStaticFrameInputs Static = MakeStaticFrame();
+
+	// The first frame has nothing to compare with, then ConvergeFrames static frames are dispatched before the
+	// output is reused for MaxReuseFrames frames, and a single frame is dispatched to refresh it in between.
+	{
+		NSSStaticFrameDetector Detector;
+		TestEqual(TEXT("Converging"), CountReused(Detector, Static, Settings, 1 + Settings.ConvergeFrames), 0);
+		TestEqual(TEXT("Reused"), CountReused(Detector, Static, Settings, Settings.MaxReuseFrames), 10);
+		TestEqual(TEXT("Reused frames"), Detector.GetReusedFrames(), Settings.MaxReuseFrames);
+		TestTrue(TEXT("Refreshed"), Detector.Update(Static, Settings) == ENSSStaticFrameDecision::Dispatch);
+		TestTrue(TEXT("Reused after refresh"), Detector.Update(Static, Settings) == ENSSStaticFrameDecision::Reuse);
+		// Over a long idle period one frame in MaxReuseFrames + 1 is dispatched.
+		TestEqual(TEXT("Idle rate"), CountReused(Detector, Static, Settings, 1100), 1000);
+	}
+
+	// Anything that changes the upscaled output starts converging again.
+	{
+		auto TestChange = [this, &Settings, &Static](const TCHAR* What, const NSSStaticFrameInputs& Changed)
+		{
+			NSSStaticFrameDetector Detector;
+			CountReused(Detector, Static, Settings, 20);
+			TestTrue(What, Detector.Update(Changed, Settings) == ENSSStaticFrameDecision::Dispatch);
+			TestEqual(What, Detector.GetStaticFrames(), 0);
+			TestEqual(What, CountReused(Detector, Changed, Settings, Settings.ConvergeFrames), 0);
+			TestTrue(What, Detector.Update(Changed, Settings) == ENSSStaticFrameDecision::Reuse);
+		};
+		TestChange(TEXT("Camera moved"), MakeStaticFrame(FVector(0.0, 1.0, 0.0)));
+		NSSStaticFrameInputs Rotated = Static;
+		Rotated.WorldToClip = FRotationMatrix(FRotator(0.0, 0.01, 0.0)) * Static.WorldToClip;
+		TestChange(TEXT("Camera rotated"), Rotated);
+		NSSStaticFrameInputs Resized = Static;
+		Resized.InputSize = FIntPoint(1280, 720);
+		TestChange(TEXT("Render size"), Resized);
+		NSSStaticFrameInputs Exposed = Static;
+		Exposed.PreExposure = 2.0f;
+		TestChange(TEXT("Exposure"), Exposed);
+		NSSStaticFrameInputs Jittered = Static;
+		Jittered.JitterSequenceLength = 16;
+		TestChange(TEXT("Jitter sequence"), Jittered);
+	}
+
+	// A camera cut drops the history, so the frame after it can't be reused either.
+	{
+		NSSStaticFrameDetector Detector;
+		CountReused(Detector, Static, Settings, 20);
+		NSSStaticFrameInputs Cut = Static;
+		Cut.bHistoryReset = true;
+		TestTrue(TEXT("Camera cut"), Detector.Update(Cut, Settings) == ENSSStaticFrameDecision::Dispatch);
+		TestEqual(TEXT("After camera cut"), CountReused(Detector, Static, Settings, Settings.ConvergeFrames), 0);
+	}
+
+	// A running world is never static, even when the measured motion says nothing moved, as the measurement lags
+	// the frame. While the world is paused, measured motion beyond the tolerance still vetoes the reuse, and
+	// without a measurement the paused world is enough.
+	{
+		NSSStaticFrameInputs Running = Static;
+		Running.bWorldPaused = false;
+		NSSStaticFrameDetector Detector;
+		TestEqual(TEXT("Running world"), CountReused(Detector, Running, Settings, 50), 0);
+		NSSStaticFrameInputs Moving = Static;
+		Moving.MaxMotionPixels = 0.5f;
+		TestEqual(TEXT("Moving objects"), CountReused(Detector, Moving, Settings, 50), 0);
+		NSSStaticFrameInputs Unmeasured = Static;
+		Unmeasured.MaxMotionPixels.Reset();
+		TestTrue(TEXT("Unmeasured motion"), CountReused(Detector, Unmeasured, Settings, 50) > 0);
+		NSSStaticFrameInputs Creeping = Static;
+		Creeping.MaxMotionPixels = Settings.MotionTolerancePixels * 0.5f;
+		Detector.Reset();
+		TestTrue(TEXT("Within tolerance"), CountReused(Detector, Creeping, Settings, 50) > 0);
+	}
+
+	// A camera drifting slowly never settles.
+	{
+		NSSStaticFrameDetector Detector;
+		int32 Reused = 0;
+		for (int32 Frame = 0; Frame < 50; Frame++)
+		{
+			const NSSStaticFrameInputs Drifting = MakeStaticFrame(FVector(0.0, 0.01 * Frame, 0.0));
+			Reused += Detector.Update(Drifting, Settings) == ENSSStaticFrameDecision::Reuse ? 1 : 0;
+		}
+		TestEqual(TEXT("Drifting camera"), Reused, 0);
+	}
+
+	// A trace of a pause menu: the camera flies in, idles behind the menu while the game is paused, then flies out
+	// again.
+	{
+		NSSStaticFrameDetector Detector;
+		NSSStaticFrameSettings Defaults;
+		int32 Reused = 0;
+		int32 ReusedWhileMoving = 0;
+		for (int32 Frame = 0; Frame < 400; Frame++)
+		{
+			const bool bMoving = Frame < 100 || Frame >= 350;
+			NSSStaticFrameInputs Inputs = MakeStaticFrame(FVector(FMath::Clamp(Frame, 0, 100) * 10.0, 0.0, 0.0)
+														  + FVector(0.0, FMath::Max(Frame - 349, 0) * 10.0, 0.0));
+			Inputs.bWorldPaused = !bMoving;
+			const bool bReused = Detector.Update(Inputs, Defaults) == ENSSStaticFrameDecision::Reuse;
+			Reused += bReused ? 1 : 0;
+			ReusedWhileMoving += bReused && bMoving ? 1 : 0;
+		}
+		TestEqual(TEXT("Menu reused while moving"), ReusedWhileMoving, 0);
+		// 250 idle frames: the first one differs from the last moving frame and the next ConvergeFrames converge,
+		// then one frame in MaxReuseFrames + 1 refreshes the output.
+		TestEqual(TEXT("Menu reused"), Reused, 234);
+	}
+
+	// No reuse at all with a maximum of 0.
+	{
+		NSSStaticFrameSettings Never = Settings;
+		Never.MaxReuseFrames = 0;
+		NSSStaticFrameDetector Detector;
+		TestEqual(TEXT("Never reused"), CountReused(Detector, Static, Never, 100), 0);
+	}
+	return true;
+}
+
+#endif
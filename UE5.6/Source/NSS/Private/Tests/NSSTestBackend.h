@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformProcess.h"
+#include "NGSharedBackend.h"
+
+#include <atomic>
+
+//-------------------------------------------------------------------------------------
+// A stand-in for the NG-SDK backends that only counts calls, so NSS bookkeeping can be tested without a GPU.
+//-------------------------------------------------------------------------------------
+class NSSTestBackend final : public INGSharedBackend
+{
+public:
+	ffxReturnCode_t ffxCreateContext(ffxContext* context, ffxCreateContextDescHeader* desc) override
+	{
+		if (CreateDelaySeconds > 0.0f)
+		{
+			// Simulates the cost of creating the network and allocating its resources.
+			FPlatformProcess::Sleep(CreateDelaySeconds);
+		}
+		*context = reinterpret_cast<ffxContext>(UPTRINT(++NumCreated));
+		return FFX_OK;
+	}
+
+	ffxReturnCode_t ffxDestroyContext(ffxContext* context) override
+	{
+		++NumDestroyed;
+		*context = nullptr;
+		return FFX_OK;
+	}
+
+	ffxReturnCode_t ffxConfigure(ffxContext* context, const ffxConfigureDescHeader* desc) override
+	{
+		return FFX_OK;
+	}
+
+	ffxReturnCode_t ffxQuery(ffxContext* context, ffxQueryDescHeader* desc) override
+	{
+		if (desc->type == FFX_API_QUERY_DESC_TYPE_NSS_GPU_MEMORY_USAGE && GPUMemoryUsageBytes > 0)
+		{
+			ffxQueryDescNssGetGPUMemoryUsage* Query = reinterpret_cast<ffxQueryDescNssGetGPUMemoryUsage*>(desc);
+			Query->totalUsageInBytes = GPUMemoryUsageBytes;
+			Query->scratchUsageInBytes = GPUScratchUsageBytes;
+			return FFX_OK;
+		}
+		return FFX_API_RETURN_ERROR_UNKNOWN_DESCTYPE;
+	}
+
+	ffxReturnCode_t ffxDispatch(ffxContext* context, const ffxDispatchDescHeader* desc) override
+	{
+		++NumDispatched;
+		return FFX_OK;
+	}
+
+	EFFXBackendAPI GetAPI() const override
+	{
+		return EFFXBackendAPI::Unsupported;
+	}
+
+	FfxApiResource GetNativeResource(FRHITexture* Texture, FfxApiResourceState State) override
+	{
+		return FfxApiResource{};
+	}
+
+	FfxApiResource GetNativeResource(FRDGTexture* Texture, FfxApiResourceState State) override
+	{
+		return FfxApiResource{};
+	}
+
+	FfxCommandList GetNativeCommandBuffer(FRHICommandListImmediate& RHICmdList, FRHITexture* Texture) override
+	{
+		return nullptr;
+	}
+
+	void EnqueueNativeCommands(
+		FRHICommandListImmediate& RHICmdList, TUniqueFunction<void(FfxCommandList)>&& Commands) override
+	{
+		Commands(nullptr);
+	}
+
+	bool IsNeuralGraphicSupported() override
+	{
+		return true;
+	}
+
+	bool IsLoaded() override
+	{
+		return true;
+	}
+
+	void ForceUAVTransition(
+		FRHICommandListImmediate& RHICmdList, FRHITexture* OutputTexture, ERHIAccess Access) override
+	{}
+
+	bool GetDispatchTimings(ffxContext* context, NGSharedDispatchTimings& OutTimings) override
+	{
+		OutTimings = DispatchTimings;
+		return bTimesDispatches;
+	}
+
+	float CreateDelaySeconds = 0.0f;
+	// What the context memory query reports, or 0 to not support it like an SDK without the extension.
+	uint64 GPUMemoryUsageBytes = 0;
+	uint64 GPUScratchUsageBytes = 0;
+	// What GetDispatchTimings reports.
+	bool bTimesDispatches = false;
+	NGSharedDispatchTimings DispatchTimings;
+	std::atomic<int32> NumCreated = 0;
+	std::atomic<int32> NumDestroyed = 0;
+	std::atomic<int32> NumDispatched = 0;
+};
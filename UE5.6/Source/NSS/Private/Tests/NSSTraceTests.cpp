@@ -0,0 +1,154 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "HAL/FileManager.h"
+#include "HAL/PlatformTLS.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "NGSharedTrace.h"
+#include "NSSInclude.h"
+#include "NSSTestBackend.h"
+
+namespace
+{
+	ffxApiCreateContextDescNss MakeCreateDesc()
+	{
+		ffxApiCreateContextDescNss Desc;
+		FMemory::Memzero(Desc);
+		Desc.header.type = FFX_API_CREATE_CONTEXT_DESC_TYPE_NSS;
+		Desc.maxRenderSize.width = 540;
+		Desc.maxRenderSize.height = 360;
+		Desc.maxUpscaleSize.width = 1080;
+		Desc.maxUpscaleSize.height = 720;
+		return Desc;
+	}
+
+	// Keeps the calls of this thread, in case a running upscaler's calls were recorded too.
+	TArray<NGSharedTraceEvent> GetThreadEvents(const NGSharedTraceFile& Trace)
+	{
+		const uint32 ThreadId = FPlatformTLS::GetCurrentThreadId();
+		return Trace.Events.FilterByPredicate([ThreadId](const NGSharedTraceEvent& Event)
+			{ return Event.ThreadId == ThreadId; });
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FNSSTraceTest,
+	"ArmNG.UnitTests.NSS.Trace",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext
+		| EAutomationTestFlags::CommandletContext | EAutomationTestFlags::EngineFilter)
+
+bool FNSSTraceTest::RunTest(const FString& Parameters)
+{
+	if (NGSharedTrace::IsRecording())
+	{
+		AddWarning(TEXT("Skipped, a trace is already being recorded"));
+		return true;
+	}
+	// Wrappers live for the rest of the run, so the backend has to as well.
+	static NSSTestBackend Recorded;
+	Recorded.NumCreated = 0;
+	INGSharedBackend* Backend = NGSharedTrace::Wrap(&Recorded);
+	TestTrue(TEXT("One wrapper per backend"), NGSharedTrace::Wrap(&Recorded) == Backend);
+	TestTrue(TEXT("API"), Backend->GetAPI() == Recorded.GetAPI());
+
+	// Calls outside a trace are only forwarded.
+	ffxApiCreateContextDescNss CreateDesc = MakeCreateDesc();
+	ffxContext Untraced = nullptr;
+	Backend->ffxCreateContext(&Untraced, &CreateDesc.header);
+	TestEqual(TEXT("Forwarded"), Recorded.NumCreated.load(), 1);
+
+	const FString Path = FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("NSSTraceTest.ngtrace"));
+	TestTrue(TEXT("Start"), NGSharedTrace::Start(Path));
+	AddExpectedError(TEXT("already being recorded"), EAutomationExpectedErrorFlags::Contains, 1);
+	TestFalse(TEXT("Only one trace at a time"), NGSharedTrace::Start(Path));
+	ffxContext Context = nullptr;
+	TestTrue(TEXT("Create"), Backend->ffxCreateContext(&Context, &CreateDesc.header) == FFX_OK);
+	ffxQueryDescNssGetGPUMemoryUsage Query = {};
+	Query.header.type = FFX_API_QUERY_DESC_TYPE_NSS_GPU_MEMORY_USAGE;
+	Backend->ffxQuery(&Context, &Query.header);
+	ffxApiDispatchDescNss Dispatch = {};
+	Dispatch.header.type = FFX_API_DISPATCH_DESC_TYPE_NSS;
+	Dispatch.renderSize.width = 540;
+	Dispatch.renderSize.height = 360;
+	Dispatch.color.resource = &Dispatch;
+	Dispatch.output.resource = &Dispatch;
+	// A backend specific descriptor can only be recorded by type.
+	ffxApiHeader BackendDesc = {};
+	BackendDesc.type = 0x7FFFFFFFu;
+	Dispatch.header.pNext = &BackendDesc;
+	Backend->ffxDispatch(&Context, &Dispatch.header);
+	Backend->ffxDispatch(&Untraced, &Dispatch.header);
+	Backend->ffxDestroyContext(&Context);
+	TestTrue(TEXT("Stop"), NGSharedTrace::Stop());
+	TestFalse(TEXT("Stopped"), NGSharedTrace::IsRecording());
+	Backend->ffxDestroyContext(&Untraced);
+
+	NGSharedTraceFile Trace;
+	FString Error;
+	TestTrue(TEXT("Load"), LoadNGSharedTrace(Path, Trace, Error));
+	TestTrue(TEXT("Recorded API"), Trace.Api == Recorded.GetAPI());
+	const TArray<NGSharedTraceEvent> Events = GetThreadEvents(Trace);
+	if (!TestEqual(TEXT("Events"), Events.Num(), 5))
+	{
+		return false;
+	}
+	TestTrue(TEXT("Create event"), Events[0].Call == ENGSharedTraceCall::CreateContext);
+	TestEqual(TEXT("Create chain"), Events[0].Descs.Num(), 1);
+	TestEqual(TEXT("Create desc"), Events[0].Descs[0].Bytes.Num(), int32(sizeof(ffxApiCreateContextDescNss)));
+	TestTrue(TEXT("Query event"), Events[1].Call == ENGSharedTraceCall::Query);
+	TestTrue(TEXT("Query result"), Events[1].ReturnCode == FFX_API_RETURN_ERROR_UNKNOWN_DESCTYPE);
+	TestTrue(TEXT("Dispatch event"), Events[2].Call == ENGSharedTraceCall::Dispatch);
+	TestEqual(TEXT("Dispatch chain"), Events[2].Descs.Num(), 2);
+	TestTrue(TEXT("Backend desc type"), Events[2].Descs[1].Type == 0x7FFFFFFFu);
+	TestEqual(TEXT("Backend desc bytes"), Events[2].Descs[1].Bytes.Num(), 0);
+	TestTrue(TEXT("Destroy event"), Events[4].Call == ENGSharedTraceCall::DestroyContext);
+	// Contexts are numbered as the trace sees them, the one created before it started included.
+	TestEqual(TEXT("Created context"), int32(Events[0].ContextId), 1);
+	TestEqual(TEXT("Dispatched context"), int32(Events[2].ContextId), 1);
+	TestEqual(TEXT("Untraced context"), int32(Events[3].ContextId), 2);
+	TestEqual(TEXT("Destroyed context"), int32(Events[4].ContextId), 1);
+	TestTrue(TEXT("Ordered"), Events[0].StartSeconds <= Events[4].StartSeconds);
+
+	// The replay recreates the traced context, clears the recorded resources and skips calls on contexts it
+	// didn't create.
+	NSSTestBackend Replayed;
+	NGSharedTraceReplayer Replayer(Replayed);
+	bool bResourcesCleared = false;
+	Replayer.ResolveDispatch = [&bResourcesCleared](ffxDispatchDescHeader& Desc)
+	{
+		const ffxApiDispatchDescNss& ReplayedDispatch = reinterpret_cast<const ffxApiDispatchDescNss&>(Desc);
+		bResourcesCleared = !ReplayedDispatch.color.resource && !ReplayedDispatch.output.resource
+			&& ReplayedDispatch.renderSize.width == 540 && !Desc.pNext;
+	};
+	NGSharedTraceFile ThreadTrace;
+	ThreadTrace.Events = Events;
+	const NGSharedTraceReplayResults Results = Replayer.Replay(ThreadTrace);
+	TestTrue(TEXT("Resources cleared"), bResourcesCleared);
+	TestEqual(TEXT("Replayed creations"), Replayed.NumCreated.load(), 1);
+	TestEqual(TEXT("Replayed destructions"), Replayed.NumDestroyed.load(), 1);
+	TestEqual(TEXT("Replayed dispatches"), Replayed.NumDispatched.load(), 1);
+	TestEqual(TEXT("Skipped"), Results.Calls[int32(ENGSharedTraceCall::Dispatch)].Skipped, 1);
+	TestEqual(TEXT("Mismatches"), Results.Mismatches, 0);
+	TestEqual(TEXT("Peak contexts"), Results.PeakLiveContexts, 1);
+
+	// Contexts the trace leaves alive are destroyed after the replay.
+	ThreadTrace.Events.Pop();
+	NSSTestBackend Leaked;
+	NGSharedTraceReplayer LeakReplayer(Leaked);
+	LeakReplayer.Replay(ThreadTrace);
+	TestEqual(TEXT("Leftover contexts"), Leaked.NumDestroyed.load(), 1);
+
+	// Truncated traces are rejected.
+	TArray<uint8> Bytes;
+	FFileHelper::LoadFileToArray(Bytes, *Path);
+	Bytes.SetNum(Bytes.Num() - 4);
+	FFileHelper::SaveArrayToFile(Bytes, *Path);
+	TestFalse(TEXT("Truncated"), LoadNGSharedTrace(Path, Trace, Error));
+	IFileManager::Get().Delete(*Path);
+	return true;
+}
+
+#endif
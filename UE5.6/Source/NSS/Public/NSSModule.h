@@ -26,6 +26,7 @@
 
 #include "Modules/ModuleManager.h"
 #include "NGShared.h"
+#include "NSSRegionOfInterest.h"
 #include "RHIDefinitions.h"
 
 class NSS;
@@ -44,6 +45,11 @@ public:
 	virtual INSS* GetTemporalUpscaler() const = 0;
 	virtual bool IsPlatformSupported(EShaderPlatform Platform) const = 0;
 	virtual void SetEnabledInEditor(bool bEnabled) = 0;
+	// The region of interest of the view with ViewKey (FSceneViewStateInterface::GetViewKey) while r.NSS.ROI is on,
+	// in place of the one given by the r.NSS.ROI.* cvars, e.g. to follow the player's gaze every frame. r.NSS.ROI is a
+	// preview that shipping builds don't have, where the region is kept but unused. Any thread.
+	virtual void SetRegionOfInterest(uint32 ViewKey, const NSSRegionOfInterest& Region) = 0;
+	virtual void ClearRegionOfInterest(uint32 ViewKey) = 0;
 };
 
 class NSSModule final : public INSSModule
@@ -63,6 +69,8 @@ public:
 	INSS* GetTemporalUpscaler() const;
 	bool IsPlatformSupported(EShaderPlatform Platform) const;
 	void SetEnabledInEditor(bool bEnabled);
+	void SetRegionOfInterest(uint32 ViewKey, const NSSRegionOfInterest& Region);
+	void ClearRegionOfInterest(uint32 ViewKey);
 
 private:
 	TSharedPtr<NSS, ESPMode::ThreadSafe> TemporalUpscaler;
@@ -0,0 +1,22 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+//-------------------------------------------------------------------------------------
+// The region of an upscaled view that keeps the network's output with r.NSS.ROI, such as a fixed fovea, the point the
+// player is looking at or the centre of the screen. The periphery gets a bilinear upscale of the render, blended in
+// across a feathered edge. Set per view with INSSModule::SetRegionOfInterest, or for every view by the r.NSS.ROI.*
+// cvars. r.NSS.ROI only previews the result outside shipping builds; NSSReference blends and measures the same on
+// the CPU.
+//-------------------------------------------------------------------------------------
+struct NSSRegionOfInterest
+{
+	// Centre of the circular region in UV of the output view, e.g. the gaze point.
+	FVector2f Center = FVector2f(0.5f, 0.5f);
+	// Radius of the region and width of the feathered edge past it, as fractions of the output view's height.
+	float Radius = 0.35f;
+	float Feather = 0.1f;
+};
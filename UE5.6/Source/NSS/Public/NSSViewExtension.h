@@ -27,6 +27,7 @@
 #include "NGShared.h"
 #include "SceneViewExtension.h"
 
+class NSS;
 typedef FRDGBuilder FRenderGraphType;
 
 class NSS_API NSSViewExtension final : public FSceneViewExtensionBase
@@ -42,10 +43,10 @@ public:
 	void PreRenderViewFamily_RenderThread(FRenderGraphType& GraphBuilder, FSceneViewFamily& InViewFamily) override;
 	void PreRenderView_RenderThread(FRenderGraphType& GraphBuilder, FSceneView& InView) override;
 	void PostRenderViewFamily_RenderThread(FRenderGraphType& GraphBuilder, FSceneViewFamily& InViewFamily) override;
-	void PrePostProcessPass_RenderThread(
-		FRDGBuilder& GraphBuilder, const FSceneView& View, const FPostProcessingInputs& Inputs) override;
 
 private:
+	// The module's upscaler, looked up once rather than every frame.
+	NSS* Upscaler;
 	int32 PreviousNSSState;
 	int32 PreviousNSSStateRT;
 	int32 CurrentNSSStateRT;
@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#include "NSSInsightsModule.h"
+
+#include "Features/IModularFeatures.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "NSSTraceAnalyzer.h"
+#include "NSSTraceProvider.h"
+#include "TraceServices/Model/AnalysisSession.h"
+
+DEFINE_LOG_CATEGORY(LogNSSInsights);
+
+IMPLEMENT_MODULE(NSSInsightsModule, NSSInsights)
+
+void NSSTraceModule::GetModuleInfo(TraceServices::FModuleInfo& OutModuleInfo)
+{
+	OutModuleInfo.Name = FName(TEXT("NSSTrace"));
+	OutModuleInfo.DisplayName = TEXT("NSS");
+}
+
+void NSSTraceModule::OnAnalysisBegin(TraceServices::IAnalysisSession& Session)
+{
+	TSharedPtr<NSSTraceProvider> Provider = MakeShared<NSSTraceProvider>(Session);
+	Session.AddProvider(NSSTraceProvider::GetProviderName(), Provider);
+	Session.AddAnalyzer(new NSSTraceAnalyzer(Session, *Provider));
+}
+
+void NSSTraceModule::GetLoggers(TArray<const TCHAR*>& OutLoggers)
+{
+	OutLoggers.Add(TEXT("ArmNSS"));
+}
+
+void NSSTraceModule::GenerateReports(
+	const TraceServices::IAnalysisSession& Session, const TCHAR* CmdLine, const TCHAR* OutputDirectory)
+{
+	TraceServices::FAnalysisSessionReadScope ReadScope(Session);
+	const NSSTraceProvider* Provider = Session.ReadProvider<NSSTraceProvider>(NSSTraceProvider::GetProviderName());
+	if (Provider)
+	{
+		const FString Path = FPaths::Combine(OutputDirectory, TEXT("NSSSummary.txt"));
+		FFileHelper::SaveStringToFile(Provider->GetSummary().ToString(), *Path);
+	}
+}
+
+const TCHAR* NSSTraceModule::GetCommandLineArgument()
+{
+	return TEXT("nss");
+}
+
+void NSSInsightsModule::StartupModule()
+{
+	IModularFeatures::Get().RegisterModularFeature(TraceServices::ModuleFeatureName, &TraceModule);
+}
+
+void NSSInsightsModule::ShutdownModule()
+{
+	IModularFeatures::Get().UnregisterModularFeature(TraceServices::ModuleFeatureName, &TraceModule);
+}
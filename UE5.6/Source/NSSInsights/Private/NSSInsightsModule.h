@@ -0,0 +1,36 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Modules/ModuleManager.h"
+#include "TraceServices/ModuleService.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogNSSInsights, Log, All);
+
+//-------------------------------------------------------------------------------------
+// Adds the NSS analyzer and provider to every Insights session that has NSS events.
+//-------------------------------------------------------------------------------------
+class NSSTraceModule final : public TraceServices::IModule
+{
+public:
+	void GetModuleInfo(TraceServices::FModuleInfo& OutModuleInfo) override;
+	void OnAnalysisBegin(TraceServices::IAnalysisSession& Session) override;
+	void GetLoggers(TArray<const TCHAR*>& OutLoggers) override;
+	// Writes the summary of the session to NSSSummary.txt.
+	void GenerateReports(
+		const TraceServices::IAnalysisSession& Session, const TCHAR* CmdLine, const TCHAR* OutputDirectory) override;
+	const TCHAR* GetCommandLineArgument() override;
+};
+
+class NSSInsightsModule final : public IModuleInterface
+{
+public:
+	// IModuleInterface implementation
+	void StartupModule() override;
+	void ShutdownModule() override;
+
+private:
+	NSSTraceModule TraceModule;
+};
@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#include "NSSTraceAnalyzer.h"
+
+#include "NSSInsightsModule.h"
+#include "NSSTraceProvider.h"
+#include "TraceServices/Model/AnalysisSession.h"
+
+NSSTraceAnalyzer::NSSTraceAnalyzer(TraceServices::IAnalysisSession& InSession, NSSTraceProvider& InProvider)
+	: Session(InSession), Provider(InProvider)
+{}
+
+void NSSTraceAnalyzer::OnAnalysisBegin(const FOnAnalysisContext& Context)
+{
+	FInterfaceBuilder& Builder = Context.InterfaceBuilder;
+	Builder.RouteEvent(RouteId_Counters, "ArmNSS", "Counters");
+	Builder.RouteEvent(RouteId_ContextCreated, "ArmNSS", "ContextCreated");
+}
+
+void NSSTraceAnalyzer::OnAnalysisEnd()
+{
+	TraceServices::FAnalysisSessionReadScope ReadScope(Session);
+	const NSSTraceSummary& Summary = Provider.GetSummary();
+	if (Summary.Frames > 0 || Summary.ContextCreations > 0)
+	{
+		UE_LOG(LogNSSInsights, Display, TEXT("%s"), *Summary.ToString());
+	}
+}
+
+bool NSSTraceAnalyzer::OnEvent(uint16 RouteId, EStyle Style, const FOnEventContext& Context)
+{
+	TraceServices::FAnalysisSessionEditScope EditScope(Session);
+	const FEventData& EventData = Context.EventData;
+	const double Time = Context.EventTime.AsSeconds(EventData.GetValue<uint64>("Cycle"));
+	switch (RouteId)
+	{
+	case RouteId_Counters:
+	{
+		NSSTraceFrameCounters Counters;
+		Counters.LiveContexts = int32(EventData.GetValue<uint32>("LiveContexts"));
+		Counters.PooledTextures = int32(EventData.GetValue<uint32>("PooledTextures"));
+		Counters.AllocatedBytes = EventData.GetValue<uint64>("AllocatedBytes");
+		Counters.ContextCreations = int32(EventData.GetValue<uint32>("ContextCreations"));
+		Counters.CropCopies = int32(EventData.GetValue<uint32>("CropCopies"));
+		Counters.HistoryResets = int32(EventData.GetValue<uint32>("HistoryResets"));
+		Provider.AddFrameCounters(Time, Counters);
+		break;
+	}
+	case RouteId_ContextCreated:
+	{
+		NSSTraceContextCreation Creation;
+		Creation.Time = Time;
+		Creation.Seconds = EventData.GetValue<double>("Seconds");
+		Creation.ViewID = EventData.GetValue<uint32>("ViewID");
+		Creation.InputSize =
+			FIntPoint(EventData.GetValue<uint32>("InputWidth"), EventData.GetValue<uint32>("InputHeight"));
+		Creation.OutputSize =
+			FIntPoint(EventData.GetValue<uint32>("OutputWidth"), EventData.GetValue<uint32>("OutputHeight"));
+		Creation.bAheadOfTime = EventData.GetValue<bool>("bAheadOfTime");
+		Provider.AddContextCreation(Creation);
+		break;
+	}
+	default:
+		break;
+	}
+	return true;
+}
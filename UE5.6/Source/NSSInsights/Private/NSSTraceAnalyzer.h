@@ -0,0 +1,37 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Analyzer.h"
+
+class NSSTraceProvider;
+
+namespace TraceServices
+{
+	class IAnalysisSession;
+}
+
+//-------------------------------------------------------------------------------------
+// Reads the events NSS outputs on NSSChannel into an NSSTraceProvider.
+//-------------------------------------------------------------------------------------
+class NSSTraceAnalyzer final : public UE::Trace::IAnalyzer
+{
+public:
+	NSSTraceAnalyzer(TraceServices::IAnalysisSession& InSession, NSSTraceProvider& InProvider);
+
+	void OnAnalysisBegin(const FOnAnalysisContext& Context) override;
+	void OnAnalysisEnd() override;
+	bool OnEvent(uint16 RouteId, EStyle Style, const FOnEventContext& Context) override;
+
+private:
+	enum : uint16
+	{
+		RouteId_Counters,
+		RouteId_ContextCreated,
+	};
+
+	TraceServices::IAnalysisSession& Session;
+	NSSTraceProvider& Provider;
+};
@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#include "NSSTraceProvider.h"
+
+#include "TraceServices/Model/Counters.h"
+
+FString NSSTraceSummary::ToString() const
+{
+	const int32 RenderThreadCreations = ContextCreations - ContextCreationsAheadOfTime;
+	FString Result = FString::Printf(TEXT("NSS over %d frames:\n"), Frames);
+	Result += FString::Printf(TEXT("  Context creations: %d, %d of them ahead of time\n"),
+		ContextCreations,
+		ContextCreationsAheadOfTime);
+	Result += FString::Printf(TEXT("  Render thread creation time: %.2fms total, %.2fms mean, %.2fms max\n"),
+		RenderThreadCreationSeconds * 1000.0,
+		RenderThreadCreations > 0 ? RenderThreadCreationSeconds * 1000.0 / RenderThreadCreations : 0.0,
+		MaxRenderThreadCreationSeconds * 1000.0);
+	Result += FString::Printf(TEXT("  Peak live contexts: %d\n"), PeakLiveContexts);
+	Result += FString::Printf(TEXT("  Peak pooled textures: %d\n"), PeakPooledTextures);
+	Result += FString::Printf(
+		TEXT("  Peak memory: %.2fMB\n"), double(PeakAllocatedBytes) / (1024.0 * 1024.0));
+	Result += FString::Printf(TEXT("  Output crop copies: %lld\n"), CropCopies);
+	Result += FString::Printf(TEXT("  History resets: %lld\n"), HistoryResets);
+	return Result;
+}
+
+NSSTraceProvider::NSSTraceProvider(TraceServices::IAnalysisSession& InSession) : Session(InSession)
+{}
+
+FName NSSTraceProvider::GetProviderName()
+{
+	static const FName Name(TEXT("NSSTraceProvider"));
+	return Name;
+}
+
+void NSSTraceProvider::CreateCounters()
+{
+	static const TCHAR* const Names[int32(ECounter::Num)] = {
+		TEXT("NSS/Live contexts"),
+		TEXT("NSS/Pooled textures"),
+		TEXT("NSS/Memory"),
+		TEXT("NSS/Context creations"),
+		TEXT("NSS/Output crop copies"),
+		TEXT("NSS/History resets"),
+	};
+	TraceServices::IEditableCounterProvider& CounterProvider = TraceServices::EditCounterProvider(Session);
+	for (int32 Index = 0; Index < int32(ECounter::Num); Index++)
+	{
+		Counters[Index] = CounterProvider.CreateEditableCounter();
+		Counters[Index]->SetName(Names[Index]);
+		Counters[Index]->SetIsFloatingPoint(false);
+	}
+	Counters[int32(ECounter::AllocatedBytes)]->SetDisplayHint(TraceServices::CounterDisplayHint_Memory);
+}
+
+void NSSTraceProvider::AddFrameCounters(double Time, const NSSTraceFrameCounters& FrameCounters)
+{
+	Session.WriteAccessCheck();
+	if (!Counters[0])
+	{
+		CreateCounters();
+	}
+	Counters[int32(ECounter::LiveContexts)]->SetValue(Time, int64(FrameCounters.LiveContexts));
+	Counters[int32(ECounter::PooledTextures)]->SetValue(Time, int64(FrameCounters.PooledTextures));
+	Counters[int32(ECounter::AllocatedBytes)]->SetValue(Time, int64(FrameCounters.AllocatedBytes));
+	Counters[int32(ECounter::ContextCreations)]->SetValue(Time, int64(FrameCounters.ContextCreations));
+	Counters[int32(ECounter::CropCopies)]->SetValue(Time, int64(FrameCounters.CropCopies));
+	Counters[int32(ECounter::HistoryResets)]->SetValue(Time, int64(FrameCounters.HistoryResets));
+
+	Summary.Frames++;
+	Summary.PeakLiveContexts = FMath::Max(Summary.PeakLiveContexts, FrameCounters.LiveContexts);
+	Summary.PeakPooledTextures = FMath::Max(Summary.PeakPooledTextures, FrameCounters.PooledTextures);
+	Summary.PeakAllocatedBytes = FMath::Max(Summary.PeakAllocatedBytes, FrameCounters.AllocatedBytes);
+	Summary.CropCopies += FrameCounters.CropCopies;
+	Summary.HistoryResets += FrameCounters.HistoryResets;
+}
+
+void NSSTraceProvider::AddContextCreation(const NSSTraceContextCreation& Creation)
+{
+	Session.WriteAccessCheck();
+	ContextCreations.Add(Creation);
+	Summary.ContextCreations++;
+	if (Creation.bAheadOfTime)
+	{
+		Summary.ContextCreationsAheadOfTime++;
+	}
+	else
+	{
+		Summary.RenderThreadCreationSeconds += Creation.Seconds;
+		Summary.MaxRenderThreadCreationSeconds = FMath::Max(Summary.MaxRenderThreadCreationSeconds, Creation.Seconds);
+	}
+}
@@ -0,0 +1,96 @@
+// SPDX-FileCopyrightText: Copyright 2025 Arm Limited and/or its affiliates <open-source-office@arm.com>
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "TraceServices/Model/AnalysisSession.h"
+
+namespace TraceServices
+{
+	class IEditableCounter;
+}
+
+// The counters NSS outputs at the end of each frame.
+struct NSSTraceFrameCounters
+{
+	int32 LiveContexts = 0;
+	int32 PooledTextures = 0;
+	uint64 AllocatedBytes = 0;
+	int32 ContextCreations = 0;
+	int32 CropCopies = 0;
+	int32 HistoryResets = 0;
+};
+
+struct NSSTraceContextCreation
+{
+	// Session time at which the context was ready.
+	double Time = 0.0;
+	double Seconds = 0.0;
+	uint32 ViewID = 0;
+	FIntPoint InputSize = FIntPoint::ZeroValue;
+	FIntPoint OutputSize = FIntPoint::ZeroValue;
+	bool bAheadOfTime = false;
+};
+
+struct NSSINSIGHTS_API NSSTraceSummary
+{
+	int32 Frames = 0;
+	int32 ContextCreations = 0;
+	int32 ContextCreationsAheadOfTime = 0;
+	// Of the creations on the render thread, which are the ones that hitch.
+	double RenderThreadCreationSeconds = 0.0;
+	double MaxRenderThreadCreationSeconds = 0.0;
+	int32 PeakLiveContexts = 0;
+	int32 PeakPooledTextures = 0;
+	uint64 PeakAllocatedBytes = 0;
+	int64 CropCopies = 0;
+	int64 HistoryResets = 0;
+
+	FString ToString() const;
+};
+
+//-------------------------------------------------------------------------------------
+// What NSS output on its trace channel during a session. The frame counters are also published as counters of the
+// session, which the Timing view shows as tracks and the Counters panel aggregates.
+//-------------------------------------------------------------------------------------
+class NSSINSIGHTS_API NSSTraceProvider : public TraceServices::IProvider
+{
+public:
+	explicit NSSTraceProvider(TraceServices::IAnalysisSession& InSession);
+
+	static FName GetProviderName();
+
+	// Called with the session being edited.
+	void AddFrameCounters(double Time, const NSSTraceFrameCounters& FrameCounters);
+	void AddContextCreation(const NSSTraceContextCreation& Creation);
+
+	const TArray<NSSTraceContextCreation>& GetContextCreations() const
+	{
+		return ContextCreations;
+	}
+
+	const NSSTraceSummary& GetSummary() const
+	{
+		return Summary;
+	}
+
+private:
+	enum class ECounter : uint8
+	{
+		LiveContexts,
+		PooledTextures,
+		AllocatedBytes,
+		ContextCreations,
+		CropCopies,
+		HistoryResets,
+		Num
+	};
+
+	void CreateCounters();
+
+	TraceServices::IAnalysisSession& Session;
+	TraceServices::IEditableCounter* Counters[int32(ECounter::Num)] = {};
+	TArray<NSSTraceContextCreation> ContextCreations;
+	NSSTraceSummary Summary;
+};